@@ -5,11 +5,27 @@
 #include <stdlib.h>
 #include <time.h>
 #include "awk.h"
+#include "ytab.h"
 #include "edlib.h"
 #include "end_adapter.h"
-extern char *md5str(uint8_t *msg, size_t len);
-
-int bio_flag = 0, bio_fmt = BIO_NULL;
+#include "fxpar.h"
+#include "thrio.h"
+#include "seqpack.h"
+#include "kmer.h"
+#include "rsort.h"
+#include "memfind.h"
+#include "xlate.h"
+#include "md5.h"
+#include "fhash.h"
+#include "attr.h"
+#include "cigar.h"
+#include "cov.h"
+#include "ivl.h"
+#include "join.h"
+#include "table.h"
+#include "snap.h"
+
+int bio_flag = 0, bio_fmt = BIO_NULL, bio_nthreads = 1;
 #define SKIPNONNULL(pch) (*pch != '\0' && pch++) // expression version of if(*pch != '\0') pch++;
 
 /* 14Oct2024 change BIO_FMEANQUAL based on this: https://github.com/nanoporetech/dorado/issues/937 */
@@ -230,7 +246,7 @@ char bio_lookup_codon(const char *dna, int table)
     return codon_table[ix][table];
 }
 
-void bio_translate(char *dna, char *out, int table)
+static int bio_translate_table(int table)
 {
     switch(table) {
         case 6:
@@ -249,11 +265,16 @@ void bio_translate(char *dna, char *out, int table)
             }
             break;
     }
+    return table;
+}
 
+void bio_translate(char *dna, char *out, int table)
+{
     int i;
     int dnaSize;
     int protSize = 0;
 
+    table = bio_translate_table(table);
     dnaSize = strlen(dna);
     for (i=0; i<dnaSize-2; i+=3)
     {
@@ -263,6 +284,310 @@ void bio_translate(char *dna, char *out, int table)
         out[i] = '\0';
 }
 
+/* translate a string packed by seqpack(); out needs seqpack_len(p)/3 + 1 chars */
+void bio_translate_packed(const char *p, char *out, int table)
+{
+    size_t i, n = seqpack_len(p);
+    int j, bv, ix;
+
+    table = bio_translate_table(table);
+    for (i = 0; i + 2 < n; i += 3) {
+        for (j = ix = 0; j < 3; ++j) {
+            if ((bv = seqpack_ntval(seqpack_nib(p, i + j))) > 3)
+                break;
+            ix = (ix<<2) + bv;
+        }
+        *out++ = j < 3 ? 'X' : codon_table[ix][table];
+    }
+    *out = '\0';
+}
+
+/* the codons of dna in all six frames in one pass: frame f (0..2) of dna
+ * into out[f] and frame f of its reverse complement into out[3+f], each
+ * needing n/3 + 1 chars. A 6-bit codon index is kept for each strand as the
+ * bases go by; with T C A G as 0..3, complementing a base is x^2. */
+static void bio_translate6(const char *dna, size_t n, char *out[6], int table)
+{
+    char aa[64];
+    size_t j, m = 0, rm;
+    int c, f = 0, rf, good = 0, fwd = 0, rev = 0;
+
+    table = bio_translate_table(table);
+    for (c = 0; c < 64; ++c)
+        aa[c] = codon_table[c][table];
+    for (c = 0; c < 3; ++c)
+        out[c][n > c ? (n - c) / 3 : 0] = out[3 + c][n > c ? (n - c) / 3 : 0] = '\0';
+    if (n < 3) return;
+    rf = (n - 3) % 3, rm = (n - 3) / 3; /* codon at j is codon rm of reverse frame rf */
+    for (j = 0; j < 2; ++j) {
+        c = ntval4[(unsigned char)dna[j]];
+        good = c > 3 ? 0 : good + 1;
+        fwd = (fwd << 2 | (c & 3)) & 63;
+        rev = rev >> 2 | ((c & 3) ^ 2) << 4;
+    }
+    for (j = 0; j + 2 < n; ++j) {
+        c = ntval4[(unsigned char)dna[j + 2]];
+        good = c > 3 ? 0 : good < 3 ? good + 1 : 3;
+        fwd = (fwd << 2 | (c & 3)) & 63;
+        rev = rev >> 2 | ((c & 3) ^ 2) << 4;
+        out[f][m] = good == 3 ? aa[fwd] : 'X';
+        out[3 + rf][rm] = good == 3 ? aa[rev] : 'X';
+        if (++f == 3) f = 0, ++m;
+        if (rf-- == 0) rf = 2, --rm;
+    }
+}
+
+typedef struct {
+    size_t beg, end; /* 1-based, beg <= end on either strand */
+    int strand;      /* '+' or '-' */
+    const char *aa;  /* the protein, ending before the stop */
+    size_t len;
+} orf_t;
+
+static int orf_cmp(const void *p, const void *q)
+{
+    const orf_t *a = (const orf_t *)p, *b = (const orf_t *)q;
+    if (a->beg != b->beg) return a->beg < b->beg ? -1 : 1;
+    if (a->strand != b->strand) return a->strand < b->strand ? -1 : 1;
+    return a->end < b->end ? -1 : a->end > b->end;
+}
+
+/* ORFs from an M to the next stop in the six frames from bio_translate6, at
+ * least min_len amino acids long; only the first M after a stop starts one */
+static size_t bio_orfs(char *frames[6], size_t n, size_t min_len, orf_t **orfs)
+{
+    size_t m, len, start, no = 0, mo = 0;
+    int f;
+    char *p;
+
+    *orfs = 0;
+    for (f = 0; f < 6; ++f) {
+        p = frames[f];
+        len = n > (size_t)(f % 3) ? (n - f % 3) / 3 : 0;
+        for (m = 0, start = len; m < len; ++m) {
+            if (p[m] == 'M' && start == len)
+                start = m;
+            else if (p[m] == '*' && start < len) {
+                if (m - start >= min_len) {
+                    if (no == mo && (*orfs = (orf_t *)realloc(*orfs, (mo = mo ? 2 * mo : 64) * sizeof(orf_t))) == NULL)
+                        FATAL("out of space in orfs");
+                    orf_t *o = &(*orfs)[no++];
+                    if (f < 3)
+                        o->beg = f + 3 * start + 1, o->end = f + 3 * m + 3, o->strand = '+';
+                    else
+                        o->beg = n - (f - 3) - 3 * m - 2, o->end = n - (f - 3) - 3 * start, o->strand = '-';
+                    o->aa = p + start, o->len = m - start;
+                }
+                start = len;
+            }
+        }
+    }
+    qsort(*orfs, no, sizeof(orf_t), orf_cmp);
+    return no;
+}
+
+/* clears ap and makes it an empty array of size slots, for a builtin
+ * that fills in its array argument */
+static Array *resetarray(Cell *ap, int size)
+{
+    freesymtab(ap);
+    ap->tval &= ~STR;
+    ap->tval |= ARR;
+    ap->sval = (char *) makesymtab(size);
+    return (Array *) ap->sval;
+}
+
+/* whether c, the value of argument node n, is an array or a variable or
+ * parameter that was never assigned, so can be made one */
+static int array_arg(Node *n, Cell *c)
+{
+    if (isarr(c))
+        return 1;
+    if (!(isvalue(n) && ((Cell *) n->narg[0])->csub == CVAR) && !(isexpr(n) && n->nobj == ARG))
+        return 0;
+    return (c->tval & (NUM|STR|FLD|CON)) == (NUM|STR) && *c->sval == '\0' && c->fval == 0;
+}
+
+static void kmer_to_array(const char *kmer, unsigned long count, void *data)
+{
+    char num_str[50];
+    snprintf(num_str, sizeof(num_str), "%lu", count);
+    setsymtab(kmer, num_str, count, STR|NUM, (Array *) data);
+}
+
+static void kmer_to_file(const char *kmer, unsigned long count, void *data)
+{
+    fprintf((FILE *) data, "%s\t%lu\n", kmer, count);
+}
+
+/* the chrom, start and end columns of a -c format for ivl_load(); 0 if it has none */
+static int ivl_fmt_cols(const char *fmt, ivl_cols_t *cols)
+{
+    int i, j;
+
+    if (strcmp(fmt, "gtf") == 0)
+        fmt = "gff";
+    for (i = 1; col_defs[i][0]; ++i)
+        if (strcmp(fmt, col_defs[i][0]) == 0) break;
+    if (col_defs[i][0] == NULL)
+        return 0;
+    cols->chrom = cols->beg = cols->end = -1;
+    for (j = 1; col_defs[i][j]; ++j) {
+        if (strcmp(col_defs[i][j], "chrom") == 0 || strcmp(col_defs[i][j], "seqname") == 0)
+            cols->chrom = j - 1;
+        else if (strcmp(col_defs[i][j], "start") == 0)
+            cols->beg = j - 1;
+        else if (strcmp(col_defs[i][j], "end") == 0)
+            cols->end = j - 1;
+    }
+    cols->one_based = i == BIO_GFF;
+    return cols->chrom >= 0 && cols->beg >= 0 && cols->end >= 0;
+}
+
+/* how join_open() reads fmt, a -c format or "" for none; 0 if there is no such format */
+static int join_fmt(const char *fmt, join_fmt_t *jf)
+{
+    int i;
+
+    memset(jf, 0, sizeof(join_fmt_t));
+    if (*fmt == '\0')
+        return 1;
+    if (strcmp(fmt, "hdr") == 0)
+        fmt = "header";
+    else if (strcmp(fmt, "gtf") == 0)
+        fmt = "gff";
+    for (i = 0; col_defs[i][0]; ++i)
+        if (strcmp(fmt, col_defs[i][0]) == 0) break;
+    if (col_defs[i][0] == NULL)
+        return 0;
+    jf->header = i == BIO_HDR;
+    jf->fastx = i == BIO_FASTX;
+    jf->tabs = tab_delim[i] == 'y' || i == BIO_FASTX;
+    jf->hdr = hdr_chr[i];
+    jf->names = col_defs[i];
+    return 1;
+}
+
+/* each line into arr[1], arr[2], ... for ivl_overlap() and join_next() */
+typedef struct {
+    Array *tp;
+    int n;
+} line_out_t;
+
+static void line_to_array(const char *line, size_t n, void *data)
+{
+    line_out_t *o = (line_out_t *) data;
+    setsnval(setnumsymtab(++o->n, "", 0.0, STR, o->tp), line, n);
+}
+
+/* arr[key] = val for load_table(); a later line for the same key wins, as with m[$1] = $2 */
+typedef struct {
+    Array *tp;
+    char *buf;
+    size_t size;
+} table_out_t;
+
+static void table_to_array(const char *key, size_t kn, const char *val, size_t vn, void *data)
+{
+    table_out_t *o = (table_out_t *) data;
+    char *k, *v;
+    Awkfloat f = 0.0;
+    unsigned t = STR;
+    int n = o->tp->nelem;
+    Cell *p;
+
+    if (kn + vn + 2 > o->size) {
+        o->size = (kn + vn + 2) * 2;
+        if ((o->buf = (char *) realloc(o->buf, o->size)) == NULL)
+            FATAL("out of space in load_table");
+    }
+    k = o->buf, v = o->buf + kn + 1;
+    memcpy(k, key, kn), k[kn] = '\0';
+    memcpy(v, val, vn), v[vn] = '\0';
+    if (is_number(v))
+        f = atof(v), t |= NUM;
+    p = setsymtab(k, v, f, t, o->tp);
+    if (o->tp->nelem == n) { /* there already */
+        freesval(p);
+        p->fval = f;
+        p->tval = t;
+        setcellstr(p, v, vn);
+    }
+}
+
+/* element i of the cells being saved by array_save(); a number alone keeps no string */
+static void snap_get_cell(size_t i, snap_item_t *it, void *data)
+{
+    Cell *p = ((Cell **) data)[i];
+
+    it->key = p->nval;
+    it->kn = strlen(p->nval);
+    it->val = p->tval & STR ? p->sval : "";
+    it->vn = strlen(it->val);
+    it->f = p->fval;
+    it->t = (p->tval & NUM ? SNAP_NUM : 0) | (p->tval & STR ? SNAP_STR : 0);
+}
+
+/* a bedGraph line for cov_emit(); the file is looked up each time as close() may have been called */
+static void cov_to_file(const char *chrom, long beg, long end, double depth, const char *out)
+{
+    FILE *fp;
+
+    if ((fp = openfile(GT, out)) == NULL)
+        FATAL("can't redirect to %s", out);
+    if (depth == (long) depth)
+        fprintf(fp, "%s\t%ld\t%ld\t%ld\n", chrom, beg, end, (long) depth);
+    else
+        fprintf(fp, "%s\t%ld\t%ld\t%.6g\n", chrom, beg, end, depth);
+}
+
+/* keys of tp into out[1..n], by key string ('k'), key number ('n'),
+ * value number ('v') or value string ('s'); ties go by key string */
+static long sort_keys(Array *tp, Array *out, int by, int rev)
+{
+    Cell **c = (Cell **)malloc((tp->nelem + 1) * sizeof(Cell *));
+    char **s = (char **)malloc((tp->nelem + 1) * sizeof(char *));
+    rsort_t *r = (rsort_t *)malloc((tp->nelem + 1) * sizeof(rsort_t));
+    size_t i, n;
+    Cell *p;
+
+    if (c == NULL || s == NULL || r == NULL)
+        FATAL("out of space sorting %d keys", tp->nelem);
+    n = arraycells(tp, c);
+    for (i = 0; i < n; ++i)
+        s[i] = c[i]->nval, r[i].i = i;
+    rsort_str(r, n, s, by == 'k' && rev);
+    if (by != 'k') { /* the keys are in order: sort that stably by the rest */
+        Cell **d = (Cell **)malloc((n + 1) * sizeof(Cell *));
+        if (d == NULL)
+            FATAL("out of space sorting %d keys", tp->nelem);
+        for (i = 0; i < n; ++i)
+            d[i] = c[r[i].i];
+        free(c);
+        c = d;
+        for (i = 0; i < n; ++i) {
+            r[i].i = i;
+            if (by == 's')
+                s[i] = getsval(c[i]);
+            else
+                r[i].key = rsort_dbl(by == 'n' ? atof(c[i]->nval) : getfval(c[i])) ^ (rev ? ~0ULL : 0);
+        }
+        if (by == 's')
+            rsort_str(r, n, s, rev);
+        else
+            rsort_u64(r, n);
+    }
+    for (i = 0; i < n; ++i) {
+        p = c[r[i].i];
+        if (is_number(p->nval))
+            setnumsymtab(i + 1, p->nval, atof(p->nval), STR|NUM, out);
+        else
+            setnumsymtab(i + 1, p->nval, 0.0, STR, out);
+    }
+    free(c), free(s), free(r);
+    return n;
+}
+
 Cell *set_array_ele(const char *key, const char *val, Array *ap)
 {
     if (is_number(val))
@@ -271,44 +596,136 @@ Cell *set_array_ele(const char *key, const char *val, Array *ap)
         return setsymtab(key, val, 0.0, STR, ap);
 }
 
-int codons_find(const char *nt, const char *aa, Cell *ap, int table_index, int hamming_threshold, int max_return) {
-    char *exon = calloc(3*(strlen(aa)+3), sizeof(char));
-    const char *p = nt, *pfirstcodon = NULL, *paa = aa;
-    int num_found = 0, allowed_mismatches;
-
-    char first = *aa; // remember first codon char
-    while (*p) {
-        for (; *p; p++) { // find first codon
-            if (bio_lookup_codon(p, table_index) == first) {
-                pfirstcodon = p;
+/* find_codons() patterns are compiled into a bit-parallel automaton over
+ * codons: eq[c] has bit j set when codon c (64 for one with a base other
+ * than ACGT) may stand at position j of the amino acid pattern, that is the
+ * pattern has '.' there or c translates to it. The state r[i] of a frame
+ * has bit j set when the last j+1 codons of the frame match the first j+1
+ * of the pattern with at most i mismatches; the first codon may not be a
+ * mismatch. The last pattern compiled is kept for the next call. */
+#define CODONS_MAXBITS 64
+
+typedef struct {
+    char *aa;          /* the pattern, NULL before the first call */
+    int table, k;      /* translation table, mismatches allowed */
+    size_t m;          /* pattern length in codons */
+    uint64_t eq[65];
+    char *hit;         /* 3*m + 1 chars for the matched codons */
+} codons_pat_t;
+
+static codons_pat_t g_codons;
+
+static codons_pat_t *codons_compile(const char *aa, int table, int k)
+{
+    codons_pat_t *cp = &g_codons;
+    size_t j;
+    int c;
+
+    if (k < 0) k = 0;
+    if (cp->aa && cp->table == table && cp->k == k && strcmp(cp->aa, aa) == 0)
+        return cp;
+    free(cp->aa), free(cp->hit);
+    cp->aa = tostring(aa);
+    cp->table = table, cp->k = k;
+    cp->m = strlen(aa);
+    if ((cp->hit = (char *) malloc(3 * cp->m + 1)) == NULL)
+        FATAL("out of space in find_codons");
+    memset(cp->eq, 0, sizeof(cp->eq));
+    for (j = 0; j < cp->m && j < CODONS_MAXBITS; ++j)
+        for (c = 0; c < 65; ++c)
+            if (aa[j] == '.' || aa[j] == (c < 64 ? codon_table[c][table] : 'X'))
+                cp->eq[c] |= (uint64_t)1 << j;
+    return cp;
+}
+
+/* the codon class of each position of nt: 0..63, or 64 when its 3 bases are not all ACGT */
+static unsigned char *codon_classes(const char *nt, size_t n)
+{
+    unsigned char *cls = (unsigned char *) malloc(n > 2 ? n - 2 : 1);
+    size_t i;
+    int ix = 0, good = 0, bv;
+
+    if (cls == NULL)
+        FATAL("out of space in find_codons");
+    for (i = 0; i < n; ++i) {
+        bv = ntval4[(unsigned char)nt[i]];
+        ix = (ix << 2 | (bv & 3)) & 63;
+        good = bv > 3 ? 0 : good + 1;
+        if (i >= 2)
+            cls[i - 2] = good >= 3 ? ix : 64;
+    }
+    return cls;
+}
+
+static void codons_hit(codons_pat_t *cp, const char *nt, size_t beg, Array *tp)
+{
+    char numstr[50];
+
+    memcpy(cp->hit, nt + beg, 3 * cp->m);
+    cp->hit[3 * cp->m] = '\0';
+    snprintf(numstr, sizeof(numstr), "%lu", (unsigned long)(beg + 1));
+    set_array_ele(numstr, cp->hit, tp);
+}
+
+/* find_codons() for patterns longer than CODONS_MAXBITS: each start is checked against the codon classes */
+static int codons_find_long(codons_pat_t *cp, const char *nt, size_t n, Array *tp, int max_return)
+{
+    unsigned char *cls = codon_classes(nt, n);
+    size_t beg, j, span = 3 * cp->m;
+    int num_found = 0, miss;
+    char a;
+
+    for (beg = 0; beg + span <= n; ++beg) {
+        for (j = 0, miss = 0; j < cp->m; ++j) {
+            a = cls[beg + 3*j] < 64 ? codon_table[cls[beg + 3*j]][cp->table] : 'X';
+            if (cp->aa[j] != '.' && cp->aa[j] != a && (j == 0 || ++miss > cp->k))
                 break;
-            }
         }
-        if (*p && pfirstcodon) { // now check all consecutive 3 bases match desired AA codons (rechecks first codon too)
-            allowed_mismatches = hamming_threshold;
-            // dot matches anything, otherwise need matching codon, or can have up to hamming_threshold mismatches
-            while (*paa && (*paa=='.' || bio_lookup_codon(p, table_index)==*paa || allowed_mismatches-- > 0) ) {
-                strncat(exon, p, 3);  // copy codon
-                p += 3; // only move p if we have a codon. that guarantees we did not have the terminating null in those 3 chars
-                ++paa;
-            }
-            if (*paa == '\0') { // we have them all, store exon val and position in string as key in array ap
-                char numstr[50];
-                snprintf(numstr, sizeof(numstr), "%ld", pfirstcodon - nt + 1);
-                set_array_ele(numstr, exon, (Array *) ap->sval);
-                num_found++;
+        if (j == cp->m) {
+            codons_hit(cp, nt, beg, tp);
+            if (++num_found == max_return)
+                break;
+            beg += span - 1;
+        }
+    }
+    free(cls);
+    return num_found;
+}
 
-                if (max_return > 0 && num_found >= max_return)
-                    break;
-            }
-            else // did not get all codons, have to move back to base after our first codon and try again
-                p = pfirstcodon + 1;
-            pfirstcodon = NULL;
-            paa = aa;
-            exon[0] = '\0';
+int codons_find(const char *nt, const char *aa, Cell *ap, int table_index, int hamming_threshold, int max_return) {
+    codons_pat_t *cp;
+    Array *tp = (Array *) ap->sval;
+    uint64_t r[3][CODONS_MAXBITS], last;
+    size_t n = strlen(nt), i, span, next = 0;
+    int num_found = 0, f, k, lv, ix = 0, good = 0, bv, c;
+
+    if (*aa == '\0')
+        return 0;
+    cp = codons_compile(aa, table_index, hamming_threshold);
+    if (cp->m > CODONS_MAXBITS)
+        return codons_find_long(cp, nt, n, tp, max_return);
+    span = 3 * cp->m;
+    k = cp->k < (int)cp->m ? cp->k : (int)cp->m - 1; // more can never be used
+    last = (uint64_t)1 << (cp->m - 1);
+    memset(r, 0, sizeof(r));
+
+    for (i = 0, f = 0; i < n; ++i, f = f == 2 ? 0 : f + 1) { // the codon ending at i is in frame f
+        bv = ntval4[(unsigned char)nt[i]];
+        ix = (ix << 2 | (bv & 3)) & 63;
+        good = bv > 3 ? 0 : good + 1;
+        if (i < 2)
+            continue;
+        c = good >= 3 ? ix : 64;
+        for (lv = k; lv > 0; --lv) // from the top, so r[f][lv-1] is still the old state
+            r[f][lv] = ((r[f][lv] << 1 | 1) & cp->eq[c]) | r[f][lv - 1] << 1;
+        r[f][0] = (r[f][0] << 1 | 1) & cp->eq[c];
+        if ((r[f][k] & last) && i + 1 >= span && i + 1 - span >= next) {
+            codons_hit(cp, nt, i + 1 - span, tp);
+            if (++num_found == max_return)
+                break;
+            next = i + 1;
         }
     }
-    free(exon);
     return num_found;
 }
 
@@ -456,6 +873,75 @@ EdlibEqualityPair NYR_maps[8] = {{'N', 'A'}, {'N', 'C'}, {'N', 'G'}, {'N', 'T'},
 
 #define tempfree(x)	  if (istemp(x)) tfree(x); else
 
+/* the cigar() statistic named what into *r; -1 if there is none */
+static int cigar_stat(const cigar_t *c, const char *what, Awkfloat *r)
+{
+    static const char *stat[] = { "aligned", "clip_left", "clip_right", "del", "hard_left", "hard_right", "ins",
+        "match", "mismatch", "ops", "query", "ref", "skip", "soft_left", "soft_right" };
+    size_t i;
+
+    for (i = 0; i < sizeof(stat) / sizeof(stat[0]); ++i)
+        if (strcmp(what, stat[i]) == 0) break;
+    switch (i) {
+    case 0: *r = c->match + c->ins; break;
+    case 1: *r = c->soft[0] + c->hard[0]; break;
+    case 2: *r = c->soft[1] + c->hard[1]; break;
+    case 3: *r = c->del; break;
+    case 4: *r = c->hard[0]; break;
+    case 5: *r = c->hard[1]; break;
+    case 6: *r = c->ins; break;
+    case 7: *r = c->match; break;
+    case 8: *r = c->mismatch; break;
+    case 9: *r = c->n; break;
+    case 10: *r = c->query; break;
+    case 11: *r = c->ref; break;
+    case 12: *r = c->skip; break;
+    case 13: *r = c->soft[0]; break;
+    case 14: *r = c->soft[1]; break;
+    default: return -1;
+    }
+    return 0;
+}
+
+/* the values of a SAM tag of type typ into tp[1..n]: each number of a B
+ * array, otherwise the one value. Returns n. */
+static long sam_tag_values(char typ, const char *val, size_t vlen, Array *tp)
+{
+    const char *p = val, *end = val + vlen, *q;
+    char buf[64], *e;
+    double d;
+    long n = 0;
+    size_t k;
+
+    if (typ != 'B') {
+        char *s = (char *) malloc(vlen + 1);
+        if (s == NULL)
+            FATAL("out of space in samtag_array");
+        memcpy(s, val, vlen);
+        s[vlen] = '\0';
+        if (is_number(s))
+            setnumsymtab(1, s, atof(s), STR|NUM, tp);
+        else
+            setnumsymtab(1, s, 0.0, STR, tp);
+        free(s);
+        return 1;
+    }
+    if (p < end && strchr("cCsSiIf", *p) != NULL) // skip the subtype
+        ++p;
+    while (p < end && *p == ',') {
+        ++p;
+        if ((q = (const char *) memchr(p, ',', end - p)) == NULL)
+            q = end;
+        k = (size_t)(q - p) < sizeof(buf) ? (size_t)(q - p) : sizeof(buf) - 1;
+        memcpy(buf, p, k);
+        buf[k] = '\0';
+        d = strtod(buf, &e); // before e is looked at
+        setnumsymtab(++n, buf, d, *e == '\0' && k > 0 ? STR|NUM : STR, tp);
+        p = q;
+    }
+    return n;
+}
+
 Cell *bio_func(int f, Cell *x, Node **a)
 {
     Cell *y, *z;
@@ -488,27 +974,35 @@ Cell *bio_func(int f, Cell *x, Node **a)
             tempfree(z);
         }
     } else if (f == BIO_FREVERSE) {
-        char *buf = getsval(x);
-        int i, l, tmp;
-        l = strlen(buf);
-        for (i = 0; i < l>>1; ++i)
-            tmp = buf[i], buf[i] = buf[l-1-i], buf[l-1-i] = tmp;
-        setsval(y, buf);
+        char *buf = ownsval(x); /* reversed in place */
+        int i, l = getslen(x), tmp;
+        if (seqpack_is(buf)) {
+            seqpack_reverse(buf, 0);
+        } else {
+            for (i = 0; i < l>>1; ++i)
+                tmp = buf[i], buf[i] = buf[l-1-i], buf[l-1-i] = tmp;
+        }
+        setsnval(y, buf, l);
     } else if (f == BIO_FREVCOMP) {
         char *buf;
         int i, l, tmp;
-        buf = getsval(x);
-        l = strlen(buf);
-        for (i = 0; i < l>>1; ++i)
-            tmp = comp_tab[(int)buf[i]], buf[i] = comp_tab[(int)buf[l-1-i]], buf[l-1-i] = tmp;
-        if (l&1) buf[l>>1] = comp_tab[(int)buf[l>>1]];
-        setsval(y, buf);
+        buf = ownsval(x); /* complemented in place */
+        l = getslen(x);
+        if (seqpack_is(buf)) { /* a word at a time */
+            seqpack_reverse(buf, 1);
+        } else {
+            for (i = 0; i < l>>1; ++i)
+                tmp = comp_tab[(int)buf[i]], buf[i] = comp_tab[(int)buf[l-1-i]], buf[l-1-i] = tmp;
+            if (l&1) buf[l>>1] = comp_tab[(int)buf[l>>1]];
+        }
+        setsnval(y, buf, l);
     } else if (f == BIO_FGC) {
         char *buf;
         int i, l, gc = 0;
         buf = getsval(x);
-        l = strlen(buf);
-        if (l) { /* don't try for empty strings */
+        if (seqpack_is(buf)) { /* counted a word at a time */
+            setfval(y, (Awkfloat)seqpack_gc(buf) / seqpack_len(buf));
+        } else if ((l = getslen(x)) != 0) { /* don't try for empty strings */
             for (i = 0; i < l; ++i)
                 if (buf[i] == 'g' || buf[i] == 'c' ||
                     buf[i] == 'G' || buf[i] == 'C')
@@ -528,7 +1022,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
         }
         */
         char *buf = getsval(x);
-        int l = strlen(buf), offset = 0;
+        int l = getslen(x), offset = 0;
         double phred_score = 0.0;  // return 0 if buf empty
 
         if (phred_errors[0] == 0) { // initialize error table. [0] val inits to 1
@@ -568,7 +1062,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             }
         }
         buf = getsval(x);
-        l = strlen(buf);
+        l = getslen(x);
         if (q_int2real[0] == 0.) /* to initialize */
             for (i = 0; i < 128; ++i)
                 q_int2real[i] = pow(10., -(i - 33) / 10.);
@@ -590,7 +1084,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             char *buf;
             int i, l, thres, cnt = 0;
             buf = getsval(x);
-            l = strlen(buf);
+            l = getslen(x);
             z = execute(a[1]->nnext); /* threshold */
             thres = (int)(getfval(z) + .499);
             for (i = 0; i < l; ++i)
@@ -609,8 +1103,13 @@ Cell *bio_func(int f, Cell *x, Node **a)
             tempfree(z);
         }
         buf = getsval(x);
-        out = calloc(strlen(buf), sizeof(char));
-        bio_translate(buf, out, transtable);
+        if (seqpack_is(buf)) {
+            out = calloc(seqpack_len(buf)/3 + 1, sizeof(char));
+            bio_translate_packed(buf, out, transtable);
+        } else {
+            out = calloc(getslen(x) + 1, sizeof(char));
+            bio_translate(buf, out, transtable);
+        }
         setsval(y, out);
         free(out);
     } else if (f == BIO_GFFATTR || f == BIO_GTFATTR || f == BIO_SAMATTR) {
@@ -619,9 +1118,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             ap = execute(a[1]->nnext);
             if (a[1]->nnext->nnext != 0) {  // 3rd arg names array for holding field positions pos[1], pos[2] etc.
                 posp = execute(a[1]->nnext->nnext);
-                freesymtab(posp);
-                posp->tval &= ~STR; posp->tval |= ARR;
-                posp->sval = (char *) makesymtab(NSYMTAB);
+                resetarray(posp, NSYMTAB);
             }
         } else {
             char usage[150];
@@ -634,10 +1131,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             FATAL(usage);
         }
         int numattrs = 0;
-        freesymtab(ap);
-        ap->tval &= ~STR;
-        ap->tval |= ARR;
-        ap->sval = (char *) makesymtab(NSYMTAB);
+        resetarray(ap, NSYMTAB);
         if (f != BIO_SAMATTR) {
             char kw_delimiter = (f == BIO_GTFATTR) ? ' ' : '=';
             int del_val_quotes = (f == BIO_GTFATTR);
@@ -653,8 +1147,8 @@ Cell *bio_func(int f, Cell *x, Node **a)
         setfval(y, (Awkfloat)lclock);
     } else if (f == BIO_FSETAT) {  /* 06Mar2019 JBH_CAS set characters by position of string (eg seq) */ /* setat(str,pos,vals[,optional_repeat_count])  */
         Cell *u = 0, *v = 0;
-        char *buf = getsval(x);
-        int l = strlen(buf); int WARN = (l==0);
+        char *buf = ownsval(x);
+        int l = getslen(x); int WARN = (l==0);
         if (l) { /* don't try for empty strings */
             if (a[1]->nnext == 0 || a[1]->nnext->nnext == 0) {
                 WARN = 1;
@@ -687,7 +1181,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
         Cell *u = 0, *v = 0;
         int diff = -1, N_wildcard = 0;
         char *pat = getsval(x);
-        int compare_len = strlen(pat);
+        int compare_len = getslen(x);
         if (compare_len < 1 || a[1]->nnext == 0) {
             WARNING("hamming requires 2 to 5 arguments: pattern,text [, text_pos: (1_indexed)default 1 [, case_sensitive: true [, N_wildcard: false] ]]");
         } else {
@@ -699,7 +1193,6 @@ Cell *bio_func(int f, Cell *x, Node **a)
                 text_ofs = -1 + (int)getfval(v);  /* convert awk 1-indexed pos to C 0-indexed offset */
             }
             if (text_ofs < 0) text_ofs = 0;
-            text += text_ofs;  /* note: for performance we are not checking bounds which is dangerous in the wild */
 
             if (a[1]->nnext->nnext && a[1]->nnext->nnext->nnext) { /* if optional case_sensitive arg is there, use it */
                 z = execute(a[1]->nnext->nnext->nnext);
@@ -712,33 +1205,48 @@ Cell *bio_func(int f, Cell *x, Node **a)
                 }
             }
 
-            diff = 0;
-            int to_go = compare_len+1;
-            if (N_wildcard==0) {
-                if (case_sensitive) {
-                    while (--to_go && *text) {
-                        diff += *pat != *text;
-                        pat++; text++;
-                   }
-                }
-                else {
-                   while (--to_go && *text) {
-                        diff += toupper(*pat) != toupper(*text);
-                        pat++; text++;
-                   }
-                }
+            char *ptmp = 0, *ttmp = 0;
+            int to_go;
+            if (seqpack_is(pat) && seqpack_is(text) && N_wildcard==0) { /* compare a word at a time */
+                diff = seqpack_hamming(pat, text, text_ofs);
             } else {
-                while (--to_go && *text) {
-                    char p = *pat, t = *text;
+                if (seqpack_is(pat)) {
+                    pat = ptmp = sequnpack(pat);
+                    compare_len = strlen(pat);
+                }
+                if (seqpack_is(text))
+                    text = ttmp = sequnpack(text);
+                text += text_ofs;  /* note: for performance we are not checking bounds which is dangerous in the wild */
+
+                diff = 0;
+                to_go = compare_len+1;
+                if (N_wildcard==0) {
                     if (case_sensitive) {
-                        p = toupper(p); t = toupper(t);
+                        while (--to_go && *text) {
+                            diff += *pat != *text;
+                            pat++; text++;
+                       }
+                    }
+                    else {
+                       while (--to_go && *text) {
+                            diff += toupper(*pat) != toupper(*text);
+                            pat++; text++;
+                       }
+                    }
+                } else {
+                    while (--to_go && *text) {
+                        char p = *pat, t = *text;
+                        if (case_sensitive) {
+                            p = toupper(p); t = toupper(t);
+                        }
+                        if (p!='N' && t!='N')
+                            diff += (p != t);
+                        pat++; text++;
                     }
-                    if (p!='N' && t!='N')
-                        diff += (p != t);
-                    pat++; text++;
                 }
+                diff += to_go;
             }
-            diff += to_go;
+            free(ptmp); free(ttmp);
         }
         if(u!=0){tempfree(u);u=0;} if(v!=0){tempfree(v);v=0;}
         setfval(y, diff);
@@ -767,7 +1275,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             w = execute(a[1]->nnext->nnext); /* str1_match_len */
             int slen1 = (int)getfval(w); tempfree(w); w=0;
             if(slen1 < 1) /* if 0 or -1 passed we'll figure it out here */
-               slen1 = strlen(str1);
+               slen1 = getslen(u);
 
             v = execute(a[1]->nnext->nnext->nnext); /* str2 */
             char* str2 = getsval(v);
@@ -797,7 +1305,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
                 }
             }
             if (slen2 < 1) { /* get slen2 based on actual length; no arg 5 or trigger this by passing in 0 or -1 as str2_len arg */
-                slen2 = strlen(str2);
+                slen2 = getslen(v);
             }
             if (slen1 < 1 || slen2 < 1) {
                 char* msg = (slen1 < 1) ? "str1_match_len must be greater than or equal to 1" : "str2 empty";
@@ -879,12 +1387,17 @@ Cell *bio_func(int f, Cell *x, Node **a)
     } else if (f == BIO_FMD5) { /* 26May2020 JBH_CAS add md5() to return md5 string for input parm1 */
 
         char* seq_to_chk = getsval(x);
-        size_t len = strlen(seq_to_chk);
+        size_t len = getslen(x);
 
         if (len > 0) {
-            char* md5_rslt = md5str((unsigned char*)seq_to_chk, len);
+            md5_ctx_t c;
+            unsigned char digest[16];
+            char md5_rslt[33];
+            md5_init(&c);
+            md5_update(&c, seq_to_chk, len);
+            md5_final(&c, digest);
+            md5_hex(digest, md5_rslt);
             setsval(y, md5_rslt);
-            free(md5_rslt); *md5_rslt = '\0';
         } else {
             WARNING("md5 takes a string argument and returns its md5 value.");
         }
@@ -898,16 +1411,14 @@ Cell *bio_func(int f, Cell *x, Node **a)
         int WARN = (a[1]->nnext == 0);
         if ( ! WARN ) {
             ap = execute(a[1]->nnext);     /* array name */
-            freesymtab(ap);
-            ap->tval &= ~STR;
-            ap->tval |= ARR;
-            ap->sval = (char *) makesymtab(NSYMTAB);
+            resetarray(ap, NSYMTAB);
 
             char* seq = getsval(x);
-            if (seq && *seq) { /* we have chars to look at */
+            size_t len = getslen(x);
+            if (len > 0) { /* we have chars to look at */
 
-                for (char* pchr = seq; *pchr; pchr++) { /* count chars in string, store in our local array */
-                   int ch = (int)*pchr;
+                for (size_t i = 0; i < len; i++) { /* count chars in string, store in our local array */
+                   int ch = (unsigned char)seq[i];
                    counts[ch] += 1;
                    char_count += (counts[ch]==1);
                 }
@@ -933,8 +1444,8 @@ Cell *bio_func(int f, Cell *x, Node **a)
         int WARN = !(a[1]->nnext && a[1]->nnext->nnext); /* 2nd, 3rd args: start, length */
 
         if (!WARN) {
-            char *str = getsval(x);
-            int slen = 0; /* optional 5th arg lets us set this ourselves, otherwise use strlen() which can be very slow if we call this thousands of times */
+            char *str = ownsval(x);
+            int slen = 0; /* optional 5th arg still accepted; the length is cached in the Cell now, so it isn't needed for speed */
 
             Cell *u = execute(a[1]->nnext); /* start pos */
             Cell *v = execute(a[1]->nnext->nnext); /* length pos */
@@ -958,7 +1469,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
                 }
             }
             if (slen < 1)
-                slen = strlen(str);
+                slen = getslen(x);
             //char msg[100]; sprintf(msg, "%s,%d,%d,%d", str, start, length, mod_type); WARNING(msg);
 
             int ix = start - 1;
@@ -970,7 +1481,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
         }
 
         if (WARN)
-            WARNING("modstr(str, start, length, [mod_type, str_length]) mod_type 0 to lowercase, 1 to uppercase (default 0). optional str_length faster for multiple calls.");
+            WARNING("modstr(str, start, length, [mod_type, str_length]) mod_type 0 to lowercase, 1 to uppercase (default 0). optional str_length is accepted for compatibility.");
 
     } else if (f == BIO_APPLYCHARS) { /* loop over each char of str arg1 and execute 2nd arg for each setting CHAR and ORD variables */
         Cell *pcellchar = setsymtab("CHAR", "", 0.0, STR, symtab); /* setsymtab either creates and returns ptr to var as a Cell, or returns existing one  */
@@ -1009,26 +1520,31 @@ Cell *bio_func(int f, Cell *x, Node **a)
 
         char *catbuf = calloc(buf_len, sizeof(char));
         if (start_fld > 0) {
-            for (int n = start_fld; n <= end_fld && catbuf; n++, cat_len = strlen(catbuf)) {
+            for (int n = start_fld; n <= end_fld && catbuf; n++) {
                 Cell *fld = fldtab[n];
+                size_t fld_len = getslen(fld);
 
-                size_t needed = cat_len + strlen(fld->sval) + seplen + 1;
+                size_t needed = cat_len + fld_len + seplen + 1;
                 if (buf_len <= needed) {
                     buf_len = needed + 8192;
                     catbuf = realloc(catbuf, buf_len);
                 }
 
                 if (catbuf) {
-                    if (n > start_fld) strcat(catbuf, fldsep);
-                    strcat(catbuf, fld->sval);
+                    if (n > start_fld) {
+                        memcpy(catbuf + cat_len, fldsep, seplen);
+                        cat_len += seplen;
+                    }
+                    memcpy(catbuf + cat_len, fld->sval, fld_len);
+                    cat_len += fld_len;
                 }
             }
         } else {
             WARNING("\tfldcat(start_fldno, end_fldno[, separator])\n"
                     "\t\treturn fields from start_fldno to end_fldno with optional separator (default OFS).");
         }
-        setsval(y, catbuf);
-        free(catbuf); // setsval allocates buffer and does strcpy of catbuf
+        setsnval(y, catbuf ? catbuf : "", catbuf ? cat_len : 0);
+        free(catbuf); // setsnval allocates buffer and copies catbuf
 
     } else if (f == BIO_CODONSFIND) { /* find_codons(nt_str, AA_str, result_arr) */
         int num_found = -1, table_index = 0, max_return = -1, hamming_threshold = 0;
@@ -1039,9 +1555,7 @@ Cell *bio_func(int f, Cell *x, Node **a)
             Cell *u = execute(a[1]->nnext); // AA pattern to search as nucleotides
             char *aa = getsval(u); // pointer to AA pattern
             Cell *rslts = execute(a[1]->nnext->nnext); // 3rd arg names array for holding results
-            freesymtab(rslts);
-            rslts->tval &= ~STR; rslts->tval |= ARR;
-            rslts->sval = (char *) makesymtab(NSYMTAB);
+            resetarray(rslts, NSYMTAB);
 
             if (a[1]->nnext->nnext->nnext) { // optional something passed in, have not figured what yet
                 // need good way to specify table_num, max_return, and/or hamming threshold
@@ -1056,6 +1570,624 @@ Cell *bio_func(int f, Cell *x, Node **a)
             WARNING("\tfind_codons(nucleotides_to_search, AA_pattern, result_arr)\n");
         }
         setfval(y, (Awkfloat) num_found);
+    } else if (f == BIO_SEQPACK) { /* seqpack(seq) -- packs ACGTN 2 bases a byte, other strings returned as is */
+        char *buf = getsval(x), *p;
+        if (seqpack_is(buf) || (p = seqpack(buf)) == NULL)
+            setsval(y, buf);
+        else {
+            setsval(y, p);
+            free(p);
+        }
+    } else if (f == BIO_SEQUNPACK) { /* sequnpack(packed_seq) -- back to a string of ACGTN */
+        char *buf = getsval(x), *p;
+        if (seqpack_is(buf)) {
+            p = sequnpack(buf);
+            setsval(y, p);
+            free(p);
+        } else
+            setsval(y, buf);
+    } else if (f == BIO_KMERCOUNT) { /* kmercount(seq, k, handle[, canonical]) -- count k-mers of seq in the table named handle */
+        long n = 0;
+        if (a[1]->nnext == 0 || a[1]->nnext->nnext == 0) {
+            WARNING("kmercount(seq, k, handle[, canonical]) counts the k-mers of seq (k up to %d) in the table named handle. returns number counted.", KMER_MAX_K);
+        } else {
+            Cell *u;
+            int k, canonical = 0;
+            z = execute(a[1]->nnext);
+            k = (int) getfval(z);
+            tempfree(z);
+            u = execute(a[1]->nnext->nnext);  /* handle */
+            if (a[1]->nnext->nnext->nnext) {
+                z = execute(a[1]->nnext->nnext->nnext);
+                canonical = (0 != (int) getfval(z));
+                tempfree(z);
+            }
+            if (k < 1 || k > KMER_MAX_K)
+                WARNING("kmercount: k is %d, must be 1 to %d", k, KMER_MAX_K);
+            else if ((n = kmer_count(getsval(u), getsval(x), k, canonical)) < 0) {
+                WARNING("kmercount: table %s was started with a different k or canonical setting", getsval(u));
+                n = 0;
+            }
+            tempfree(u);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_KMERDUMP) { /* kmerdump(handle, arr|file) -- arr[kmer]=count, or kmer<TAB>count lines to file */
+        long n = 0;
+        if (a[1]->nnext == 0) {
+            WARNING("kmerdump(handle, arr|file) puts the counts from kmercount into arr, or writes them to file. returns number of k-mers.");
+        } else {
+            Cell *ap = execute(a[1]->nnext);
+            FILE *fp;
+            if (isarr(ap) && x->nval != NULL && lookup(x->nval, (Array *) ap->sval) == x) {
+                WARNING("kmerdump: handle can't be an element of arr");
+            } else if (array_arg(a[1]->nnext, ap)) {
+                resetarray(ap, NSYMTAB);
+                n = kmer_dump(getsval(x), kmer_to_array, ap->sval);
+            } else {
+                if ((fp = openfile(GT, getsval(ap))) == NULL)
+                    FATAL("can't redirect to %s", getsval(ap));
+                n = kmer_dump(getsval(x), kmer_to_file, fp);
+                fflush(fp);
+            }
+            tempfree(ap);
+            if (n < 0) {
+                WARNING("kmerdump: no k-mer table named %s", getsval(x));
+                n = 0;
+            }
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_SORTKEYS) { /* sortkeys(arr, out[, how]) -- out[1..n] are the keys of arr in order */
+        long n = 0;
+        if (a[1]->nnext == 0) {
+            WARNING("sortkeys(arr, out[, how]) puts the keys of arr into out[1], out[2], ... sorted as how says: k by key (the default), n by key as a number, v by value as a number, s by value as a string; a trailing r reverses. returns number of keys.");
+        } else {
+            Cell *ap = execute(a[1]->nnext), *hp;
+            int by = 'k', rev = 0;
+            if (a[1]->nnext->nnext != 0) {
+                char *how;
+                hp = execute(a[1]->nnext->nnext);
+                how = getsval(hp);
+                if (*how && strchr("knvs", *how))
+                    by = *how++;
+                rev = *how == 'r';
+                tempfree(hp);
+            }
+            if (ap == x) {
+                WARNING("sortkeys: arr and out must be different arrays");
+            } else {
+                resetarray(ap, NSYMTAB);
+                if (isarr(x))
+                    n = sort_keys((Array *) x->sval, (Array *) ap->sval, by, rev);
+            }
+            tempfree(ap);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_FINDALL) { /* findall(text, needle, pos_arr) -- pos_arr[1..n] are the positions of needle in text */
+        int n = 0;
+        if (a[1]->nnext == 0 || a[1]->nnext->nnext == 0) {
+            WARNING("findall(text, needle, pos_arr) puts the position of each match of needle in text, overlapping ones too, into pos_arr[1], pos_arr[2], ... returns number found.");
+        } else {
+            Cell *u = execute(a[1]->nnext), *ap = execute(a[1]->nnext->nnext);
+            const char *s = getsval(x), *p, *nd = getsval(u);
+            size_t l = getslen(x), nl = getslen(u), *pos = 0;
+            int i, m = 0;
+            Array *tp;
+            if (nl > 0)
+                for (p = s; (p = memfind(p, s + l - p, nd, nl)) != NULL; ++p) {
+                    if (n == m && (pos = (size_t *)realloc(pos, (m = m ? 2 * m : 64) * sizeof(size_t))) == NULL)
+                        FATAL("out of space in findall");
+                    pos[n++] = p - s + 1;
+                }
+            tempfree(u);
+            if (isarr(ap) && x->nval != NULL && lookup(x->nval, (Array *) ap->sval) == x) {
+                WARNING("findall: text can't be an element of pos_arr");
+                n = 0;
+            } else {
+                tp = resetarray(ap, NSYMTAB);
+                for (i = 0; i < n; ++i)
+                    setnumsymtab(i + 1, "", (Awkfloat) pos[i], NUM, tp);
+            }
+            free(pos);
+            tempfree(ap);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_TR) { /* tr(str, from, to[, delete]) -- str with bytes of from changed to those of to, and those of delete removed */
+        if (a[1]->nnext == 0 || a[1]->nnext->nnext == 0) {
+            WARNING("tr(str, from, to[, delete]) returns str with each byte in from changed to the one at the same place in to, and the bytes in delete removed. a-z style ranges are allowed.");
+            copysval(y, x);
+        } else {
+            Cell *u = execute(a[1]->nnext), *v = execute(a[1]->nnext->nnext), *w = 0;
+            const xlate_t *t;
+            size_t n = getslen(x);
+            char *buf;
+            if (a[1]->nnext->nnext->nnext)
+                w = execute(a[1]->nnext->nnext->nnext);
+            t = xlate_get(getsval(u), getsval(v), w ? getsval(w) : "");
+            if (!t->touch.neg && t->touch.nc == 0) /* changes nothing */
+                copysval(y, x);
+            else {
+                buf = stralloc(n);
+                n = xlate_apply(t, getsval(x), n, buf);
+                buf[n] = '\0';
+                takesval(y, buf, n);
+            }
+            tempfree(u);
+            tempfree(v);
+            if (w) {
+                tempfree(w);
+            }
+        }
+    } else if (f == BIO_MD5UPDATE) { /* md5_update(handle, str) -- add str to the md5 named handle */
+        if (a[1]->nnext == 0) {
+            WARNING("md5_update(handle, str) adds str to the md5 being computed under handle; md5_final(handle) returns it. returns number of bytes added so far.");
+            setfval(y, 0.0);
+        } else {
+            z = execute(a[1]->nnext);
+            setfval(y, (Awkfloat) md5_handle_update(getsval(x), getsval(z), getslen(z)));
+            tempfree(z);
+        }
+    } else if (f == BIO_MD5FINAL) { /* md5_final(handle) -- md5 of all the strings given to md5_update for handle */
+        char md5_rslt[33];
+        md5_handle_final(getsval(x), md5_rslt);
+        setsval(y, md5_rslt);
+    } else if (f == BIO_XXH3) { /* xxh3(str) -- 64-bit XXH3 hash of str as 16 hex digits */
+        char buf[17];
+        snprintf(buf, sizeof(buf), "%016llx", (unsigned long long) xxh3_64(getsval(x), getslen(x)));
+        setsval(y, buf);
+    } else if (f == BIO_CRC32C) { /* crc32c(str[, crc]) -- CRC-32C of str, continuing crc if given */
+        uint32_t crc = 0;
+        if (a[1]->nnext) {
+            z = execute(a[1]->nnext);
+            crc = (uint32_t) getfval(z);
+            tempfree(z);
+        }
+        setfval(y, (Awkfloat) crc32c(crc, getsval(x), getslen(x)));
+    } else if (f == BIO_TRANSLATE6 || f == BIO_ORFS) { /* translate6(seq, arr[, table]), orfs(seq, min_len, arr[, table]) */
+        int orfs = f == BIO_ORFS, transtable = 0, c;
+        size_t n, no = 0, i;
+        Node *nd = a[1]->nnext;
+        if (nd == 0 || (orfs && nd->nnext == 0)) {
+            if (orfs)
+                WARNING("orfs(seq, min_len, arr[, table]) puts the ORFs of seq in all six frames, M to stop and at least min_len amino acids, in arr[1..n] as start<TAB>end<TAB>strand<TAB>protein. returns n.");
+            else
+                WARNING("translate6(seq, arr[, table]) puts the translations of seq in frames 1 to 3 in arr[1..3], and of its reverse complement in arr[4..6].");
+        } else {
+            size_t min_len = 0;
+            Cell *ap, *u;
+            char *buf = getsval(x), *unpacked = 0, *frames[6];
+            if (orfs) {
+                u = execute(nd);
+                min_len = getfval(u) > 0 ? (size_t) getfval(u) : 0;
+                tempfree(u);
+                nd = nd->nnext;
+            }
+            ap = execute(nd);
+            if (nd->nnext) {
+                u = execute(nd->nnext);
+                transtable = (int) getfval(u) - 1;
+                tempfree(u);
+            }
+            if (isarr(ap) && x->nval != NULL && lookup(x->nval, (Array *) ap->sval) == x) {
+                WARNING("%s: seq can't be an element of arr", orfs ? "orfs" : "translate6");
+            } else {
+                Array *tp;
+                if (seqpack_is(buf))
+                    buf = unpacked = sequnpack(buf);
+                n = unpacked ? strlen(buf) : getslen(x);
+                for (c = 0; c < 6; ++c)
+                    frames[c] = stralloc(n / 3 + 1);
+                bio_translate6(buf, n, frames, transtable);
+                tp = resetarray(ap, NSYMTAB);
+                if (orfs) {
+                    orf_t *o;
+                    no = bio_orfs(frames, n, min_len, &o);
+                    for (i = 0; i < no; ++i) {
+                        char *s = stralloc(o[i].len + 64);
+                        int k = snprintf(s, 64, "%zu\t%zu\t%c\t", o[i].beg, o[i].end, o[i].strand);
+                        memcpy(s + k, o[i].aa, o[i].len);
+                        s[k + o[i].len] = '\0';
+                        takesval(setnumsymtab(i + 1, "", 0.0, STR, tp), s, k + o[i].len);
+                    }
+                    free(o);
+                    for (c = 0; c < 6; ++c)
+                        strunref(frames[c]);
+                } else {
+                    for (c = 0; c < 6; ++c)
+                        takesval(setnumsymtab(c + 1, "", 0.0, STR, tp), frames[c], strlen(frames[c]));
+                    no = 6;
+                }
+                free(unpacked);
+            }
+            tempfree(ap);
+        }
+        setfval(y, (Awkfloat) no);
+    } else if (f == BIO_ATTR || f == BIO_SAMTAG) { /* attr(str, key[, kind]), samtag(key[, sam_line]) -- one value, no array */
+        Cell *u = NULL, *v = NULL;
+        const char *val, *s, *key;
+        size_t vlen, n;
+        int kind = ATTR_SAM, skip = 0;
+
+        if (f == BIO_ATTR && a[1]->nnext == 0) {
+            WARNING("\tattr(attr_str, key[, \"gff\"|\"gtf\"|\"sam\"])\n");
+            setsval(y, "");
+        } else {
+            if (f == BIO_ATTR) {
+                s = getsval(x);
+                n = getslen(x);
+                u = execute(a[1]->nnext);
+                key = getsval(u);
+                kind = ATTR_GFF;
+                if (a[1]->nnext->nnext) {
+                    char *k;
+                    v = execute(a[1]->nnext->nnext);
+                    k = getsval(v);
+                    if (strcmp(k, "gtf") == 0)
+                        kind = ATTR_GTF;
+                    else if (strcmp(k, "sam") == 0)
+                        kind = ATTR_SAM;
+                    else if (strcmp(k, "gff") != 0)
+                        WARNING("attr: kind %s is not gff, gtf or sam; using gff", k);
+                }
+            } else {
+                extern Cell **fldtab;
+                key = getsval(x);
+                u = a[1]->nnext ? execute(a[1]->nnext) : fldtab[0];
+                s = getsval(u);
+                n = getslen(u);
+            }
+            skip = s == record; /* as in samattr($0): tags follow the 11th tab */
+            if (attr_find(kind, s, n, skip, key, &val, &vlen, NULL)) {
+                setsnval(y, val, vlen);
+                if (is_number(y->sval)) {
+                    y->fval = atof(y->sval);
+                    y->tval |= NUM;
+                }
+            } else
+                setsval(y, "");
+            if (u) {
+                tempfree(u);
+            }
+            if (v) {
+                tempfree(v);
+            }
+        }
+    } else if (f == BIO_CIGAR) { /* cigar(cigar_str, what[, md]) -- a span, clip or count of a CIGAR */
+        const cigar_t *c;
+        Awkfloat r = -1;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tcigar(cigar_str, what[, md])\n");
+        } else {
+            Cell *u = execute(a[1]->nnext), *v;
+            char *what = getsval(u);
+            if ((c = cigar_get(getsval(x))) != NULL) {
+                if (strcmp(what, "mismatch") == 0 && a[1]->nnext->nnext) {
+                    v = execute(a[1]->nnext->nnext);
+                    r = cigar_md_mismatches(getsval(v));
+                    tempfree(v);
+                } else if (cigar_stat(c, what, &r) < 0)
+                    WARNING("cigar: %s is not one of ref query aligned match mismatch ins del skip soft_left soft_right hard_left hard_right clip_left clip_right ops", what);
+            }
+            tempfree(u);
+        }
+        setfval(y, r);
+    } else if (f == BIO_CIGARBLOCKS) { /* cigar_blocks(cigar_str, pos, arr) -- aligned blocks into arr[1..n] */
+        const cigar_t *c;
+        long nb = -1;
+
+        if (a[1]->nnext == 0 || a[1]->nnext->nnext == 0) {
+            WARNING("\tcigar_blocks(cigar_str, pos, arr)\n");
+        } else {
+            Cell *u = execute(a[1]->nnext), *ap;
+            long rpos = (long) getfval(u), qpos = 1, len;
+            char buf[100];
+            size_t i;
+            Array *tp;
+            int op, k;
+
+            tempfree(u);
+            c = cigar_get(getsval(x));
+            ap = execute(a[1]->nnext->nnext);
+            if (isarr(ap) && x->nval != NULL && lookup(x->nval, (Array *) ap->sval) == x) {
+                WARNING("cigar_blocks: cigar_str can't be an element of arr");
+                c = NULL;
+            } else
+                tp = resetarray(ap, NSYMTAB);
+            if (c != NULL) {
+                long rbeg = 0, qbeg = 0;
+                for (i = nb = 0; i <= c->n; ++i) {
+                    op = i < c->n ? CIGAR_OPS[c->ops[i] & 0xf] : 0;
+                    len = i < c->n ? (long)(c->ops[i] >> 4) : 0;
+                    if (op == 'M' || op == '=' || op == 'X') {
+                        if (qbeg == 0)
+                            rbeg = rpos, qbeg = qpos;
+                    } else if (qbeg > 0) { // end of a block
+                        k = snprintf(buf, sizeof(buf), "%ld\t%ld\t%ld\t%ld", rbeg, rpos - 1, qbeg, qpos - 1);
+                        setsnval(setnumsymtab(++nb, "", 0.0, STR, tp), buf, k);
+                        qbeg = 0;
+                    }
+                    if (op && strchr("MDN=X", op))
+                        rpos += len;
+                    if (op && strchr("MIS=X", op))
+                        qpos += len;
+                }
+            }
+            tempfree(ap);
+        }
+        setfval(y, (Awkfloat) nb);
+    } else if (f == BIO_SAMTAGARRAY) { /* samtag_array(key, arr[, sam_line]) -- a tag's values into arr[1..n] */
+        extern Cell **fldtab;
+        long nv = 0;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tsamtag_array(key, arr[, sam_line])\n");
+        } else {
+            Cell *ap = execute(a[1]->nnext), *u = a[1]->nnext->nnext ? execute(a[1]->nnext->nnext) : fldtab[0];
+            const char *val, *s = getsval(u), *key = getsval(x);
+            size_t vlen;
+            char typ;
+
+            if (isarr(ap) && u->nval != NULL && lookup(u->nval, (Array *) ap->sval) == u) {
+                WARNING("samtag_array: sam_line can't be an element of arr");
+            } else {
+                int found = attr_find(ATTR_SAM, s, getslen(u), s == record, key, &val, &vlen, &typ);
+                Array *tp;
+                tp = resetarray(ap, NSYMTAB);
+                if (found)
+                    nv = sam_tag_values(typ, val, vlen, tp);
+            }
+            tempfree(ap);
+            if (u != fldtab[0]) {
+                tempfree(u);
+            }
+        }
+        setfval(y, (Awkfloat) nv);
+    } else if (f == BIO_COVADD) { /* cov_add(handle, chrom, beg, end[, weight]) -- adds to the depth over [beg, end) */
+        static int warned;
+        int r = 0;
+        Node *nd = a[1]->nnext;
+
+        if (nd == 0 || nd->nnext == 0 || nd->nnext->nnext == 0) {
+            WARNING("\tcov_add(handle, chrom, beg, end[, weight])\n");
+        } else {
+            Cell *u = execute(nd), *v = execute(nd->nnext), *w = execute(nd->nnext->nnext), *z = NULL;
+            double weight = 1;
+            if (nd->nnext->nnext->nnext) {
+                z = execute(nd->nnext->nnext->nnext);
+                weight = getfval(z);
+                tempfree(z);
+            }
+            r = cov_add(getsval(x), getsval(u), (long) getfval(v), (long) getfval(w), weight) == 0;
+            if (!r && !warned++)
+                WARNING("cov_add: %s:%ld is before coverage cov_emit has written; input must be sorted by position", getsval(u), (long) getfval(v));
+            tempfree(u);
+            tempfree(v);
+            tempfree(w);
+        }
+        setfval(y, (Awkfloat) r);
+    } else if (f == BIO_COVEMIT) { /* cov_emit(handle, file[, min_depth]) -- writes the depth as bedGraph */
+        long n = 0;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tcov_emit(handle, file[, min_depth])\n");
+        } else {
+            Cell *u = execute(a[1]->nnext), *v;
+            double min_depth = 0;
+            if (a[1]->nnext->nnext) {
+                v = execute(a[1]->nnext->nnext);
+                min_depth = getfval(v);
+                tempfree(v);
+            }
+            n = cov_emit(getsval(x), getsval(u), min_depth, cov_to_file);
+            tempfree(u);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_IVLLOAD) { /* ivl_load(handle, file_or_arr[, fmt]) -- adds features to an interval index */
+        long n = -1;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tivl_load(handle, file_or_arr[, \"bed\"|\"gff\"])\n");
+        } else {
+            Cell *ap = execute(a[1]->nnext), *u = NULL;
+            ivl_cols_t cols;
+            const char *fmt = "bed";
+            if (a[1]->nnext->nnext) {
+                u = execute(a[1]->nnext->nnext);
+                fmt = getsval(u);
+            }
+            if (!ivl_fmt_cols(fmt, &cols)) {
+                WARNING("ivl_load: %s has no chrom, start and end columns", fmt);
+            } else if (isarr(ap)) {
+                Array *tp = (Array *) ap->sval;
+                Cell **c = (Cell **) malloc((tp->nelem + 1) * sizeof(Cell *));
+                size_t i, nc;
+                if (c == NULL)
+                    FATAL("out of space in ivl_load");
+                nc = arraycells(tp, c);
+                for (i = 0, n = 0; i < nc; ++i)
+                    n += ivl_add_line(getsval(x), getsval(c[i]), getslen(c[i]), &cols);
+                free(c);
+            } else if ((n = ivl_load_file(getsval(x), getsval(ap), &cols)) < 0)
+                WARNING("ivl_load: can't read %s", getsval(ap));
+            if (u) {
+                tempfree(u);
+            }
+            tempfree(ap);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_IVLOVERLAP) { /* ivl_overlap(handle, chrom, beg, end[, arr]) -- the features overlapping [beg, end) */
+        long n = -1;
+        Node *nd = a[1]->nnext;
+
+        if (nd == 0 || nd->nnext == 0 || nd->nnext->nnext == 0) {
+            WARNING("\tivl_overlap(handle, chrom, beg, end[, arr])\n");
+        } else {
+            Cell *u = execute(nd), *v = execute(nd->nnext), *w = execute(nd->nnext->nnext), *ap = NULL;
+            long beg = (long) getfval(v), end = (long) getfval(w);
+            line_out_t o = { NULL, 0 };
+            if (nd->nnext->nnext->nnext) {
+                ap = execute(nd->nnext->nnext->nnext);
+                if (isarr(ap) && u->nval != NULL && lookup(u->nval, (Array *) ap->sval) == u) {
+                    WARNING("ivl_overlap: chrom can't be an element of arr");
+                    ap = NULL;
+                } else {
+                    o.tp = resetarray(ap, NSYMTAB);
+                }
+            }
+            if (ap || !nd->nnext->nnext->nnext)
+                n = ivl_overlap(getsval(x), getsval(u), beg, end, ap ? line_to_array : NULL, &o);
+            tempfree(u);
+            tempfree(v);
+            tempfree(w);
+            if (ap) {
+                tempfree(ap);
+            }
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_JOINOPEN) { /* join_open(handle, file, keycol[, fmt]) -- opens a file to merge join with the input */
+        int ret = -1;
+        Node *nd = a[1]->nnext;
+
+        if (nd == 0 || nd->nnext == 0) {
+            WARNING("\tjoin_open(handle, file, keycol[, fmt])\n");
+        } else {
+            Cell *u = execute(nd), *v = execute(nd->nnext), *w = NULL;
+            const char *fmt = bio_fmt == BIO_NULL ? "" : col_defs[bio_fmt][0];
+            join_fmt_t jf;
+            if (nd->nnext->nnext) {
+                w = execute(nd->nnext->nnext);
+                fmt = getsval(w);
+            }
+            if (!join_fmt(fmt, &jf))
+                WARNING("join_open: no format %s", fmt);
+            else if ((ret = join_open(getsval(x), getsval(u), getsval(v), &jf)) == -1)
+                WARNING("join_open: can't read %s", getsval(u));
+            else if (ret == -2)
+                WARNING("join_open: no column %s in %s", getsval(v), getsval(u));
+            ret = ret == 0 ? 1 : -1;
+            tempfree(u);
+            tempfree(v);
+            if (w) {
+                tempfree(w);
+            }
+        }
+        setfval(y, (Awkfloat) ret);
+    } else if (f == BIO_JOINNEXT) { /* join_next(handle, key[, arr]) -- the records of a joined file with key */
+        long n = -1;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tjoin_next(handle, key[, arr])\n");
+        } else {
+            Cell *u = execute(a[1]->nnext), *ap = NULL;
+            line_out_t o = { NULL, 0 };
+            if (a[1]->nnext->nnext) {
+                ap = execute(a[1]->nnext->nnext);
+                if (isarr(ap) && u->nval != NULL && lookup(u->nval, (Array *) ap->sval) == u) {
+                    WARNING("join_next: key can't be an element of arr");
+                    ap = NULL;
+                } else {
+                    o.tp = resetarray(ap, NSYMTAB);
+                }
+            }
+            if (ap || !a[1]->nnext->nnext) {
+                n = join_next(getsval(x), getsval(u), *SUBSEP, ap ? line_to_array : NULL, &o);
+                if (n == -2) {
+                    WARNING("join_next: %s comes before the last key; are the inputs sorted the same way?", getsval(u));
+                    n = 0;
+                }
+            }
+            tempfree(u);
+            if (ap) {
+                tempfree(ap);
+            }
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_LOADTABLE) { /* load_table(file, arr, keycol, valcol[, fs]) -- arr[$keycol] = $valcol for each line of file */
+        long n = -1;
+        Node *nd = a[1]->nnext;
+
+        if (nd == 0 || nd->nnext == 0 || nd->nnext->nnext == 0) {
+            WARNING("\tload_table(file, arr, keycol, valcol[, fs])\n");
+        } else {
+            Cell *ap = execute(nd), *u = execute(nd->nnext), *v = execute(nd->nnext->nnext), *w = NULL;
+            int keycol = (int) getfval(u), valcol = (int) getfval(v);
+            const char *fs = "\t";
+            table_out_t o = { NULL, NULL, 0 };
+            if (nd->nnext->nnext->nnext) {
+                w = execute(nd->nnext->nnext->nnext);
+                fs = getsval(w);
+            }
+            if (keycol < 0 || valcol < 0 || strlen(fs) != 1) {
+                WARNING("load_table: keycol and valcol are column numbers, 0 for the line, and fs one character");
+            } else if (isarr(ap) && x->nval != NULL && lookup(x->nval, (Array *) ap->sval) == x) {
+                WARNING("load_table: file can't be an element of arr");
+            } else {
+                o.tp = resetarray(ap, NSYMTAB);
+                if (table_read(getsval(x), *fs, keycol, valcol, table_to_array, &o) < 0)
+                    WARNING("load_table: can't read %s", getsval(x));
+                else
+                    n = o.tp->nelem;
+                free(o.buf);
+            }
+            tempfree(ap);
+            tempfree(u);
+            tempfree(v);
+            if (w) {
+                tempfree(w);
+            }
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_ARRAYSAVE) { /* array_save(arr, file) -- writes arr to file as a binary snapshot */
+        long n = -1;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tarray_save(arr, file)\n");
+        } else {
+            Cell *u = execute(a[1]->nnext);
+            if (!isarr(x)) {
+                WARNING("array_save: not an array");
+            } else {
+                Array *tp = (Array *) x->sval;
+                Cell **c = (Cell **) malloc((tp->nelem + 1) * sizeof(Cell *));
+                size_t nc;
+                if (c == NULL)
+                    FATAL("out of space in array_save");
+                nc = arraycells(tp, c);
+                if ((n = snap_save(getsval(u), nc, snap_get_cell, c)) < 0)
+                    WARNING("array_save: can't write %s", getsval(u));
+                free(c);
+            }
+            tempfree(u);
+        }
+        setfval(y, (Awkfloat) n);
+    } else if (f == BIO_ARRAYLOAD) { /* array_load(arr, file) -- arr as saved by array_save() */
+        long n = -1;
+
+        if (a[1]->nnext == 0) {
+            WARNING("\tarray_load(arr, file)\n");
+        } else {
+            Cell *u = execute(a[1]->nnext);
+            snap_t *s;
+            snap_item_t it;
+            size_t ns;
+            Array *tp;
+            int r;
+            if (isarr(x) && u->nval != NULL && lookup(u->nval, (Array *) x->sval) == u) {
+                WARNING("array_load: file can't be an element of arr");
+            } else if ((s = snap_open(getsval(u), &ns)) == NULL) {
+                WARNING("array_load: can't read %s as an array_save() file", getsval(u));
+            } else {
+                tp = resetarray(x, ns / 2 > NSYMTAB ? ns / 2 : NSYMTAB); /* big enough not to rehash */
+                while ((r = snap_next(s, &it)) > 0)
+                    setsymtab(it.key, it.val, it.f, it.t == 0 ? STR|NUM : (it.t & SNAP_NUM ? NUM : 0) | (it.t & SNAP_STR ? STR : 0), tp);
+                if (r < 0)
+                    WARNING("array_load: %s is damaged after %d elements", getsval(u), tp->nelem);
+                n = tp->nelem;
+                snap_close(s);
+            }
+            tempfree(u);
+        }
+        setfval(y, (Awkfloat) n);
     } /* else: never happens */
     return y;
 }
@@ -1066,12 +2198,21 @@ Cell *bio_func(int f, Cell *x, Node **a)
 
 #include <zlib.h> /* FIXME: it would be better to drop this dependency... */
 #include "kseq.h"
-KSEQ_INIT2(, gzFile, gzread)
+
+static thrin_t *g_thrin; /* with -P, decompresses the current file ahead of kseq */
+
+static int bio_gzread(gzFile fp, void *buf, unsigned len)
+{
+    return g_thrin ? thrin_read(g_thrin, buf, len) : gzread(fp, buf, len);
+}
+
+KSEQ_INIT2(, gzFile, bio_gzread)
 
 static gzFile g_fp;
 static kseq_t *g_kseq;
 static int g_firsttime = 1, g_is_stdin = 0;
 static kstring_t g_str;
+static fxpar_t *g_par; /* set instead of g_kseq when reading with -j threads */
 
 int bio_getrec(char **pbuf, int *psize, int isrecord)
 {
@@ -1081,6 +2222,7 @@ int bio_getrec(char **pbuf, int *psize, int isrecord)
     extern Cell **fldtab;
 
     int i, c, saveb0, dret, bufsize = *psize, savesize = *psize;
+    size_t len;
     char *p, *buf = *pbuf;
     if (g_firsttime) { /* mimicking initgetrec() in lib.c */
         g_firsttime = 0;
@@ -1100,6 +2242,7 @@ int bio_getrec(char **pbuf, int *psize, int isrecord)
         }
         g_fp = gzdopen(fileno(stdin), "r"); /* no filenames, so use stdin */
         g_kseq = kseq_init(g_fp);
+        if (bio_flag & BIO_PIPELINE) g_thrin = thrin_open(g_fp);
         g_is_stdin = 1;
     }
 
@@ -1111,7 +2254,7 @@ getrec_start:
     saveb0 = buf[0];
     buf[0] = 0; /* this is effective at the end of file */
     while (argno < *ARGC || g_is_stdin) {
-        if (g_kseq == 0) { /* have to open a new file */
+        if (g_kseq == 0 && g_par == 0) { /* have to open a new file */
             file = getargv(argno);
             if (file == NULL || *file == '\0') { /* deleted or zapped */
                 argno++;
@@ -1123,20 +2266,39 @@ getrec_start:
                 continue;
             }
             *FILENAME = file;
+            filenameloc->tval &= ~(SLEN|SREF|SGROW);	/* not set by setsval */
+            filenameloc->tval |= DONTFREE;
             if (*file == '-' && *(file+1) == '\0') {
                 g_fp = gzdopen(fileno(stdin), "r");
                 g_kseq = kseq_init(g_fp);
+                if (bio_flag & BIO_PIPELINE) g_thrin = thrin_open(g_fp);
                 g_is_stdin = 1;
+            } else if (bio_fmt == BIO_FASTX && bio_nthreads > 1 && (g_par = fxpar_open(file, bio_nthreads)) != 0) {
+                g_is_stdin = 0;
             } else {
                 if ((g_fp = gzopen(file, "r")) == NULL)
                     FATAL("can't open file %s", file);
                 g_kseq = kseq_init(g_fp);
+                if (bio_flag & BIO_PIPELINE) g_thrin = thrin_open(g_fp);
                 g_is_stdin = 0;
             }
             setfval(fnrloc, 0.0);
             setfval(filenumloc, filenumloc->fval + 1); /* 26Sep2022 count files */
         }
-        if (bio_fmt != BIO_FASTX) {
+        if (g_par) {
+            if ((c = fxpar_next(g_par, &p, &len)) >= 0) {
+                if (g_str.m < len + 1) {
+                    g_str.m = len + 1;
+                    kroundup32(g_str.m);
+                    g_str.s = (char*)realloc(g_str.s, g_str.m);
+                }
+                memcpy(g_str.s, p, len + 1);
+                g_str.l = len;
+            } else {
+                g_str.l = 0;
+                if (g_str.s) g_str.s[0] = '\0';
+            }
+        } else if (bio_fmt != BIO_FASTX) {
             c = ks_getuntil(g_kseq->f, **RS, &g_str, &dret);
         } else {
             c = kseq_read(g_kseq);
@@ -1156,7 +2318,7 @@ getrec_start:
                 g_str.s[g_str.l++] = '\t';
                 for (i = 0; i < g_kseq->comment.l; ++i)
                     g_str.s[g_str.l++] = g_kseq->comment.s[i];
-                g_str.s[g_str.l++] = '\0';
+                g_str.s[g_str.l] = '\0';
             } else {
                 g_str.l = 0;
                 if (g_str.s) g_str.s[0] = '\0';
@@ -1168,10 +2330,10 @@ getrec_start:
         }
         if (c >= 0) {	/* normal record */
             if (isrecord) {
-                if (freeable(fldtab[0]))
-                    xfree(fldtab[0]->sval);
+                freesval(fldtab[0]);
                 fldtab[0]->sval = buf;	/* buf == record */
-                fldtab[0]->tval = REC | STR | DONTFREE;
+                fldtab[0]->slen = g_str.l;
+                fldtab[0]->tval = REC | STR | DONTFREE | SLEN;
                 if (is_number(fldtab[0]->sval)) {
                     fldtab[0]->fval = atof(fldtab[0]->sval);
                     fldtab[0]->tval |= NUM;
@@ -1184,7 +2346,14 @@ getrec_start:
             return 1;
         }
         /* EOF arrived on this file; set up next */
-        if (!g_is_stdin) {
+        if (g_thrin) {
+            thrin_close(g_thrin);
+            g_thrin = 0;
+        }
+        if (g_par) {
+            fxpar_close(g_par);
+            g_par = 0;
+        } else if (!g_is_stdin) {
             kseq_destroy(g_kseq);
             gzclose(g_fp);
         }
@@ -11,8 +11,9 @@
 #define BIO_FASTX 5
 
 #define BIO_SHOW_HDR 0x1
+#define BIO_PIPELINE 0x2 /* -P: reader and writer threads */
 
-extern int bio_fmt, bio_flag;
+extern int bio_fmt, bio_flag, bio_nthreads;
 extern char *bio_hdr_chr;
 
 int bio_get_fmt(const char *s);
@@ -56,6 +57,33 @@ int bio_getrec(char **pbuf, int *psize, int isrecord);
 #define BIO_SAMATTR   219 /* get sam format tags in format [A-Za-z][A-Za-z0-9]:[AifZHB]:[^\t]*/
 #define BIO_FLDCAT    220 /* concatenate columns using variant of range syntax, e.g. "2,4..NF" */
 #define BIO_CODONSFIND  221 /* find all codon equivs from an AA pattern in an input string */
+#define BIO_SEQPACK   222 /* seqpack(seq) packs an ACGTN string 2 bases a byte, see seqpack.h */
+#define BIO_SEQUNPACK 223 /* sequnpack(packed) undoes seqpack() */
+#define BIO_KMERCOUNT 224 /* kmercount(seq, k, handle[, canonical]) counts 2-bit encoded k-mers in a hash table */
+#define BIO_KMERDUMP  225 /* kmerdump(handle, arr|file) exports the kmercount table */
+#define BIO_SORTKEYS  226 /* sortkeys(arr, out[, how]) radix sorts the keys of arr into out[1..n] */
+#define BIO_FINDALL   227 /* findall(text, needle, pos_arr) puts every match position of needle into pos_arr[1..n] */
+#define BIO_TR        228 /* tr(str, from, to[, delete]) maps and deletes bytes through a cached table */
+#define BIO_MD5UPDATE 229 /* md5_update(handle, str) adds str to a streaming md5 */
+#define BIO_MD5FINAL  230 /* md5_final(handle) returns the md5 of what md5_update added for handle */
+#define BIO_XXH3      231 /* xxh3(str) returns the 64-bit XXH3 hash of str in hex */
+#define BIO_CRC32C    232 /* crc32c(str[, crc]) returns the CRC-32C of str */
+#define BIO_TRANSLATE6 233 /* translate6(seq, arr[, table]) translates all six frames in one pass */
+#define BIO_ORFS      234 /* orfs(seq, min_len, arr[, table]) finds M..stop ORFs in all six frames */
+#define BIO_ATTR      235 /* attr(str, key[, kind]) returns one gff/gtf/sam attribute without building an array */
+#define BIO_SAMTAG    236 /* samtag(key[, sam_line]) returns one sam tag of $0 */
+#define BIO_CIGAR     237 /* cigar(cigar_str, what[, md]) returns a span, clip or count of a CIGAR */
+#define BIO_CIGARBLOCKS 238 /* cigar_blocks(cigar_str, pos, arr) puts the aligned blocks of a CIGAR in arr[1..n] */
+#define BIO_SAMTAGARRAY 239 /* samtag_array(key, arr[, sam_line]) puts the values of a tag, each number of a B array, in arr[1..n] */
+#define BIO_COVADD    240 /* cov_add(handle, chrom, beg, end[, weight]) adds to the depth of coverage kept under handle */
+#define BIO_COVEMIT   241 /* cov_emit(handle, file[, min_depth]) writes the depth under handle as bedGraph */
+#define BIO_IVLLOAD   242 /* ivl_load(handle, file_or_arr[, fmt]) adds bed or gff features to an interval index */
+#define BIO_IVLOVERLAP 243 /* ivl_overlap(handle, chrom, beg, end[, arr]) puts the features overlapping [beg, end) in arr[1..n] */
+#define BIO_JOINOPEN   244 /* join_open(handle, file, keycol[, fmt]) opens a key sorted file to merge join with the input */
+#define BIO_JOINNEXT   245 /* join_next(handle, key[, arr]) puts the records of the joined file with that key in arr[1..n] */
+#define BIO_LOADTABLE  246 /* load_table(file, arr, keycol, valcol[, fs]) sets arr[$keycol] = $valcol for each line of file */
+#define BIO_ARRAYSAVE  247 /* array_save(arr, file) writes arr to file as a binary snapshot */
+#define BIO_ARRAYLOAD  248 /* array_load(arr, file) makes arr what array_save() wrote to file */
 
 struct Cell;
 struct Node;
@@ -0,0 +1,149 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "attr.h"
+
+/* A string is split once into offsets of its keys and values. The copy of
+ * the string kept with them is how a later call knows it has the same
+ * record: comparing a few hundred bytes is far cheaper than splitting
+ * again, and it cannot be fooled by a buffer being reused. */
+
+typedef struct {
+    size_t key, klen, val, vlen; /* offsets into the string */
+    char typ;                    /* SAM tag type */
+} attr_ent_t;
+
+typedef struct {
+    char *s;            /* copy of the string split */
+    size_t n, size;
+    int skip, valid;
+    attr_ent_t *e;
+    size_t ne, me;
+} attr_memo_t;
+
+static attr_memo_t g_memo[3]; /* one for each kind */
+
+static void *attr_realloc(void *p, size_t n)
+{
+    if ((p = realloc(p, n)) == NULL) {
+        fprintf(stderr, "attr: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static void add(attr_memo_t *m, const char *s, const char *key, const char *kt, const char *v, const char *vt, char typ)
+{
+    attr_ent_t *e;
+
+    if (m->ne == m->me) {
+        m->me = m->me ? m->me * 2 : 16;
+        m->e = (attr_ent_t *) attr_realloc(m->e, m->me * sizeof(attr_ent_t));
+    }
+    e = &m->e[m->ne++];
+    e->key = key - s, e->klen = kt - key;
+    e->val = v - s, e->vlen = vt - v;
+    e->typ = typ;
+}
+
+/* the rules of bio_attribute(): fields end at ';' outside quotes or a
+ * newline, the key ends at the first sep2, and spaces around both are
+ * trimmed */
+static void split_gff(attr_memo_t *m, const char *s, size_t n, char sep2, int unquote)
+{
+    const char *p = s, *end = s + n, *key, *eq, *kt, *v, *vt;
+    int inquote;
+
+    if (n > 0 && *p == '.' && (n == 1 || isspace((unsigned char)p[1]))) // empty field can be a dot
+        return;
+    for (; p < end; ++p) {
+        if (*p == ';' || *p == sep2 || *p == ' ' || *p == '\n')
+            continue;
+        key = p, eq = NULL, inquote = 0;
+        for (; p < end && (*p != ';' || inquote) && *p != '\n'; ++p) {
+            if (*p == sep2 && eq == NULL)
+                eq = p;
+            else if (*p == '"')
+                inquote = !inquote;
+        }
+        if (eq != NULL) {
+            for (kt = eq; kt - 1 > key && kt[-1] == ' '; --kt)
+                ;
+            for (v = eq + 1; *v == ' '; ++v) // stops at p at the latest
+                ;
+            for (vt = p; vt - 1 > v && vt[-1] == ' '; --vt)
+                ;
+            if (unquote && *v == '"') {
+                ++v;
+                if (vt > v && vt[-1] == '"')
+                    --vt;
+            }
+            add(m, s, key, kt, v, vt, 0);
+        }
+        if (p == end)
+            break;
+    }
+}
+
+/* the rules of sam_attribute(): a tag is [A-Za-z][A-Za-z0-9]:[ZifAHB]: at
+ * the start or after white space, and its value runs to the next tab */
+static void split_sam(attr_memo_t *m, const char *s, size_t n, int skip)
+{
+    const char *end = s + n, *c, *t, *v, *vt;
+    size_t i = 0;
+    int tabs;
+
+    if (skip) { // past the 11 mandatory fields
+        for (tabs = 11, c = s; tabs > 0 && c + 1 < end; --tabs) {
+            if ((c = (const char *) memchr(c + 1, '\t', end - c - 1)) == NULL)
+                return;
+        }
+        i = tabs > 0 ? n : (size_t)(c - s) + 1;
+    }
+    for (i += 2; i < n && (c = (const char *) memchr(s + i, ':', n - i)) != NULL; ) {
+        t = c - 2;
+        if (isalpha((unsigned char)t[0]) && isalnum((unsigned char)t[1]) && (t == s || isspace((unsigned char)t[-1]))
+                && end - c > 2 && c[1] != '\0' && strchr("ZifAHB", c[1]) != NULL && c[2] == ':') {
+            v = c + 3;
+            if ((vt = (const char *) memchr(v, '\t', end - v)) == NULL)
+                vt = end;
+            add(m, s, t, c, v, vt, c[1]);
+            i = vt - s + 1;
+        } else
+            i = c - s + 1;
+    }
+}
+
+int attr_find(int kind, const char *s, size_t n, int skip, const char *key, const char **val, size_t *vlen, char *typ)
+{
+    attr_memo_t *m = &g_memo[kind];
+    size_t klen = strlen(key), j;
+    attr_ent_t *e;
+
+    skip = kind == ATTR_SAM && skip;
+    if (!m->valid || m->n != n || m->skip != skip || memcmp(m->s, s, n) != 0) {
+        if (n + 1 > m->size) {
+            m->size = n + 1;
+            m->s = (char *) attr_realloc(m->s, m->size);
+        }
+        memcpy(m->s, s, n);
+        m->s[n] = '\0';
+        m->n = n, m->skip = skip, m->ne = 0;
+        if (kind == ATTR_SAM)
+            split_sam(m, m->s, n, skip);
+        else
+            split_gff(m, m->s, n, kind == ATTR_GTF ? ' ' : '=', kind == ATTR_GTF);
+        m->valid = 1;
+    }
+    for (j = 0; j < m->ne; ++j) { // the first one wins, as setsymtab() keeps it in the arrays
+        e = &m->e[j];
+        if (e->klen == klen && memcmp(m->s + e->key, key, klen) == 0) {
+            *val = s + e->val;
+            *vlen = e->vlen;
+            if (typ) *typ = e->typ;
+            return 1;
+        }
+    }
+    return 0;
+}
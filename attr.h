@@ -0,0 +1,22 @@
+#ifndef ATTR_H
+#define ATTR_H
+
+#include <stddef.h>
+
+/* Single key lookup for attr() and samtag(). A string is split into its
+ * (key, value) pairs by the same rules gffattr(), gtfattr() and samattr()
+ * use, without building an array. The split of the last string seen for
+ * each kind is kept, so looking up several keys of one record parses it
+ * once. */
+
+#define ATTR_GFF 0 /* key=value; ... */
+#define ATTR_GTF 1 /* key "value"; ..., the quotes removed */
+#define ATTR_SAM 2 /* tab separated TG:t:value */
+
+/* Finds the first key in s[0..n) and points *val at its value of *vlen
+ * bytes, which is inside s; for ATTR_SAM *typ gets the type char if typ
+ * is not NULL. skip drops the first 11 tab separated fields of a SAM
+ * line. Returns 0 if key is not there. */
+int attr_find(int kind, const char *s, size_t n, int skip, const char *key, const char **val, size_t *vlen, char *typ);
+
+#endif
@@ -79,20 +79,27 @@ extern	int	patlen;		/* length of pattern matched.  set in b.c */
 
 /* Cell:  all information about a variable or constant */
 
+#define	NSBUF	16	/* strings shorter than this are kept in the Cell */
+
 typedef struct Cell {
 	uschar	ctype;		/* OCELL, OBOOL, OJUMP, etc. */
 	uschar	csub;		/* CCON, CTEMP, CFLD, etc. */
+	int	 tval;		/* type info: STR|NUM|ARR|FCN|FLD|CON|DONTFREE */
 	char	*nval;		/* name, for variables only */
 	char	*sval;		/* string value */
 	Awkfloat fval;		/* value as number */
-	int	 tval;		/* type info: STR|NUM|ARR|FCN|FLD|CON|DONTFREE */
 	struct Cell *cnext;	/* ptr to next if chained */
+	size_t	slen;		/* strlen(sval), valid if tval has SLEN */
+	char	sbuf[NSBUF];	/* sval points here for a short string */
 } Cell;
 
 typedef struct Array {		/* symbol table array */
 	int	nelem;		/* elements in table right now */
 	int	size;		/* size of tab */
 	Cell	**tab;		/* hash table pointers */
+	int	ndense;		/* keys are in "1".."ndense", in dense[]; -1 once hashed */
+	int	dsize;		/* size of dense */
+	Cell	**dense;	/* dense[k-1] is element "k", NULL if deleted */
 } Array;
 
 #define	NSYMTAB	50	/* initial size of a symbol table */
@@ -104,6 +111,7 @@ extern Cell	*nfloc;		/* NF */
 extern Cell	*rstartloc;	/* RSTART */
 extern Cell	*rlengthloc;	/* RLENGTH */
 extern Cell	*filenumloc;   /* FILENUM 26Sep2022 */
+extern Cell	*filenameloc;	/* FILENAME */
 
 /* Cell.tval values: */
 #define	NUM	01	/* number value is valid */
@@ -114,6 +122,9 @@ extern Cell	*filenumloc;   /* FILENUM 26Sep2022 */
 #define	FCN	040	/* this is a function name */
 #define FLD	0100	/* this is a field $1, $2, ... */
 #define	REC	0200	/* this is $0 */
+#define	SLEN	0400	/* slen is the length of sval */
+#define	SGROW	01000	/* sval has room for strcap(slen+1) bytes; needs SLEN */
+#define	SREF	02000	/* sval is a refcounted buffer from stralloc() */
 
 
 /* function types */
@@ -203,6 +214,7 @@ extern	int	pairstack[], paircnt;
 #define	isargument(n)	((n)->nobj == ARG)
 /* #define freeable(p)	(!((p)->tval & DONTFREE)) */
 #define freeable(p)	( ((p)->tval & (STR|DONTFREE)) == STR )
+#define	freesval(p)	{ if (freeable(p)) { freestr((p)->sval, (p)->tval); (p)->sval = NULL; } }
 
 /* structures used by regular expression matching machinery, mostly b.c: */
 
@@ -231,8 +243,16 @@ typedef struct fa {
 	int	curstat;
 	int	accept;
 	int	reset;
+	int	simple;		/* RESET etc. if matches can be found without the dfa */
+	char	*slit;		/* the string for RESTR */
+	size_t	slitlen;
+	struct byteset *sset;	/* the bytes for RESET and RERUN */
 	struct	rrow re[1];	/* variable: actual size set by calling malloc */
 } fa;
 
+#define	RESET	1	/* a reg expr matching one byte of a set */
+#define	RERUN	2	/* one or more bytes of a set, e.g. N+ */
+#define	RESTR	3	/* a literal string of 2 or more bytes */
+
 
 #include "proto.h"
@@ -32,6 +32,7 @@ THIS SOFTWARE.
 #include <stdlib.h>
 #include "awk.h"
 #include "ytab.h"
+#include "memfind.h"
 
 #define	HAT	(NCHARS+2)	/* matches ^ in regular expr */
 				/* NCHARS is 2**n */
@@ -135,6 +136,7 @@ fa *mkdfa(const char *s, int anchor)	/* does the real work of making a dfa */
 	if ((f = (fa *) calloc(1, sizeof(fa) + poscnt*sizeof(rrow))) == NULL)
 		overflo("out of space for fa");
 	f->accept = poscnt-1;	/* penter has computed number of positions in re */
+	simplere(f, p);
 	cfoll(f, p1);	/* set up follow sets */
 	freetr(p1);
 	if ((f->posns[0] = (int *) calloc(1, *(f->re[0].lfollow)*sizeof(int))) == NULL)
@@ -148,6 +150,85 @@ fa *mkdfa(const char *s, int anchor)	/* does the real work of making a dfa */
 	return f;
 }
 
+static int addset(Node *p, uschar *in)	/* is p one byte of a set?  add it to in */
+{
+	int c;
+	uschar *s;
+
+	switch (type(p)) {
+	case CHAR:
+		if ((c = ptoi(right(p))) == 0 || c == HAT)
+			return 0;
+		in[c] = 1;
+		return 1;
+	case CCL:
+		if (*(uschar *) right(p) == 0)
+			return 0;	/* () */
+		for (s = (uschar *) right(p); *s; s++)
+			in[*s] = 1;
+		return 1;
+	case NCCL:
+		for (c = 1; c < 256; c++)
+			if (strchr((char *) right(p), c) == NULL)
+				in[c] = 1;
+		return 1;
+	case DOT:
+		memset(in + 1, 1, 255);
+		return 1;
+	case OR:
+		return addset(left(p), in) && addset(right(p), in);
+	default:
+		return 0;
+	}
+}
+
+static int reset(Node *p, byteset_t *b)
+{
+	memset(b->in, 0, sizeof(b->in));
+	if (!addset(p, b->in))
+		return 0;
+	byteset_prep(b);
+	return 1;
+}
+
+static int restr(Node *p, char *buf, size_t *n)	/* is p a string of CHARs?  put it in buf */
+{
+	int c;
+
+	if (type(p) == CAT)
+		return restr(left(p), buf, n) && restr(right(p), buf, n);
+	if (type(p) != CHAR || (c = ptoi(right(p))) == 0 || c == HAT)
+		return 0;
+	buf[(*n)++] = c;
+	return 1;
+}
+
+/* note reg exprs whose matches sub() and gsub() can find with a scan of
+ * the bytes: a byte out of a set, a run of them, or a literal string */
+void simplere(fa *f, Node *p)
+{
+	byteset_t b;
+	size_t n = 0;
+
+	f->simple = 0;
+	if (reset(p, &b))
+		f->simple = RESET;
+	else if (type(p) == PLUS && reset(left(p), &b))
+		f->simple = RERUN;
+	else if ((f->slit = (char *) malloc(poscnt)) != NULL && restr(p, f->slit, &n))
+		f->simple = RESTR;
+	if (f->simple == RESTR)
+		f->slitlen = n;
+	else {
+		xfree(f->slit);
+		if (f->simple != 0) {
+			if ((f->sset = (byteset_t *) malloc(sizeof(byteset_t))) == NULL)
+				overflo("out of space in simplere");
+			*f->sset = b;
+		}
+	}
+}
+
 int makeinit(fa *f, int anchor)
 {
 	int i, k;
@@ -954,5 +1035,7 @@ void freefa(fa *f)	/* free a finite automaton */
 			xfree((f->re[i].lval.np));
 	}
 	xfree(f->restr);
+	xfree(f->slit);
+	xfree(f->sset);
 	xfree(f);
 }
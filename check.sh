@@ -0,0 +1,200 @@
+#!/bin/bash
+# Checks of bioawk builtins against known answers: ./check.sh [bioawk]
+B=${1:-./bioawk}
+fail=0
+
+check() { # name expected actual
+    if [ "$2" == "$3" ]; then
+        echo "ok   $1"
+    else
+        echo "FAIL $1"
+        echo "  expected: $2"
+        echo "  got:      $3"
+        fail=1
+    fi
+}
+
+# samtag_array: B arrays of each kind, and a plain tag
+check "samtag_array B:C" "2 1 2" \
+    "$($B 'BEGIN { s = "ML:B:C,1,2"; n = samtag_array("ML", b, s); print n, b[1], b[2] }')"
+check "samtag_array B:f" "3 -0.5 abc" \
+    "$($B 'BEGIN { s = "r\t0\tML:B:f,1.5,-2,abc"; n = samtag_array("ML", b, s); print n, b[1] + b[2], b[3] }')"
+check "samtag_array \$0" "4 10 1" \
+    "$(printf 'r\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\tMM:Z:C+m,5\tML:B:c,1,2,3,4\tNM:i:1\n' | $B -c sam '{ n = samtag_array("ML", b); m = samtag_array("NM", c); print n " " b[1] + b[2] + b[3] + b[4] " " c[1] }')"
+
+# ivl_overlap against a scan of every feature, on contigs of 1 to 399
+# features so that every shape of the implicit tree's right edge is seen
+check "ivl_overlap vs brute force" "3800 queries, 0 wrong" "$($B 'BEGIN {
+    srand(7); bad = 0; nq = 0
+    for (n = 1; n < 400; n += (n < 70 ? 1 : 13)) {
+        c = "c" n; delete B; delete E
+        for (i = 1; i <= n; i++) {
+            B[i] = int(rand() * 2000); E[i] = B[i] + 1 + int(rand() * (rand() < 0.1 ? 1500 : 60))
+            L[1] = c "\t" B[i] "\t" E[i]; ivl_load("s", L)
+        }
+        for (q = 0; q < 40; q++) {
+            qb = int(rand() * 2100); qe = qb + 1 + int(rand() * 80); want = 0
+            for (i = 1; i <= n; i++) if (B[i] < qe && qb < E[i]) want++
+            nq++; if (ivl_overlap("s", c, qb, qe) != want) bad++
+        }
+    }
+    print nq " queries, " bad " wrong" }')"
+
+# join_next() matches only equal bytes, in sort order or with :n in sort -n order
+T=${TMPDIR:-/tmp}/check.$$.tsv
+printf '1\ta\n10\tb\n100\tc\n11\td\n2\te\n' > $T
+check "join_next bytewise" "1a 10b 100c 11d 2e 0 0" "$(printf '1\n10\n100\n11\n2\n' | $B 'BEGIN {
+    join_open("t", "'$T'", 1, "") } { join_next("t", $1, r); split(r[1], f, "\t"); s = s f[1] f[2] " " }
+    END { join_open("t", "'$T'", 1, ""); print s join_next("t", "01"), join_next("t", "1.0") }')"
+printf '01\tz\n1\ta\n1.1\tb\n2\tc\n10\td\n' > $T
+check "join_next :n" "1z 1a 0 1b 0 1c 1d" "$(printf '01\n1\n1.0\n1.1\n1.10\n2\n10\n' | $B 'BEGIN {
+    join_open("t", "'$T'", "1:n", "") } { n = join_next("t", $1, r); split(r[1], f, "\t"); s = s (s == "" ? "" : " ") n f[2] }
+    END { print s }')"
+rm -f $T
+
+# kmerdump fills only an array or an unused name; other values are file names
+T=${TMPDIR:-/tmp}/check.$$.tsv
+check "kmerdump arr|file" "4 2 x 4 1 0 h 4 AC	2" "$($B 'function g(p) { return kmerdump("h", p) }
+    BEGIN { kmercount("ACGTAC", 2, "h"); s = kmerdump("h", a) " " a["AC"] " x" ""; s = s " " g(b) " " b["GT"]
+    c[2] = "h"; s = s " " kmerdump(c[2], c) " " c[2]; f = "'$T'"; s = s " " kmerdump("h", f); close(f)
+    getline l < f; print s, l }' 2>/dev/null)"
+rm -f $T
+
+check "cigar_blocks" "2 100	104	3	7 -1 5M2D3M" "$($B 'BEGIN { n = cigar_blocks("2S5M2D3M", 100, b)
+    a[1] = "5M2D3M"; print n, b[1], cigar_blocks(a[1], 100, a), a[1] }' 2>/dev/null)"
+
+T=${TMPDIR:-/tmp}/check.$$.snap
+check "array_load file in arr" "-1 $T" "$($B 'BEGIN { b["k"] = 1; array_save(b, "'$T'")
+    a[1] = "'$T'"; print array_load(a, a[1]), a[1] }' 2>/dev/null)"
+rm -f $T
+
+# array_save then array_load keeps each value's type; a cut file is refused
+T=${TMPDIR:-/tmp}/check.$$.snap
+check "array_save/array_load round trip" "6 1 10.0 0 1 0.3 1 1 0 -1" "$($B 'BEGIN {
+    split("10.0", f); a["strnum"] = f[1]; a["str"] = "10.0"; a["num"] = 0.1 + 0.2; a["empty"] = ""; a[""] = "k"; a[3] = 3
+    array_save(a, "'$T'"); n = array_load(b, "'$T'")
+    print n, (b["strnum"] == 10), b["strnum"], (b["str"] == 10), (b["num"] == 0.1 + 0.2), b["num"] "",
+        (("empty" in b) && b["empty"] == "" && length(b["empty"]) == 0), (b[""] == "k" && b[3] + 0 == 3), (b["empty"] == 0)
+    system("head -c 100 '$T' > '$T'.cut"); print array_load(c, "'$T'.cut") }' 2>/dev/null | tr "\n" " " | sed "s/ $//")"
+rm -f $T $T.cut
+
+# only \001 followed by base codes is a packed string
+check "seqpack_is" "ACGTNACGA 0.4 0 1" "$($B 'BEGIN { p = seqpack("ACGTNACGA"); q = sprintf("%c%s", 1, "hello")
+    print sequnpack(p), gc("ACGTN"), gc(q), hamming(q, sprintf("%c%s", 1, "hellx")) }')"
+
+# a copy shares its string until an in-place builtin changes one side
+check "copy-on-write strings" "ACGTTT AAACGT abc cba abc def ACGTTT NCGTTT TTTGCA NCGTTT ACGTTT AcgtTT ACGTTT acgttt ACGTTT TTTGCA TxTGCA ACGTTT" \
+    "$(echo "abc def" | $B 'function id(v) { return v }
+    { s = "ACGT" "TT"; r = s; revcomp(r); out = s " " r
+      f = $1; reverse(f); out = out " " $1 " " f " " $0
+      a[1] = s; e = a[1]; setat(e, 1, "N"); out = out " " a[1] " " e
+      reverse(a[1]); out = out " " a[1] " " e " " s
+      m = s; modstr(m, 2, 3, 0); out = out " " m " " s " " tolower(s) " " s
+      t = id(s); reverse(t); g = t; setat(g, 2, "x"); print out, t, g, s }')"
+
+# arrays keyed 1..n are kept dense until another key turns up; as mawk gives
+check "dense arrays" "6 6 30 y 0 0 5 112 2 0 4 3 z 3 pqr 0 3 one one one 0 0 two x 3 zmo 3" "$($B 'BEGIN {
+    for (i = 1; i <= 5; i++) a[i] = i * 10
+    a["x"] = "y"; n = 0; for (k in a) n++
+    out = n " " length(a) " " a[3] " " a["x"] " " ("6" in a)
+    delete a[3]; n = 0; for (k in a) n += (k == "x" ? 100 : k)
+    out = out " " (3 in a) " " length(a) " " n
+    for (i = 1; i <= 4; i++) b[i] = i; delete b[2]; delete b[4]; n = 0; for (k in b) n += k
+    out = out " " length(b) " " (2 in b) " " n; b[2] = "z"; out = out " " length(b) " " b[2]
+    c[1] = "p q r"; c[2] = c[3] = c[4] = "old"; n = split(c[1], c); out = out " " n " " c[1] c[2] c[3] " " (4 in c) " " length(c)
+    d[1] = "one"; out = out " " d["1"] " " d[1.0] " " d[0.5 * 2] " " ("01" in d) " " ("1.0" in d)
+    d["2"] = "two"; d[3.5] = "x"; out = out " " d[2] " " d["3.5"] " " length(d)
+    e[0] = "z"; e[-1] = "m"; e[1] = "o"; out = out " " e[0] e[-1] e[1] " " length(e)
+    print out }')"
+
+# sub and gsub, through the general path and the literal and class deletion ones; as the original and mawk give
+check "sub/gsub" "hell[o] w[o]rld|hell& w&rld|he<\ll>o wor<\l>d|1>hello world|1hello world<|12-h-e-l-l-o- -w-o-r-l-d-|12-h-e-l-l-o- -w-o-r-l-d-|1X|3XaXcX|3ACGTACG|3ACGT|2abc|5|2bar|1foobar|2bb|0x|1abcabcc|2aabcc#6 1 f00 H00 b00 3#" "$(echo "foo hoo boo" | $B 'BEGIN {
+    s = "hello world"; t = s; gsub(/o/, "[&]", t); out = t
+    t = s; gsub(/o/, "\\&", t); out = out "|" t
+    t = s; gsub(/l+/, "<\\\\&>", t); out = out "|" t
+    t = s; n = gsub(/^/, ">", t); out = out "|" n t
+    t = s; n = gsub(/$/, "<", t); out = out "|" n t
+    t = s; n = gsub(/x*/, "-", t); out = out "|" n t
+    t = s; n = gsub(//, "-", t); out = out "|" n t
+    t = "aaa"; n = gsub(/a*/, "X", t); out = out "|" n t
+    t = "abc"; n = gsub(/b*/, "X", t); out = out "|" n t
+    t = "ACGTNNACGN"; n = gsub(/[N]/, "", t); out = out "|" n t
+    t = "A-C-G T"; n = gsub(/[- ]/, "", t); out = out "|" n t
+    t = "a.b.c"; n = gsub(/\./, "", t); out = out "|" n t
+    t = "a.b.c"; n = gsub(".", "", t); out = out "|" n t
+    t = "foofoobar"; n = gsub(/foo/, "", t); out = out "|" n t
+    t = "foofoobar"; n = sub(/foo/, "", t); out = out "|" n t
+    t = "aaaa"; n = gsub(/aa/, "b", t); out = out "|" n t
+    t = "x"; n = gsub(/y/, "z", t); out = out "|" n t
+    t = "abcabc"; n = sub(/c$/, "&&", t); out = out "|" n t
+    t = "abc"; n = gsub(/[^b]/, "&&", t); out = out "|" n t
+    printf "%s#", out }
+{ n = gsub(/o/, "0"); m = sub(/^h/, "H", $2); printf "%s#", n " " m " " $0 " " NF }')"
+
+# function calls: recursion, array and scalar params, getline into params, exit
+# from deep in a call and more than 50 args; as the original gives
+check "function frames" "610 4 30 20 20 keep keep 1 5+2+3 53 second/third/u  third first 3#fourth 55#stop 55#end 6 144 5 a+b# rc=3" "$(printf 'first\nsecond\nthird\nskip\nfourth\nstop here\nnever\n' | $B '
+function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2) }
+function fill(arr, n,   i) { for (i = 1; i <= n; i++) arr[i] = i * i; return n }
+function sum(arr,   k, s) { for (k in arr) s += arr[k]; return s }
+function depth(n, a,   l) { if (n == 0) return length(a); a[n] = n; l = depth(n - 1, a); return l }
+function rd(x, arr,   y) { getline x; getline arr["g"]; y = "u"; getline y < "/dev/null"; return x "/" arr["g"] "/" y }
+function loc(a,   t) { t = a; a = "changed"; return t }
+function fresh(u) { u["k"] = 1 }
+function two(p, q) { return p "+" q }
+function down(n) { if (n == 0) exit 3; down(n - 1); print "not reached" }
+function many(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, a35, a36, a37, a38, a39, a40, a41, a42, a43, a44, a45, a46, a47, a48, a49, a50, a51, a52) { return a1 + a52 }
+NR == 1 { out = fib(15) " " fill(sq, 4) " " sum(sq) " " depth(20, d) " " length(d); v = "keep"; out = out " " loc(v) " " v; fresh(nw); out = out " " nw["k"]
+    out = out " " two(fib(5), two(fib(3), fib(4))) " " many(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52)
+    out = out " " rd(p, g) " " p " " g["g"] " " $0 " " NR; print out; next }
+$1 == "skip" { fill(t, 2); next }
+{ print $1, fib(10) }
+$1 == "stop" { down(30) }
+END { print "end", NR, fib(12), depth(5, e), two("a", loc("b")) }' | tr '\n' '#'; echo " rc=${PIPESTATUS[1]}")"
+
+# printf and sprintf: a cached format reused and evicted while it runs, more
+# formats than the cache holds, constant and variable formats; as the original gives
+check "printf formats" "<a|<b|191|in>|c>#<p|<q|<1|2|3>|r>|s>0;0.1;0.29;0.429;0.5714;    1;   0.9;1.00;1.143;1.2857;  1; 1.6; 1.71; 1.857;2.0000;2;2.3;2.43;2.571;2.7143;     3;3.0;3.14;3.286;3.4286;   4;  3.7;  3.86;4.000;4.1429; 4;4.4;4.57;4.714;4.8571;5;5.1;5.29;5.429;5.5714;0;0.1;0.29;0.429;0.5714;    1;   0.9;1.00;1.143;1.2857;  1; 1.6; 1.71; 1.857;2.0000;2;2.3;2.43;2.571;2.7143;     3;3.0;3.14;3.286;3.4286;   4;  3.7;  3.86;4.000;4.1429; 4;4.4;4.57;4.714;4.8571;5;5.1;5.29;5.429;5.5714;#0.50 0.500000 0 0.500      0.5 0.5     | 0.50 0.500000 0#1.50 1.500000 2 1.500      1.5 1.5     | 1.50 1.500000 2#2.50 2.500000 2 2.500      2.5 2.5     | 2.50 2.500000 2#-0.50 -0.500000 -0 -0.500     -0.5 -0.5    | -0.50 -0.500000 -0#-0.00 -0.000000 -0 -0.000     -0.0 -0.0    | -0.00 -0.000000 -0#0.12 0.125000 0 0.125      0.1 0.1     | 0.12 0.125000 0#0.38 0.375000 0 0.375      0.4 0.4     | 0.38 0.375000 0#1000000000000000.00 1000000000000000.000000 1000000000000000 1000000000000000.000 1000000000000000.0 1000000000000000.0| 1000000000000000.00 1000000000000000.000000 1000000000000000#123456789.99 123456789.987654 123456790 123456789.988 123456790.0 123456790.0| 123456789.99 123456789.987654 123456790#-2.67 -2.675000 -3 -2.675     -2.7 -2.7    | -2.67 -2.675000 -3#0.00 0.000000 0 0.000      0.0 0.0     | 0.00 0.000000 0#9.99 9.995000 10 9.995     10.0 10.0    | 9.99 9.995000 10# 3.14|42|str|A|ff|10|1.234568e+04|0.0001|%|-7|    r|l    |tr|x# 3.14|42|str|A|ff|10|1.234568e+04|0.0001|%|-7|    r|l    |tr|x#   42|7   |3.14#" "$($B '
+function g(tag,   i, s) { for (i = 0; i < 20; i++) s = s sprintf("%" i "d", i % 10); return sprintf(fmt, tag, length(s), "in") }
+BEGIN {
+    fmt = "<%s|%s|%s>"; printf fmt, "a", g("b"), "c"; printf "\n"
+    out = sprintf(fmt, "p", sprintf(fmt, "q", sprintf(fmt, 1, 2, 3), "r"), "s")
+    for (r = 0; r < 2; r++) for (i = 0; i < 40; i++) out = out sprintf("%" (i % 7) "." (i % 5) "f;", i / 7)
+    print out
+    split("0.5 1.5 2.5 -0.5 -0 0.125 0.375 1e15 123456789.987654321 -2.675 1e-7 9.995", v, " ")
+    for (i = 1; i <= 12; i++) {
+        d = "%.2f"; e = "%f"; z = "%.0f"
+        printf "%.2f %f %.0f %.3f %8.1f %-8.1f| ", v[i], v[i], v[i], v[i], v[i], v[i]
+        printf d " " e " " z "\n", v[i], v[i], v[i]
+    }
+    printf "%5.2f|%d|%s|%c|%x|%o|%e|%g|%%|%i|%5s|%-5s|%.2s|%c\n", 3.14159, 42.9, "str", 65, 255, 8, 12345.678, 0.0001, -7, "r", "l", "trunc", "xyz"
+    f2 = "%5.2f|%d|%s|%c|%x|%o|%e|%g|%%|%i|%5s|%-5s|%.2s|%c\n"
+    printf f2, 3.14159, 42.9, "str", 65, 255, 8, 12345.678, 0.0001, -7, "r", "l", "trunc", "xyz"
+    printf "%*d|%-*d|%.*f\n", 5, 42, 4, 7, 2, 3.14159
+}' | tr '\n' '#')"
+
+# cov_add with 1/NH weights, in order and shuffled, against depth summed per
+# base in 60ths
+T=${TMPDIR:-/tmp}/check.$$
+$B 'BEGIN {
+    REF = "'$T'.ref"; SRT = "'$T'.srt"; SHF = "'$T'.shf"; srand(11); n = 0
+    for (c = 1; c <= 2; c++) for (b = 0; b < 3000; b += int(rand() * 12)) {
+        ++n; C[n] = "c" c; B[n] = b; E[n] = b + 1 + int(rand() * 90); H[n] = 1 + int(rand() * 5)
+        for (p = B[n]; p < E[n]; p++) D[c, p] += 60 / H[n]    # exact, in 60ths
+    }
+    for (c = 1; c <= 2; c++) for (p = 0; p <= 3100; p++) {    # the reference bedGraph
+        d = D[c, p] + 0
+        if (p > 0 && d != last) { if (last > 0) printf "c%d\t%d\t%d\t%.6g\n", c, beg, p, last / 60 > REF; beg = p }
+        if (p == 0) beg = 0
+        last = d
+    }
+    for (i = 1; i <= n; i++) P[i] = i
+    for (i = n; i > 1; i--) { j = 1 + int(rand() * i); t = P[i]; P[i] = P[j]; P[j] = t }
+    cov_emit("s", SRT)
+    for (i = 1; i <= n; i++) { cov_add("s", C[i], B[i], E[i], 1 / H[i]); cov_add("u", C[P[i]], B[P[i]], E[P[i]], 1 / H[P[i]]) }
+    cov_emit("s", SRT); cov_emit("u", SHF)
+}'
+check "cov_add/cov_emit" "same same" "$(cmp -s $T.ref $T.srt && echo same) $(cmp -s $T.ref $T.shf && echo same)"
+rm -f $T.ref $T.srt $T.shf
+
+exit $fail
@@ -0,0 +1,105 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cigar.h"
+
+static cigar_t g_cigar;
+static char *g_str;     /* the string g_cigar was decoded from */
+static size_t g_size, g_nops;
+static int g_valid;     /* 0 if g_str was not a CIGAR */
+
+static void *cigar_realloc(void *p, size_t n)
+{
+    if ((p = realloc(p, n)) == NULL) {
+        fprintf(stderr, "cigar: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static int decode(cigar_t *c, const char *s)
+{
+    static signed char opcode[256];
+    uint32_t *ops;
+    const char *o;
+    unsigned long len;
+    int op, i;
+
+    if (opcode[0] == 0) {
+        memset(opcode, -1, sizeof(opcode));
+        for (o = CIGAR_OPS; *o; ++o)
+            opcode[(unsigned char)*o] = o - CIGAR_OPS;
+    }
+    ops = c->ops; // the op buffer is kept
+    memset(c, 0, sizeof(cigar_t));
+    c->ops = ops;
+    if (s[0] == '*' && s[1] == '\0')
+        return 1;
+    if (*s == '\0')
+        return 0;
+    while (*s) {
+        if (!isdigit((unsigned char)*s))
+            return 0;
+        for (len = 0; isdigit((unsigned char)*s); ++s)
+            len = len * 10 + (*s - '0');
+        if ((op = opcode[(unsigned char)*s++]) < 0 || len >= 1UL << 28)
+            return 0;
+        if (c->n == g_nops) {
+            g_nops = g_nops ? g_nops * 2 : 64;
+            c->ops = (uint32_t *) cigar_realloc(c->ops, g_nops * sizeof(uint32_t));
+        }
+        c->ops[c->n++] = (uint32_t)len << 4 | op;
+        switch (CIGAR_OPS[op]) {
+        case 'M': c->match += len, c->ref += len, c->query += len; break;
+        case '=': c->match += len, c->ref += len, c->query += len; break;
+        case 'X': c->match += len, c->mismatch += len, c->ref += len, c->query += len; break;
+        case 'I': c->ins += len, c->query += len; break;
+        case 'D': c->del += len, c->ref += len; break;
+        case 'N': c->skip += len, c->ref += len; break;
+        case 'S': c->query += len; break;
+        }
+    }
+    for (i = 0; i < 2 && c->n > 0; ++i) { // clips: H at the very end, S there or just inside it
+        long j = i == 0 ? 0 : (long)c->n - 1, step = i == 0 ? 1 : -1;
+        if (CIGAR_OPS[c->ops[j] & 0xf] == 'H') {
+            c->hard[i] = c->ops[j] >> 4;
+            if ((j += step) < 0 || j >= (long)c->n)
+                continue;
+        }
+        if (CIGAR_OPS[c->ops[j] & 0xf] == 'S')
+            c->soft[i] = c->ops[j] >> 4;
+    }
+    return 1;
+}
+
+const cigar_t *cigar_get(const char *s)
+{
+    size_t n = strlen(s);
+
+    if (g_str == NULL || strcmp(g_str, s) != 0) {
+        if (n + 1 > g_size) {
+            g_size = n + 1;
+            g_str = (char *) cigar_realloc(g_str, g_size);
+        }
+        memcpy(g_str, s, n + 1);
+        g_valid = decode(&g_cigar, s);
+    }
+    return g_valid ? &g_cigar : NULL;
+}
+
+long cigar_md_mismatches(const char *md)
+{
+    long n = 0;
+    int del = 0;
+
+    for (; *md; ++md) {
+        if (*md == '^')
+            del = 1;
+        else if (isdigit((unsigned char)*md))
+            del = 0;
+        else if (isalpha((unsigned char)*md))
+            n += !del;
+    }
+    return n;
+}
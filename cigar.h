@@ -0,0 +1,29 @@
+#ifndef CIGAR_H
+#define CIGAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* CIGAR decoding for cigar() and cigar_blocks(). A CIGAR string is decoded
+ * once into ops packed as in BAM, length << 4 | op, with its spans and
+ * clips summed on the way; the last one decoded is kept, so asking several
+ * things of one record's CIGAR decodes it once. */
+
+#define CIGAR_OPS "MIDNSHP=X" /* op codes 0..8, as in BAM */
+
+typedef struct cigar {
+    uint32_t *ops;
+    size_t n;
+    long ref, query;      /* bases of the reference (MDN=X) and of SEQ (MIS=X) */
+    long match, mismatch; /* bases of M=X, and of X */
+    long ins, del, skip;  /* bases of I, D and N */
+    long soft[2], hard[2]; /* clips at the left and right ends */
+} cigar_t;
+
+/* the decoded CIGAR, or NULL if s is not a CIGAR; "*" has no ops */
+const cigar_t *cigar_get(const char *s);
+
+/* Mismatches given by an MD tag: the bases not part of a ^deletion. */
+long cigar_md_mismatches(const char *md);
+
+#endif
@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "cov.h"
+
+#define COV_STEP 4096 /* the window moves on by at least this much */
+#define COV_RUNS 4096 /* runs kept before they are written, once there is an output */
+#define COV_ONE  4294967296.0 /* depth is kept in fixed point, 2^32 to 1, so sums are exact */
+#define COV_EPS  65536        /* depths this close are the same: weights are rounded to 2^-32 each */
+
+typedef struct {
+    long beg, end;
+    int64_t depth;
+} cov_run_t;
+
+typedef struct {
+    long pos;
+    int64_t delta;
+} cov_ev_t;
+
+typedef struct cov_ctg_s {
+    char *name;
+    long wbeg;          /* d[i] is the change in depth at wbeg + i */
+    long written;       /* runs before this have been written */
+    int64_t depth;      /* depth just before wbeg */
+    int64_t *d;
+    size_t dlen, dsize;
+    cov_run_t *run;     /* final depth before wbeg, no runs of 0 */
+    size_t nrun, mrun;
+    cov_ev_t *late;     /* changes before wbeg from intervals out of order */
+    size_t nlate, mlate;
+    struct cov_ctg_s *next;
+} cov_ctg_t;
+
+typedef struct cov_s {
+    char *name;
+    char *out;          /* NULL until cov_emit() */
+    int64_t min_depth;
+    cov_fn fn;
+    cov_ctg_t *ctg, *tail, *cur;
+    struct cov_s *next;
+} cov_t;
+
+static cov_t *g_covs;
+
+static void *cov_realloc(void *p, size_t n)
+{
+    if ((p = realloc(p, n)) == NULL) {
+        fprintf(stderr, "cov: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static char *cov_strdup(const char *s)
+{
+    size_t n = strlen(s) + 1;
+    return (char *) memcpy(cov_realloc(NULL, n), s, n);
+}
+
+static cov_t *cov_find(const char *handle, int create)
+{
+    cov_t *h;
+
+    for (h = g_covs; h; h = h->next)
+        if (strcmp(h->name, handle) == 0) return h;
+    if (!create)
+        return NULL;
+    h = (cov_t *) cov_realloc(NULL, sizeof(cov_t));
+    memset(h, 0, sizeof(cov_t));
+    h->name = cov_strdup(handle);
+    h->next = g_covs;
+    g_covs = h;
+    return h;
+}
+
+static cov_ctg_t *ctg_find(cov_t *h, const char *chrom)
+{
+    cov_ctg_t *c;
+
+    if (h->cur && strcmp(h->cur->name, chrom) == 0)
+        return h->cur;
+    for (c = h->ctg; c; c = c->next)
+        if (strcmp(c->name, chrom) == 0) return c;
+    c = (cov_ctg_t *) cov_realloc(NULL, sizeof(cov_ctg_t));
+    memset(c, 0, sizeof(cov_ctg_t));
+    c->name = cov_strdup(chrom);
+    if (h->tail)
+        h->tail->next = c;
+    else
+        h->ctg = c;
+    h->tail = c;
+    return c;
+}
+
+static void add_run(cov_ctg_t *c, long beg, long end, int64_t depth)
+{
+    cov_run_t *r;
+
+    if (end <= beg || llabs(depth) <= COV_EPS)
+        return;
+    if (c->nrun > 0 && (r = &c->run[c->nrun - 1])->end == beg && llabs(r->depth - depth) <= COV_EPS) {
+        r->end = end;
+        return;
+    }
+    if (c->nrun == c->mrun) {
+        c->mrun = c->mrun ? c->mrun * 2 : 256;
+        c->run = (cov_run_t *) cov_realloc(c->run, c->mrun * sizeof(cov_run_t));
+    }
+    r = &c->run[c->nrun++];
+    r->beg = beg, r->end = end, r->depth = depth;
+}
+
+static void add_late(cov_ctg_t *c, long pos, int64_t delta)
+{
+    if (c->nlate == c->mlate) {
+        c->mlate = c->mlate ? c->mlate * 2 : 256;
+        c->late = (cov_ev_t *) cov_realloc(c->late, c->mlate * sizeof(cov_ev_t));
+    }
+    c->late[c->nlate].pos = pos;
+    c->late[c->nlate++].delta = delta;
+}
+
+/* makes the depth before p final, turning it into runs */
+static void flush(cov_ctg_t *c, long p)
+{
+    size_t i, k = (size_t)(p - c->wbeg) < c->dlen ? (size_t)(p - c->wbeg) : c->dlen;
+    long beg = c->wbeg;
+    int64_t depth = c->depth;
+
+    for (i = 0; i < k; ++i) {
+        if (c->d[i] != 0) {
+            add_run(c, beg, c->wbeg + i, depth);
+            depth += c->d[i];
+            beg = c->wbeg + i;
+        }
+    }
+    add_run(c, beg, p, depth);
+    c->depth = depth;
+    memmove(c->d, c->d + k, (c->dlen - k) * sizeof(int64_t));
+    c->dlen -= k;
+    c->wbeg = p;
+}
+
+static int cmp_ev(const void *a, const void *b)
+{
+    long x = ((const cov_ev_t *)a)->pos, y = ((const cov_ev_t *)b)->pos;
+    return x < y ? -1 : x > y;
+}
+
+/* folds the out of order intervals into the runs */
+static void merge_late(cov_ctg_t *c)
+{
+    cov_ev_t *ev;
+    size_t i, n = 0;
+    int64_t depth = 0;
+
+    if (c->nlate == 0)
+        return;
+    ev = (cov_ev_t *) cov_realloc(NULL, (c->nlate + 2 * c->nrun) * sizeof(cov_ev_t));
+    memcpy(ev, c->late, c->nlate * sizeof(cov_ev_t));
+    n = c->nlate;
+    for (i = 0; i < c->nrun; ++i) {
+        ev[n].pos = c->run[i].beg, ev[n++].delta = c->run[i].depth;
+        ev[n].pos = c->run[i].end, ev[n++].delta = -c->run[i].depth;
+    }
+    qsort(ev, n, sizeof(cov_ev_t), cmp_ev);
+    c->nrun = c->nlate = 0;
+    for (i = 0; i < n; ++i) {
+        depth += ev[i].delta;
+        if (i + 1 < n)
+            add_run(c, ev[i].pos, ev[i + 1].pos, depth);
+    }
+    free(ev);
+}
+
+/* writes the runs of c, but for the last if keep, which may yet go on */
+static long write_runs(cov_t *h, cov_ctg_t *c, int keep)
+{
+    size_t i, m;
+    long n = 0;
+    cov_run_t *r;
+
+    merge_late(c);
+    m = keep && c->nrun > 0 ? c->nrun - 1 : c->nrun;
+    for (i = 0; i < m; ++i) {
+        r = &c->run[i];
+        if (h->min_depth == 0 || r->depth >= h->min_depth) {
+            h->fn(c->name, r->beg, r->end, r->depth / COV_ONE, h->out);
+            ++n;
+        }
+    }
+    if (m < c->nrun) {
+        c->run[0] = c->run[m];
+        c->written = c->run[0].beg;
+    } else
+        c->written = c->wbeg;
+    c->nrun -= m;
+    return n;
+}
+
+/* the whole window of c is final */
+static void finish(cov_t *h, cov_ctg_t *c)
+{
+    flush(c, c->wbeg + (long)c->dlen);
+    if (h->out && c->nlate == 0)
+        write_runs(h, c, 0);
+}
+
+int cov_add(const char *handle, const char *chrom, long beg, long end, double w)
+{
+    cov_t *h = cov_find(handle, 1);
+    cov_ctg_t *c = ctg_find(h, chrom);
+    size_t need;
+    int64_t fw = (int64_t) llround(w * COV_ONE);
+    int ret = 0;
+
+    if (c != h->cur) {
+        if (h->cur)
+            finish(h, h->cur);
+        h->cur = c;
+    }
+    if (beg < c->written) {
+        ret = -1;
+        beg = c->written;
+    }
+    if (end <= beg || fw == 0)
+        return ret;
+    if (beg < c->wbeg) {
+        add_late(c, beg, fw);
+        add_late(c, end < c->wbeg ? end : c->wbeg, -fw);
+        if (end <= c->wbeg)
+            return ret;
+        beg = c->wbeg;
+    } else if (beg - c->wbeg >= COV_STEP && (size_t)(beg - c->wbeg) >= c->dlen / 2) {
+        flush(c, beg);
+        if (h->out && c->nlate == 0 && c->nrun >= COV_RUNS)
+            write_runs(h, c, 1);
+    }
+    need = (size_t)(end - c->wbeg) + 1;
+    if (need > c->dsize) {
+        c->dsize = need > 2 * c->dsize ? need : 2 * c->dsize;
+        c->d = (int64_t *) cov_realloc(c->d, c->dsize * sizeof(int64_t));
+    }
+    if (need > c->dlen) {
+        memset(c->d + c->dlen, 0, (need - c->dlen) * sizeof(int64_t));
+        c->dlen = need;
+    }
+    c->d[beg - c->wbeg] += fw;
+    c->d[end - c->wbeg] -= fw;
+    return ret;
+}
+
+long cov_emit(const char *handle, const char *out, double min_depth, cov_fn fn)
+{
+    cov_t *h = cov_find(handle, 1);
+    cov_ctg_t *c;
+    long n = 0;
+
+    free(h->out);
+    h->out = cov_strdup(out);
+    h->min_depth = (int64_t) llround(min_depth * COV_ONE);
+    h->fn = fn;
+    for (c = h->ctg; c; c = c->next) {
+        flush(c, c->wbeg + (long)c->dlen);
+        n += write_runs(h, c, 0);
+    }
+    return n;
+}
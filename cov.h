@@ -0,0 +1,25 @@
+#ifndef COV_H
+#define COV_H
+
+/* Depth of coverage for cov_add() and cov_emit(). Each handle keeps, for
+ * each contig, a difference array over a window that starts at the
+ * beginning of the last interval added: with coordinate sorted input the
+ * depth before it is final, and is turned into runs of equal depth as the
+ * window moves on. Intervals that start before the window are kept aside
+ * and merged in when the runs are written. Once a handle has an output,
+ * finished runs are written as they are made, so memory is bounded by the
+ * window rather than the genome. Depths are summed in fixed point, exact
+ * to 2^-32, so fractional weights such as 1/NH cancel out exactly. */
+
+typedef void (*cov_fn)(const char *chrom, long beg, long end, double depth, const char *out);
+
+/* Adds weight w over [beg, end) of chrom, 0-based. Returns 0, or -1 if some
+ * of it lies before coverage already written, which is then left out. */
+int cov_add(const char *handle, const char *chrom, long beg, long end, double w);
+
+/* Calls fn(..., out) for each run of depth >= min_depth (any but 0 if
+ * min_depth is 0) in contig order, and drops them. From then on fn also
+ * gets the runs later cov_add() calls finish. Returns the number of runs. */
+long cov_emit(const char *handle, const char *out, double min_depth, cov_fn fn);
+
+#endif
@@ -0,0 +1,269 @@
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "fhash.h"
+
+/*********************************
+ * XXH3, 64-bit hash with seed 0 *
+ *********************************/
+
+/* After xxHash 0.8 by Yann Collet (BSD 2-clause): inputs of up to 240
+ * bytes are mixed directly with the secret; longer ones are accumulated
+ * 64 bytes (a stripe) at a time in 8 lanes, scrambled every 1 KB. */
+
+#define P32_1 0x9E3779B1U
+#define P32_2 0x85EBCA77U
+#define P32_3 0xC2B2AE3DU
+#define P64_1 0x9E3779B185EBCA87ULL
+#define P64_2 0xC2B2AE3D27D4EB4FULL
+#define P64_3 0x165667B19E3779F9ULL
+#define P64_4 0x85EBCA77C2B2AE63ULL
+#define P64_5 0x27D4EB2F165667C5ULL
+#define PMX_1 0x165667919E3779F9ULL
+#define PMX_2 0x9FB21C651E98DF25ULL
+
+#define SECRET_SIZE 192
+#define STRIPE 64
+
+static const unsigned char kSecret[SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+static inline uint32_t rd32(const unsigned char *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t rd64(const unsigned char *p)
+{
+    return (uint64_t)rd32(p) | (uint64_t)rd32(p + 4) << 32;
+}
+
+static inline uint64_t rotl64(uint64_t x, int r) { return x << r | x >> (64 - r); }
+
+static inline uint64_t swap64(uint64_t x) { return __builtin_bswap64(x); }
+
+static inline uint64_t mul128_fold64(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 p = (unsigned __int128)a * b;
+    return (uint64_t)p ^ (uint64_t)(p >> 64);
+#else
+    uint64_t lo_lo = (a & 0xffffffff) * (b & 0xffffffff), hi_lo = (a >> 32) * (b & 0xffffffff);
+    uint64_t lo_hi = (a & 0xffffffff) * (b >> 32), hi_hi = (a >> 32) * (b >> 32);
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    return ((cross << 32) | (lo_lo & 0xffffffff)) ^ (hi_hi + (hi_lo >> 32) + (cross >> 32));
+#endif
+}
+
+static uint64_t xxh64_avalanche(uint64_t h)
+{
+    h ^= h >> 33, h *= P64_2;
+    h ^= h >> 29, h *= P64_3;
+    return h ^ h >> 32;
+}
+
+static uint64_t avalanche(uint64_t h)
+{
+    h ^= h >> 37, h *= PMX_1;
+    return h ^ h >> 32;
+}
+
+static uint64_t rrmxmx(uint64_t h, uint64_t len)
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= PMX_2;
+    h ^= (h >> 35) + len;
+    h *= PMX_2;
+    return h ^ h >> 28;
+}
+
+static inline uint64_t mix16(const unsigned char *p, const unsigned char *s)
+{
+    return mul128_fold64(rd64(p) ^ rd64(s), rd64(p + 8) ^ rd64(s + 8));
+}
+
+static uint64_t len_0to16(const unsigned char *p, size_t n)
+{
+    const unsigned char *s = kSecret;
+
+    if (n > 8) {
+        uint64_t lo = rd64(p) ^ (rd64(s + 24) ^ rd64(s + 32));
+        uint64_t hi = rd64(p + n - 8) ^ (rd64(s + 40) ^ rd64(s + 48));
+        return avalanche(n + swap64(lo) + hi + mul128_fold64(lo, hi));
+    }
+    if (n >= 4) {
+        uint64_t x = rd32(p + n - 4) + ((uint64_t)rd32(p) << 32);
+        return rrmxmx(x ^ (rd64(s + 8) ^ rd64(s + 16)), n);
+    }
+    if (n > 0) {
+        uint32_t c = (uint32_t)p[0] << 16 | (uint32_t)p[n >> 1] << 24 | (uint32_t)p[n - 1] | (uint32_t)n << 8;
+        return xxh64_avalanche((uint64_t)c ^ (rd32(s) ^ rd32(s + 4)));
+    }
+    return xxh64_avalanche(rd64(s + 56) ^ rd64(s + 64));
+}
+
+static uint64_t len_17to240(const unsigned char *p, size_t n)
+{
+    const unsigned char *s = kSecret;
+    uint64_t acc = n * P64_1, end;
+    size_t i;
+
+    if (n <= 128) {
+        for (i = 0; i < 4 && n > 32 * i; ++i) { /* 16-byte pairs from the two ends */
+            acc += mix16(p + 16 * i, s + 32 * i);
+            acc += mix16(p + n - 16 * (i + 1), s + 32 * i + 16);
+        }
+        return avalanche(acc);
+    }
+    for (i = 0; i < 8; ++i)
+        acc += mix16(p + 16 * i, s + 16 * i);
+    acc = avalanche(acc);
+    end = mix16(p + n - 16, s + 136 - 17);
+    for (i = 8; i < n / 16; ++i)
+        end += mix16(p + 16 * i, s + 16 * (i - 8) + 3);
+    return avalanche(acc + end);
+}
+
+static inline void accumulate(uint64_t *acc, const unsigned char *p, const unsigned char *s)
+{
+#ifdef __SSE2__
+    __m128i *xacc = (__m128i *)acc;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        __m128i d = _mm_loadu_si128((const __m128i *)(p + 16 * i));
+        __m128i k = _mm_xor_si128(d, _mm_loadu_si128((const __m128i *)(s + 16 * i)));
+        __m128i prod = _mm_mul_epu32(k, _mm_shuffle_epi32(k, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m128i swap = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+        xacc[i] = _mm_add_epi64(prod, _mm_add_epi64(xacc[i], swap));
+    }
+#else
+    uint64_t d, k;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        d = rd64(p + 8 * i);
+        k = d ^ rd64(s + 8 * i);
+        acc[i ^ 1] += d;
+        acc[i] += (k & 0xffffffff) * (k >> 32);
+    }
+#endif
+}
+
+static void scramble(uint64_t *acc, const unsigned char *s)
+{
+    int i;
+
+    for (i = 0; i < 8; ++i)
+        acc[i] = ((acc[i] ^ acc[i] >> 47) ^ rd64(s + 8 * i)) * P32_1;
+}
+
+static uint64_t len_long(const unsigned char *p, size_t n)
+{
+    const unsigned char *s = kSecret;
+    const size_t per_block = (SECRET_SIZE - STRIPE) / 8, block = STRIPE * per_block;
+    size_t b, nb = (n - 1) / block, i, ns;
+    uint64_t acc[8] __attribute__((aligned(16))) = { P32_3, P64_1, P64_2, P64_3, P64_4, P32_2, P64_5, P32_1 };
+    uint64_t h = n * P64_1;
+
+    for (b = 0; b < nb; ++b) {
+        for (i = 0; i < per_block; ++i)
+            accumulate(acc, p + b * block + i * STRIPE, s + 8 * i);
+        scramble(acc, s + SECRET_SIZE - STRIPE);
+    }
+    ns = ((n - 1) - block * nb) / STRIPE;
+    for (i = 0; i < ns; ++i)
+        accumulate(acc, p + nb * block + i * STRIPE, s + 8 * i);
+    accumulate(acc, p + n - STRIPE, s + SECRET_SIZE - STRIPE - 7);
+    for (i = 0; i < 4; ++i)
+        h += mul128_fold64(acc[2 * i] ^ rd64(s + 11 + 16 * i), acc[2 * i + 1] ^ rd64(s + 11 + 16 * i + 8));
+    return avalanche(h);
+}
+
+uint64_t xxh3_64(const void *s, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)s;
+
+    if (n <= 16) return len_0to16(p, n);
+    if (n <= 240) return len_17to240(p, n);
+    return len_long(p, n);
+}
+
+/**********
+ * CRC32C *
+ **********/
+
+/* With SSE4.2 (checked at run time on x86) the crc32 instruction does 8
+ * bytes at a time; otherwise tables do 8 bytes at a time (slicing-by-8). */
+
+static uint32_t crc_tab[8][256];
+
+static void crc_init(void)
+{
+    uint32_t c;
+    int i, j;
+
+    for (i = 0; i < 256; ++i) {
+        for (c = i, j = 0; j < 8; ++j)
+            c = c & 1 ? c >> 1 ^ 0x82F63B78 : c >> 1;
+        crc_tab[0][i] = c;
+    }
+    for (i = 0; i < 256; ++i)
+        for (j = 1; j < 8; ++j)
+            crc_tab[j][i] = crc_tab[j - 1][i] >> 8 ^ crc_tab[0][crc_tab[j - 1][i] & 0xff];
+}
+
+static uint32_t crc_sw(uint32_t c, const unsigned char *p, size_t n)
+{
+    uint64_t x;
+
+    if (crc_tab[0][1] == 0) crc_init();
+    for (; n >= 8; p += 8, n -= 8) {
+        x = rd64(p) ^ c;
+        c = crc_tab[7][x & 0xff] ^ crc_tab[6][x >> 8 & 0xff] ^ crc_tab[5][x >> 16 & 0xff] ^ crc_tab[4][x >> 24 & 0xff]
+          ^ crc_tab[3][x >> 32 & 0xff] ^ crc_tab[2][x >> 40 & 0xff] ^ crc_tab[1][x >> 48 & 0xff] ^ crc_tab[0][x >> 56];
+    }
+    for (; n > 0; ++p, --n)
+        c = c >> 8 ^ crc_tab[0][(c ^ *p) & 0xff];
+    return c;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t crc_hw(uint32_t c, const unsigned char *p, size_t n)
+{
+    uint64_t c64 = c;
+
+    for (; n >= 8; p += 8, n -= 8)
+        c64 = __builtin_ia32_crc32di(c64, rd64(p));
+    for (c = (uint32_t)c64; n > 0; ++p, --n)
+        c = __builtin_ia32_crc32qi(c, *p);
+    return c;
+}
+#endif
+
+uint32_t crc32c(uint32_t crc, const void *s, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)s;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    static int hw = -1;
+
+    if (hw < 0) hw = __builtin_cpu_supports("sse4.2");
+    if (hw) return ~crc_hw(~crc, p, n);
+#endif
+    return ~crc_sw(~crc, p, n);
+}
@@ -0,0 +1,12 @@
+#ifndef FHASH_H
+#define FHASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Non-cryptographic hashes for xxh3() and crc32c(). */
+
+uint64_t xxh3_64(const void *s, size_t n);              /* XXH3_64bits(), seed 0; matches xxhsum -H3 */
+uint32_t crc32c(uint32_t crc, const void *s, size_t n); /* Castagnoli CRC of s continuing crc, which is 0 to start */
+
+#endif
@@ -0,0 +1,248 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "fxpar.h"
+
+#include "kseq.h"
+
+/* kseq reads the mapped file through this instead of a gzFile */
+typedef struct {
+    const char *s;
+    size_t off, len;
+} fxmem_t;
+
+static int fxmem_read(fxmem_t *m, void *buf, int len)
+{
+    if ((size_t)len > m->len - m->off) len = m->len - m->off;
+    memcpy(buf, m->s + m->off, len);
+    m->off += len;
+    return len;
+}
+
+KSEQ_INIT(fxmem_t *, fxmem_read)
+
+#define FX_BLOCK_SIZE (4 << 20) /* bytes of input per block */
+
+typedef struct {
+    char *rec;      /* records, each name\tseq\tqual\tcomment\0 */
+    size_t l, m;
+    int done;       /* set by the worker when rec is complete */
+    int err;        /* block ended at a malformed record */
+} fxblock_t;
+
+struct fxpar_s {
+    int fd, is_fq;
+    const char *data;
+    size_t size;
+    int n_block, window;
+    fxblock_t *blk;
+    int next;       /* next block a worker will take */
+    int cur;        /* block the caller is reading */
+    size_t pos;     /* offset of the next record in blk[cur].rec */
+    int n_threads, stop;
+    pthread_t *tid;
+    pthread_mutex_t lock;
+    pthread_cond_t cv;
+};
+
+/* start of the line after i */
+static size_t fx_nextline(const fxpar_t *p, size_t i)
+{
+    const char *q = memchr(p->data + i, '\n', p->size - i);
+    return q ? q - p->data + 1 : p->size;
+}
+
+static size_t fx_linelen(const fxpar_t *p, size_t i)
+{
+    size_t e = fx_nextline(p, i);
+    if (e > i && p->data[e-1] == '\n') --e;
+    if (e > i && p->data[e-1] == '\r') --e;
+    return e - i;
+}
+
+/* first record boundary at or after i. A FASTA record starts on a line
+ * beginning with '>'. For FASTQ a line beginning with '@' can also be a
+ * quality line, so it must also be followed by a sequence, a '+' line and
+ * a quality line of the same length as the sequence. */
+static size_t fx_sync(const fxpar_t *p, size_t i)
+{
+    size_t l1, l2, l3;
+
+    if (i > 0 && p->data[i-1] != '\n')
+        i = fx_nextline(p, i);
+    for (; i < p->size; i = fx_nextline(p, i)) {
+        if (!p->is_fq) {
+            if (p->data[i] == '>') return i;
+            continue;
+        }
+        if (p->data[i] != '@') continue;
+        l1 = fx_nextline(p, i);
+        l2 = l1 < p->size ? fx_nextline(p, l1) : p->size;
+        if (l2 >= p->size) return i; /* truncated last record */
+        if (p->data[l2] != '+') continue;
+        l3 = fx_nextline(p, l2);
+        if (l3 >= p->size || fx_linelen(p, l1) == fx_linelen(p, l3)) return i;
+    }
+    return p->size;
+}
+
+static void fx_append(fxblock_t *b, const kstring_t *s, int c)
+{
+    if (b->l + s->l + 1 > b->m) {
+        b->m = b->l + s->l + 1;
+        kroundup32(b->m);
+        b->rec = (char *)realloc(b->rec, b->m);
+    }
+    memcpy(b->rec + b->l, s->s, s->l);
+    b->l += s->l;
+    b->rec[b->l++] = c;
+}
+
+/* parse the records that start inside block b */
+static void fx_parse(fxpar_t *p, int b)
+{
+    fxblock_t *blk = &p->blk[b];
+    size_t beg = (size_t)b * FX_BLOCK_SIZE, end, at;
+    fxmem_t m;
+    kseq_t *ks;
+    int c;
+
+    end = beg + FX_BLOCK_SIZE < p->size ? beg + FX_BLOCK_SIZE : p->size;
+    if (b > 0 && (beg = fx_sync(p, beg)) >= end)
+        return;
+    m.s = p->data, m.off = beg, m.len = p->size;
+    ks = kseq_init(&m);
+    for (;;) {
+        /* where kseq_read() will find the next header */
+        at = m.off - (ks->f->end - ks->f->begin);
+        if (ks->last_char) --at; /* its '>' or '@' has been read already */
+        else while (at < p->size && p->data[at] != '>' && p->data[at] != '@') ++at;
+        if (at >= end) break; /* belongs to the next block */
+        if ((c = kseq_read(ks)) < 0) {
+            if (c == -2) blk->err = 1;
+            break;
+        }
+        fx_append(blk, &ks->name, '\t');
+        fx_append(blk, &ks->seq, '\t');
+        fx_append(blk, &ks->qual, '\t');
+        fx_append(blk, &ks->comment, '\0');
+    }
+    kseq_destroy(ks);
+}
+
+static void *fx_worker(void *data)
+{
+    fxpar_t *p = (fxpar_t *)data;
+    int b;
+
+    pthread_mutex_lock(&p->lock);
+    for (;;) {
+        while (!p->stop && p->next < p->n_block && p->next >= p->cur + p->window)
+            pthread_cond_wait(&p->cv, &p->lock);
+        if (p->stop || p->next >= p->n_block) break;
+        b = p->next++;
+        pthread_mutex_unlock(&p->lock);
+        fx_parse(p, b);
+        pthread_mutex_lock(&p->lock);
+        p->blk[b].done = 1;
+        pthread_cond_broadcast(&p->cv);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return 0;
+}
+
+fxpar_t *fxpar_open(const char *fn, int n_threads)
+{
+    fxpar_t *p;
+    struct stat st;
+    void *data;
+    size_t i;
+    int fd;
+
+    if ((fd = open(fn, O_RDONLY)) < 0) return 0;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size < 2
+            || (data = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+        close(fd);
+        return 0;
+    }
+    p = (fxpar_t *)calloc(1, sizeof(fxpar_t));
+    p->fd = fd, p->data = (const char *)data, p->size = st.st_size;
+    for (i = 0; i < p->size && p->data[i] != '>' && p->data[i] != '@'; ++i);
+    if (((unsigned char)p->data[0] == 0x1f && (unsigned char)p->data[1] == 0x8b) || i == p->size) {
+        munmap(data, p->size); /* gzip'd, or no records: leave it to the serial reader */
+        close(fd);
+        free(p);
+        return 0;
+    }
+    p->is_fq = p->data[i] == '@';
+    p->n_block = (p->size + FX_BLOCK_SIZE - 1) / FX_BLOCK_SIZE;
+    p->blk = (fxblock_t *)calloc(p->n_block, sizeof(fxblock_t));
+    p->n_threads = n_threads < p->n_block ? n_threads : p->n_block;
+    p->window = 2 * n_threads;
+    madvise(data, p->size, MADV_SEQUENTIAL);
+    pthread_mutex_init(&p->lock, 0);
+    pthread_cond_init(&p->cv, 0);
+    p->tid = (pthread_t *)calloc(p->n_threads, sizeof(pthread_t));
+    for (i = 0; i < (size_t)p->n_threads; ++i)
+        pthread_create(&p->tid[i], 0, fx_worker, p);
+    return p;
+}
+
+int fxpar_next(fxpar_t *p, char **rec, size_t *len)
+{
+    fxblock_t *b;
+
+    while (p->cur < p->n_block) {
+        b = &p->blk[p->cur];
+        if (p->pos == 0) { /* wait for the block to be parsed */
+            pthread_mutex_lock(&p->lock);
+            while (!b->done)
+                pthread_cond_wait(&p->cv, &p->lock);
+            pthread_mutex_unlock(&p->lock);
+        }
+        if (p->pos < b->l) {
+            *rec = b->rec + p->pos;
+            *len = strlen(*rec);
+            p->pos += *len + 1;
+            return *len;
+        }
+        if (b->err) { /* as kseq_read() in bio_getrec(): end of this file */
+            p->cur = p->n_block;
+            break;
+        }
+        free(b->rec);
+        b->rec = 0;
+        p->pos = 0;
+        pthread_mutex_lock(&p->lock);
+        p->cur++;
+        pthread_cond_broadcast(&p->cv);
+        pthread_mutex_unlock(&p->lock);
+    }
+    return -1;
+}
+
+void fxpar_close(fxpar_t *p)
+{
+    int i;
+
+    pthread_mutex_lock(&p->lock);
+    p->stop = 1;
+    pthread_cond_broadcast(&p->cv);
+    pthread_mutex_unlock(&p->lock);
+    for (i = 0; i < p->n_threads; ++i)
+        pthread_join(p->tid[i], 0);
+    for (i = 0; i < p->n_block; ++i)
+        free(p->blk[i].rec);
+    free(p->blk);
+    free(p->tid);
+    pthread_cond_destroy(&p->cv);
+    pthread_mutex_destroy(&p->lock);
+    munmap((void *)p->data, p->size);
+    close(p->fd);
+    free(p);
+}
@@ -0,0 +1,20 @@
+#ifndef FXPAR_H
+#define FXPAR_H
+
+#include <stddef.h>
+
+/* Parallel reader for a single uncompressed FASTA/FASTQ file (-j option).
+ * The file is mapped and cut into fixed size blocks. Each worker thread
+ * moves the start of its block forward to the next record boundary and
+ * parses the records starting in the block with its own kseq. Blocks are
+ * handed to the caller in file order, so records come back in the same
+ * order and with the same layout (name\tseq\tqual\tcomment) as the serial
+ * reader in bio_getrec(). */
+
+typedef struct fxpar_s fxpar_t;
+
+fxpar_t *fxpar_open(const char *fn, int n_threads); /* NULL if fn can't be read this way */
+int fxpar_next(fxpar_t *p, char **rec, size_t *len); /* >= 0 for a record, < 0 at end */
+void fxpar_close(fxpar_t *p);
+
+#endif
@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "ivl.h"
+
+typedef struct {
+    long beg, end, max; /* max is the largest end in the subtree */
+    size_t txt;         /* offset of the line in the text arena */
+    int ctg;
+} ivl_t;
+
+typedef struct ivlset_s {
+    char *name;
+    ivl_t *a;
+    size_t n, m;
+    char *txt;          /* the lines, each ended by a NUL */
+    size_t ntxt, mtxt;
+    char **ctg;         /* contig names */
+    int nctg, mctg;
+    int *hash;          /* open addressing on contig names, -1 for empty; size a power of 2 */
+    int hsize;
+    size_t *off;        /* after indexing, contig c is a[off[c] .. off[c+1]) */
+    int *level;         /* and the level of its root */
+    int indexed, last;  /* last contig looked up */
+    struct ivlset_s *next;
+} ivlset_t;
+
+static ivlset_t *g_sets;
+
+static void *ivl_realloc(void *p, size_t n)
+{
+    if ((p = realloc(p, n)) == NULL) {
+        fprintf(stderr, "ivl: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static ivlset_t *set_find(const char *handle, int create)
+{
+    ivlset_t *s;
+    size_t n;
+
+    for (s = g_sets; s; s = s->next)
+        if (strcmp(s->name, handle) == 0) return s;
+    if (!create)
+        return NULL;
+    s = (ivlset_t *) ivl_realloc(NULL, sizeof(ivlset_t));
+    memset(s, 0, sizeof(ivlset_t));
+    n = strlen(handle) + 1;
+    s->name = (char *) memcpy(ivl_realloc(NULL, n), handle, n);
+    s->last = -1;
+    s->next = g_sets;
+    g_sets = s;
+    return s;
+}
+
+static unsigned hash_str(const char *s, size_t n)
+{
+    unsigned h = 2166136261u;
+    while (n--)
+        h = (h ^ (unsigned char)*s++) * 16777619u;
+    return h;
+}
+
+/* the number of contig name s[0..n), a new one if create, else -1 if unknown */
+static int ctg_id(ivlset_t *s, const char *name, size_t n, int create)
+{
+    unsigned j;
+    int c, i;
+
+    if (s->last >= 0 && strncmp(s->ctg[s->last], name, n) == 0 && s->ctg[s->last][n] == '\0')
+        return s->last;
+    if (s->hsize > 0) {
+        for (j = hash_str(name, n) & (s->hsize - 1); (c = s->hash[j]) >= 0; j = (j + 1) & (s->hsize - 1))
+            if (strncmp(s->ctg[c], name, n) == 0 && s->ctg[c][n] == '\0')
+                return s->last = c;
+    }
+    if (!create)
+        return -1;
+    if (s->nctg == s->mctg) {
+        s->mctg = s->mctg ? s->mctg * 2 : 16;
+        s->ctg = (char **) ivl_realloc(s->ctg, s->mctg * sizeof(char *));
+    }
+    s->ctg[c = s->nctg++] = (char *) ivl_realloc(NULL, n + 1);
+    memcpy(s->ctg[c], name, n);
+    s->ctg[c][n] = '\0';
+    if (s->nctg * 2 > s->hsize) { // rehash at half full
+        s->hsize = s->hsize ? s->hsize * 2 : 64;
+        s->hash = (int *) ivl_realloc(s->hash, s->hsize * sizeof(int));
+        memset(s->hash, -1, s->hsize * sizeof(int));
+        for (i = 0; i < s->nctg; ++i) {
+            for (j = hash_str(s->ctg[i], strlen(s->ctg[i])) & (s->hsize - 1); s->hash[j] >= 0; j = (j + 1) & (s->hsize - 1))
+                ;
+            s->hash[j] = i;
+        }
+    } else {
+        for (j = hash_str(name, n) & (s->hsize - 1); s->hash[j] >= 0; j = (j + 1) & (s->hsize - 1))
+            ;
+        s->hash[j] = c;
+    }
+    s->indexed = 0;
+    return s->last = c;
+}
+
+static int add_line(ivlset_t *s, const char *line, size_t n, const ivl_cols_t *cols)
+{
+    const char *f[3] = { NULL, NULL, NULL }, *p = line, *end = line + n, *q;
+    size_t flen[3] = { 0, 0, 0 };
+    int col, k, ncol = cols->chrom > cols->beg ? cols->chrom : cols->beg;
+    long beg, e;
+    char *ep;
+    ivl_t *iv;
+
+    if (n > 0 && line[n - 1] == '\r')
+        end = line + --n;
+    if (n == 0 || *line == '#' || strncmp(line, "track", 5) == 0 || strncmp(line, "browser", 7) == 0)
+        return 0;
+    if (cols->end > ncol)
+        ncol = cols->end;
+    for (col = 0; col <= ncol && p <= end; ++col, p = q + 1) {
+        if ((q = (const char *) memchr(p, '\t', end - p)) == NULL)
+            q = end;
+        k = col == cols->chrom ? 0 : col == cols->beg ? 1 : col == cols->end ? 2 : -1;
+        if (k >= 0)
+            f[k] = p, flen[k] = q - p;
+    }
+    if (f[0] == NULL || f[1] == NULL || f[2] == NULL || flen[0] == 0)
+        return 0;
+    beg = strtol(f[1], &ep, 10);
+    if (ep != f[1] + flen[1] || flen[1] == 0)
+        return 0;
+    e = strtol(f[2], &ep, 10);
+    if (ep != f[2] + flen[2] || flen[2] == 0)
+        return 0;
+    if (cols->one_based)
+        --beg;
+    if (s->n == s->m) {
+        s->m = s->m ? s->m * 2 : 1024;
+        s->a = (ivl_t *) ivl_realloc(s->a, s->m * sizeof(ivl_t));
+    }
+    if (s->ntxt + n + 1 > s->mtxt) {
+        s->mtxt = s->ntxt + n + 1 > 2 * s->mtxt ? s->ntxt + n + 1 : 2 * s->mtxt;
+        s->txt = (char *) ivl_realloc(s->txt, s->mtxt);
+    }
+    iv = &s->a[s->n++];
+    iv->ctg = ctg_id(s, f[0], flen[0], 1);
+    iv->beg = beg, iv->end = e;
+    iv->txt = s->ntxt;
+    memcpy(s->txt + s->ntxt, line, n);
+    s->txt[s->ntxt + n] = '\0';
+    s->ntxt += n + 1;
+    s->indexed = 0;
+    return 1;
+}
+
+int ivl_add_line(const char *handle, const char *line, size_t n, const ivl_cols_t *cols)
+{
+    return add_line(set_find(handle, 1), line, n, cols);
+}
+
+long ivl_load_file(const char *handle, const char *file, const ivl_cols_t *cols)
+{
+    ivlset_t *s;
+    gzFile fp;
+    char *buf = NULL;
+    size_t size = 0, len;
+    long n = 0;
+
+    if ((fp = strcmp(file, "-") == 0 ? gzdopen(0, "r") : gzopen(file, "r")) == NULL)
+        return -1;
+    s = set_find(handle, 1);
+    for (;;) {
+        len = 0;
+        do { // a whole line, however long
+            if (size - len < 2) {
+                size = size ? size * 2 : 4096;
+                buf = (char *) ivl_realloc(buf, size);
+            }
+            if (gzgets(fp, buf + len, size - len) == NULL)
+                break;
+            len += strlen(buf + len);
+        } while (len > 0 && buf[len - 1] != '\n');
+        if (len == 0)
+            break;
+        if (buf[len - 1] == '\n')
+            --len;
+        n += add_line(s, buf, len, cols);
+    }
+    free(buf);
+    gzclose(fp);
+    return n;
+}
+
+static int cmp_ivl(const void *x, const void *y)
+{
+    const ivl_t *a = (const ivl_t *) x, *b = (const ivl_t *) y;
+    if (a->ctg != b->ctg) return a->ctg < b->ctg ? -1 : 1;
+    if (a->beg != b->beg) return a->beg < b->beg ? -1 : 1;
+    return a->end < b->end ? -1 : a->end > b->end;
+}
+
+/* sets max over a[0..n) taken as the in-order walk of a complete binary
+ * tree; leaves are at even i, level k nodes at i = 2^k - 1 + j*2^(k+1).
+ * Returns the level of the root. */
+static int index_ctg(ivl_t *a, long n)
+{
+    long i, last_i = 0, x, step;
+    long last = 0, e, el, er;
+    int k;
+
+    if (n <= 0)
+        return -1;
+    for (i = 0; i < n; i += 2)
+        last_i = i, last = a[i].max = a[i].end;
+    for (k = 1; 1L << k <= n; ++k) {
+        x = 1L << (k - 1), step = x << 2;
+        for (i = (x << 1) - 1; i < n; i += step) {
+            el = a[i - x].max;
+            er = i + x < n ? a[i + x].max : last; // a right child past the end stands for the last node
+            e = a[i].end;
+            e = e > el ? e : el;
+            a[i].max = e > er ? e : er;
+        }
+        last_i = last_i >> k & 1 ? last_i - x : last_i + x;
+        if (last_i < n && a[last_i].max > last)
+            last = a[last_i].max;
+    }
+    return k - 1;
+}
+
+static void index_set(ivlset_t *s)
+{
+    size_t i;
+    int c;
+
+    qsort(s->a, s->n, sizeof(ivl_t), cmp_ivl);
+    s->off = (size_t *) ivl_realloc(s->off, (s->nctg + 1) * sizeof(size_t));
+    s->level = (int *) ivl_realloc(s->level, (s->nctg + 1) * sizeof(int));
+    for (c = 0, i = 0; c < s->nctg; ++c) {
+        s->off[c] = i;
+        while (i < s->n && s->a[i].ctg == c)
+            ++i;
+        s->level[c] = index_ctg(s->a + s->off[c], i - s->off[c]);
+    }
+    s->off[c] = i;
+    s->indexed = 1;
+}
+
+long ivl_overlap(const char *handle, const char *chrom, long beg, long end, ivl_fn fn, void *data)
+{
+    struct { long x; int k, w; } stack[64], z;
+    ivlset_t *s = set_find(handle, 0);
+    ivl_t *a;
+    long n, i, i0, i1, y, cnt = 0;
+    int c, t = 0;
+
+    if (s == NULL)
+        return -1;
+    if ((c = ctg_id(s, chrom, strlen(chrom), 0)) < 0)
+        return 0;
+    if (!s->indexed)
+        index_set(s);
+    a = s->a + s->off[c];
+    n = s->off[c + 1] - s->off[c];
+    if (n == 0)
+        return 0;
+    stack[t].k = s->level[c], stack[t].x = (1L << s->level[c]) - 1, stack[t++].w = 0; // the root
+    while (t > 0) {
+        z = stack[--t];
+        if (z.k <= 3) { // a small subtree: scan it
+            i0 = z.x >> z.k << z.k;
+            i1 = i0 + (1L << (z.k + 1)) - 1;
+            if (i1 > n) i1 = n;
+            for (i = i0; i < i1 && a[i].beg < end; ++i)
+                if (beg < a[i].end) {
+                    if (fn) fn(s->txt + a[i].txt, strlen(s->txt + a[i].txt), data);
+                    ++cnt;
+                }
+        } else if (z.w == 0) { // the left child first
+            y = z.x - (1L << (z.k - 1));
+            stack[t].k = z.k, stack[t].x = z.x, stack[t++].w = 1;
+            if (y >= n || a[y].max > beg)
+                stack[t].k = z.k - 1, stack[t].x = y, stack[t++].w = 0;
+        } else if (z.x < n && a[z.x].beg < end) { // then the node and its right child
+            if (beg < a[z.x].end) {
+                if (fn) fn(s->txt + a[z.x].txt, strlen(s->txt + a[z.x].txt), data);
+                ++cnt;
+            }
+            stack[t].k = z.k - 1, stack[t].x = z.x + (1L << (z.k - 1)), stack[t++].w = 0;
+        }
+    }
+    return cnt;
+}
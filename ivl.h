@@ -0,0 +1,29 @@
+#ifndef IVL_H
+#define IVL_H
+
+#include <stddef.h>
+
+/* Interval overlap for ivl_load() and ivl_overlap(). The features under a
+ * handle are kept in one array sorted by contig and start, each contig an
+ * implicit interval tree: the array is the in-order walk of a complete
+ * binary tree, and each node holds the largest end below it, so a query
+ * takes O(log n + k) with no pointers to chase. */
+
+typedef struct ivl_cols {
+    int chrom, beg, end; /* 0-based column numbers */
+    int one_based;       /* 1-based start, end included, as in GFF */
+} ivl_cols_t;
+
+typedef void (*ivl_fn)(const char *line, size_t n, void *data);
+
+/* Adds the feature on a line, 0-based and end not included unless
+ * cols->one_based; headers and lines without the columns are skipped.
+ * Returns 1 if added. */
+int ivl_add_line(const char *handle, const char *line, size_t n, const ivl_cols_t *cols);
+long ivl_load_file(const char *handle, const char *file, const ivl_cols_t *cols); /* features added, -1 if file can't be read */
+
+/* Calls fn with the line of each feature overlapping [beg, end) of chrom,
+ * in order of start. Returns how many, -1 for an unknown handle. */
+long ivl_overlap(const char *handle, const char *chrom, long beg, long end, ivl_fn fn, void *data);
+
+#endif
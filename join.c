@@ -0,0 +1,303 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "join.h"
+
+#include "kseq.h"
+
+KSEQ_INIT(gzFile, gzread)
+
+#define JOIN_MAX_KEYS 16
+
+typedef struct {
+    const char *s;
+    size_t l;
+} field_t;
+
+typedef struct join_s {
+    char *name;
+    gzFile fp;
+    kseq_t *ks;
+    int is_stdin;
+    join_fmt_t fmt;
+    int col[JOIN_MAX_KEYS], ncol; /* 0-based key columns */
+    int num[JOIN_MAX_KEYS];       /* compared as numbers, for col:n */
+    kstring_t rec;      /* the record read ahead, if held */
+    field_t key[JOIN_MAX_KEYS];
+    int held, eof;
+    kstring_t last;     /* the key last asked for, if started */
+    int started, warned;
+    char *grp;          /* the records with that key, each ended by a NUL */
+    size_t ngrp, mgrp;
+    long cnt;
+    struct join_s *next;
+} join_t;
+
+static join_t *g_joins;
+
+static void *join_realloc(void *p, size_t n)
+{
+    if ((p = realloc(p, n)) == NULL) {
+        fprintf(stderr, "join: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static join_t *join_find(const char *handle, int create)
+{
+    join_t *j;
+    size_t n;
+
+    for (j = g_joins; j; j = j->next)
+        if (strcmp(j->name, handle) == 0) return j;
+    if (!create)
+        return NULL;
+    j = (join_t *) join_realloc(NULL, sizeof(join_t));
+    memset(j, 0, sizeof(join_t));
+    n = strlen(handle) + 1;
+    j->name = (char *) memcpy(join_realloc(NULL, n), handle, n);
+    j->next = g_joins;
+    g_joins = j;
+    return j;
+}
+
+static void join_close(join_t *j)
+{
+    if (j->ks) {
+        kseq_destroy(j->ks);
+        if (!j->is_stdin)
+            gzclose(j->fp);
+    }
+    j->fp = 0, j->ks = 0;
+    j->held = j->eof = j->started = j->warned = 0;
+    j->ngrp = 0, j->cnt = 0;
+}
+
+/* reads the next record into j->rec; -1 at the end */
+static int read_rec(join_t *j)
+{
+    kseq_t *ks = j->ks;
+    int dret;
+
+    if (j->eof)
+        return -1;
+    for (;;) {
+        if (j->fmt.fastx) {
+            if (kseq_read(ks) < 0)
+                break;
+            j->rec.l = 0;
+            if (j->rec.m < ks->name.l + ks->seq.l + ks->qual.l + ks->comment.l + 4) {
+                j->rec.m = ks->name.l + ks->seq.l + ks->qual.l + ks->comment.l + 4;
+                kroundup32(j->rec.m);
+                j->rec.s = (char *) join_realloc(j->rec.s, j->rec.m);
+            }
+            memcpy(j->rec.s, ks->name.s, ks->name.l), j->rec.l += ks->name.l;
+            j->rec.s[j->rec.l++] = '\t';
+            memcpy(j->rec.s + j->rec.l, ks->seq.s, ks->seq.l), j->rec.l += ks->seq.l;
+            j->rec.s[j->rec.l++] = '\t';
+            memcpy(j->rec.s + j->rec.l, ks->qual.s, ks->qual.l), j->rec.l += ks->qual.l;
+            j->rec.s[j->rec.l++] = '\t';
+            memcpy(j->rec.s + j->rec.l, ks->comment.s, ks->comment.l), j->rec.l += ks->comment.l;
+            j->rec.s[j->rec.l] = '\0';
+            return 0;
+        }
+        if (ks_getuntil(ks->f, KS_SEP_LINE, &j->rec, &dret) < 0)
+            break;
+        if (j->rec.l > 0 && !(j->fmt.hdr && j->rec.s[0] == j->fmt.hdr))
+            return 0;
+    }
+    j->eof = 1;
+    return -1;
+}
+
+/* the fields of s[0..n) at the columns of j, missing ones empty */
+static void split_rec(const join_t *j, const char *s, size_t n, field_t *f)
+{
+    const char *p = s, *end = s + n, *q;
+    int col, k;
+
+    for (k = 0; k < j->ncol; ++k)
+        f[k].s = end, f[k].l = 0;
+    for (col = 0; ; ++col) {
+        if (!j->fmt.tabs)
+            while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        for (q = p; q < end && (j->fmt.tabs ? *q != '\t' : *q != ' ' && *q != '\t'); ++q)
+            ;
+        for (k = 0; k < j->ncol; ++k)
+            if (j->col[k] == col) f[k].s = p, f[k].l = q - p;
+        if (q == end)
+            break;
+        p = q + 1;
+    }
+}
+
+/* the parts of key separated by sep; the last of ncol takes the rest */
+static void split_key(const char *key, const char *sep, int ncol, field_t *f)
+{
+    size_t ls = strlen(sep);
+    const char *q;
+    int k;
+
+    for (k = 0; k < ncol; ++k) {
+        f[k].s = key;
+        if (k == ncol - 1 || ls == 0 || (q = strstr(key, sep)) == NULL) {
+            f[k].l = strlen(key);
+            key += f[k].l;
+        } else {
+            f[k].l = q - key;
+            key = q + ls;
+        }
+    }
+}
+
+/* the number at the start of f, 0 if none, as sort -n takes it */
+static double num_of(const field_t *f)
+{
+    char buf[64];
+
+    if (f->l == 0 || !(isdigit((unsigned char)f->s[0]) || f->s[0] == '-' || f->s[0] == '+' || f->s[0] == '.'))
+        return 0;
+    memcpy(buf, f->s, f->l < sizeof(buf) ? f->l : sizeof(buf) - 1);
+    buf[f->l < sizeof(buf) ? f->l : sizeof(buf) - 1] = '\0';
+    return strtod(buf, NULL);
+}
+
+/* bytewise, or for a numeric column by value and then bytewise, so
+ * that only equal bytes compare equal */
+static int cmp_keys(const join_t *j, const field_t *a, const field_t *b)
+{
+    double x, y;
+    size_t l;
+    int k, c;
+
+    for (k = 0; k < j->ncol; ++k) {
+        if (j->num[k] && (x = num_of(&a[k])) != (y = num_of(&b[k])))
+            return x < y ? -1 : 1;
+        l = a[k].l < b[k].l ? a[k].l : b[k].l;
+        if ((c = memcmp(a[k].s, b[k].s, l)) != 0)
+            return c;
+        if (a[k].l != b[k].l)
+            return a[k].l < b[k].l ? -1 : 1;
+    }
+    return 0;
+}
+
+/* the column number of name, 1-based or in names, or -1 */
+static int col_of(const char *name, size_t n, const char *const *names, const char *hline)
+{
+    const char *p, *q;
+    int i;
+
+    for (i = 0; (size_t)i < n && isdigit((unsigned char)name[i]); ++i)
+        ;
+    if (i == (int)n && n > 0)
+        return atoi(name) > 0 ? atoi(name) - 1 : -1;
+    if (hline) { // names from the first line, split by blanks as for -c header
+        for (i = 0, p = hline; *p; ++i, p = q) {
+            while (isspace((unsigned char)*p)) ++p;
+            if (*p == '\0')
+                break;
+            for (q = p; *q && !isspace((unsigned char)*q); ++q)
+                ;
+            if ((size_t)(q - p) == n && strncmp(p, name, n) == 0)
+                return i;
+        }
+    } else if (names) {
+        for (i = 1; names[i]; ++i)
+            if (strlen(names[i]) == n && strncmp(names[i], name, n) == 0)
+                return i - 1;
+    }
+    return -1;
+}
+
+int join_open(const char *handle, const char *file, const char *cols, const join_fmt_t *fmt)
+{
+    join_t *j = join_find(handle, 1);
+    const char *p, *q;
+    char *hline = NULL;
+    int dret;
+
+    join_close(j);
+    j->is_stdin = strcmp(file, "-") == 0;
+    if ((j->fp = j->is_stdin ? gzdopen(0, "r") : gzopen(file, "r")) == NULL)
+        return -1;
+    j->ks = kseq_init(j->fp);
+    j->fmt = *fmt;
+    if (fmt->header && ks_getuntil(j->ks->f, KS_SEP_LINE, &j->rec, &dret) >= 0)
+        hline = j->rec.s;
+    for (j->ncol = 0, p = cols; j->ncol < JOIN_MAX_KEYS; p = q + 1) {
+        if ((q = strchr(p, ',')) == NULL)
+            q = p + strlen(p);
+        j->num[j->ncol] = q - p > 2 && strncmp(q - 2, ":n", 2) == 0;
+        if ((j->col[j->ncol] = col_of(p, q - p - 2 * j->num[j->ncol], fmt->names, hline)) < 0) {
+            join_close(j);
+            return -2;
+        }
+        ++j->ncol;
+        if (*q == '\0')
+            break;
+    }
+    return 0;
+}
+
+static void add_grp(join_t *j)
+{
+    if (j->ngrp + j->rec.l + 1 > j->mgrp) {
+        j->mgrp = j->ngrp + j->rec.l + 1 > 2 * j->mgrp ? j->ngrp + j->rec.l + 1 : 2 * j->mgrp;
+        j->grp = (char *) join_realloc(j->grp, j->mgrp);
+    }
+    memcpy(j->grp + j->ngrp, j->rec.s, j->rec.l + 1);
+    j->ngrp += j->rec.l + 1;
+    ++j->cnt;
+}
+
+long join_next(const char *handle, const char *key, const char *sep, join_fn fn, void *data)
+{
+    join_t *j = join_find(handle, 0);
+    field_t kf[JOIN_MAX_KEYS], lf[JOIN_MAX_KEYS];
+    size_t i, n;
+    int c = 0;
+
+    if (j == NULL || j->ks == NULL)
+        return -1;
+    split_key(key, sep, j->ncol, kf);
+    if (j->started) {
+        split_key(j->last.s, sep, j->ncol, lf);
+        if ((c = cmp_keys(j, kf, lf)) < 0) {
+            if (j->warned)
+                return 0;
+            j->warned = 1;
+            return -2;
+        }
+    }
+    if (!j->started || c > 0) { // a new key: move on to it
+        n = strlen(key);
+        if (j->last.m < n + 1) {
+            j->last.m = n + 1;
+            j->last.s = (char *) join_realloc(j->last.s, j->last.m);
+        }
+        memcpy(j->last.s, key, n + 1);
+        j->started = 1;
+        j->ngrp = 0, j->cnt = 0;
+        for (;;) {
+            if (!j->held) {
+                if (read_rec(j) < 0)
+                    break;
+                split_rec(j, j->rec.s, j->rec.l, j->key);
+                j->held = 1;
+            }
+            if ((c = cmp_keys(j, j->key, kf)) > 0)
+                break;
+            if (c == 0)
+                add_grp(j);
+            j->held = 0;
+        }
+    }
+    if (fn)
+        for (i = 0; i < j->ngrp; i += n + 1)
+            fn(j->grp + i, n = strlen(j->grp + i), data);
+    return j->cnt;
+}
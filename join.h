@@ -0,0 +1,36 @@
+#ifndef JOIN_H
+#define JOIN_H
+
+#include <stddef.h>
+
+/* Merge join for join_open() and join_next(). A handle reads a second file
+ * one record at a time, in step with the keys it is asked for: records
+ * whose key comes before the asked key are dropped, those equal to it are
+ * handed back, and the first one after it is held for the next call. Both
+ * inputs must be sorted the same way, so memory is one group of records
+ * with the same key whatever the size of the file. */
+
+typedef struct join_fmt {
+    int fastx;                  /* FASTA/FASTQ, a record is name\tseq\tqual\tcomment */
+    int tabs;                   /* fields are split by tabs, else by runs of blanks */
+    char hdr;                   /* lines starting with this are skipped, 0 for none */
+    int header;                 /* the first line has the column names */
+    const char *const *names;   /* else names[1], ... of the columns, NULL ended */
+} join_fmt_t;
+
+typedef void (*join_fn)(const char *rec, size_t n, void *data);
+
+/* (Re)opens file ("-" for stdin) under handle, keyed by cols: a column
+ * number or name, or several separated by commas, each followed by ":n"
+ * if it is sorted as numbers. Returns 0, -1 if file can't be read or -2
+ * if a key column isn't known. */
+int join_open(const char *handle, const char *file, const char *cols, const join_fmt_t *fmt);
+
+/* Calls fn with each record whose key has the same bytes as key, several
+ * key columns being separated by sep in key. Keys are ordered column by
+ * column, bytewise or by value for a ":n" column. Returns how many, -1
+ * for an unknown handle, or -2 (once) if key comes before the last one
+ * asked for. */
+long join_next(const char *handle, const char *key, const char *sep, join_fn fn, void *data);
+
+#endif
@@ -0,0 +1,144 @@
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "kmer.h"
+#include "seqpack.h"
+
+typedef struct kmertab_s {
+    char *name;
+    int k, canonical;
+    uint64_t *key;
+    uint32_t *cnt;  /* 0 marks an empty slot */
+    size_t n, size; /* size is a power of 2 */
+    struct kmertab_s *next;
+} kmertab_t;
+
+static kmertab_t *g_tabs;
+
+static const unsigned char nt2[256] = { /* ACGT => 1..4, 0 for anything else */
+    ['A'] = 1, ['C'] = 2, ['G'] = 3, ['T'] = 4,
+    ['a'] = 1, ['c'] = 2, ['g'] = 3, ['t'] = 4
+};
+static const unsigned char nib2[16] = { [1] = 1, [2] = 2, [4] = 3, [8] = 4 }; /* seqpack codes */
+
+static inline uint64_t hash64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static void tab_resize(kmertab_t *t, size_t size)
+{
+    uint64_t *key = t->key;
+    uint32_t *cnt = t->cnt;
+    size_t i, j, old = t->size;
+
+    t->size = size;
+    t->key = (uint64_t *)malloc(size * sizeof(uint64_t));
+    t->cnt = (uint32_t *)calloc(size, sizeof(uint32_t));
+    for (i = 0; i < old; ++i) {
+        if (cnt[i] == 0) continue;
+        for (j = hash64(key[i]) & (size - 1); t->cnt[j]; j = (j + 1) & (size - 1));
+        t->key[j] = key[i];
+        t->cnt[j] = cnt[i];
+    }
+    free(key);
+    free(cnt);
+}
+
+static inline void tab_add(kmertab_t *t, uint64_t x)
+{
+    size_t j;
+
+    for (j = hash64(x) & (t->size - 1); t->cnt[j]; j = (j + 1) & (t->size - 1))
+        if (t->key[j] == x) {
+            if (t->cnt[j] != UINT32_MAX) t->cnt[j]++;
+            return;
+        }
+    t->key[j] = x;
+    t->cnt[j] = 1;
+    if (++t->n * 10 > t->size * 7) /* keep the load under 0.7 */
+        tab_resize(t, t->size * 2);
+}
+
+static kmertab_t *tab_find(const char *handle)
+{
+    kmertab_t *t;
+
+    for (t = g_tabs; t; t = t->next)
+        if (strcmp(t->name, handle) == 0) return t;
+    return 0;
+}
+
+long kmer_count(const char *handle, const char *seq, int k, int canonical)
+{
+    kmertab_t *t;
+    uint64_t fwd = 0, rev = 0, mask = k < 32 ? (1ULL << 2*k) - 1 : ~0ULL;
+    size_t i, n;
+    int l = 0, shift = 2 * (k - 1), packed = seqpack_is(seq), c;
+    long added = 0;
+
+    canonical = canonical != 0;
+    if ((t = tab_find(handle)) == 0) {
+        t = (kmertab_t *)calloc(1, sizeof(kmertab_t));
+        t->name = strdup(handle);
+        t->k = k, t->canonical = canonical;
+        tab_resize(t, 1024);
+        t->next = g_tabs, g_tabs = t;
+    } else if (t->k != k || t->canonical != canonical)
+        return -1;
+    n = packed ? seqpack_len(seq) : strlen(seq);
+    for (i = 0; i < n; ++i) {
+        c = packed ? nib2[seqpack_nib(seq, i)] : nt2[(unsigned char)seq[i]];
+        if (c == 0) { /* N or other: start again after it */
+            l = 0;
+            continue;
+        }
+        --c;
+        fwd = (fwd << 2 | c) & mask;
+        rev = rev >> 2 | (uint64_t)(3 - c) << shift;
+        if (++l < k) continue;
+        tab_add(t, canonical && rev < fwd ? rev : fwd);
+        ++added;
+    }
+    return added;
+}
+
+typedef struct {
+    uint64_t key;
+    uint32_t cnt;
+} kmerpair_t;
+
+static int cmp_pair(const void *a, const void *b)
+{
+    uint64_t x = ((const kmerpair_t *)a)->key, y = ((const kmerpair_t *)b)->key;
+    return x < y ? -1 : x > y;
+}
+
+long kmer_dump(const char *handle, kmer_fn fn, void *data)
+{
+    kmertab_t *t;
+    kmerpair_t *p;
+    uint64_t x;
+    size_t i, m = 0;
+    char kmer[KMER_MAX_K + 1];
+    int b;
+
+    if ((t = tab_find(handle)) == 0) return -1;
+    p = (kmerpair_t *)malloc((t->n + 1) * sizeof(kmerpair_t));
+    for (i = 0; i < t->size; ++i)
+        if (t->cnt[i]) p[m].key = t->key[i], p[m++].cnt = t->cnt[i];
+    qsort(p, m, sizeof(kmerpair_t), cmp_pair); /* A < C < G < T, so this is k-mer order */
+    kmer[t->k] = '\0';
+    for (i = 0; i < m; ++i) {
+        for (b = t->k - 1, x = p[i].key; b >= 0; --b, x >>= 2)
+            kmer[b] = "ACGT"[x & 3];
+        fn(kmer, p[i].cnt, data);
+    }
+    free(p);
+    return m;
+}
@@ -0,0 +1,14 @@
+#ifndef KMER_H
+#define KMER_H
+
+/* K-mer counting for kmercount() and kmerdump(). Each handle names a table
+ * of 2-bit encoded k-mers (k <= 32) in an open addressing hash table. */
+
+#define KMER_MAX_K 32
+
+typedef void (*kmer_fn)(const char *kmer, unsigned long count, void *data);
+
+long kmer_count(const char *handle, const char *seq, int k, int canonical); /* -1 if k or canonical differ from the first call */
+long kmer_dump(const char *handle, kmer_fn fn, void *data); /* in k-mer order; -1 for an unknown handle */
+
+#endif
@@ -49,12 +49,20 @@ Keyword keywords[] ={	/* keep sorted: binary searched */
 	{ "NF",		VARNF,		VARNF },
 	{ "and",	BIO_FAND,	BLTIN },
     { "applytochars", BIO_APPLYCHARS, BLTIN }, /* applytochars(str, stmt_or_function) 03Aug2020 */
+	{ "array_load",	BIO_ARRAYLOAD,	BLTIN },  /* array_load(arr, file) */
+	{ "array_save",	BIO_ARRAYSAVE,	BLTIN },  /* array_save(arr, file) */
 	{ "atan2",	FATAN,		BLTIN },
+	{ "attr",	BIO_ATTR,	BLTIN },  /* attr(str, key[, kind]) one gff/gtf/sam attribute */
 	{ "break",	BREAK,		BREAK },
 	{ "charcount",  BIO_CHARCOUNT,  BLTIN }, /* charcount(str, ar_chars) -- returns val e.g. ar_chars["A"]=173 */
+	{ "cigar",	BIO_CIGAR,	BLTIN },  /* cigar(cigar_str, what[, md]) */
+	{ "cigar_blocks",	BIO_CIGARBLOCKS,	BLTIN },  /* cigar_blocks(cigar_str, pos, arr) */
 	{ "close",	CLOSE,		CLOSE },
 	{ "continue",	CONTINUE,	CONTINUE },
 	{ "cos",	FCOS,		BLTIN },
+	{ "cov_add",	BIO_COVADD,	BLTIN },  /* cov_add(handle, chrom, beg, end[, weight]) */
+	{ "cov_emit",	BIO_COVEMIT,	BLTIN },  /* cov_emit(handle, file[, min_depth]) */
+	{ "crc32c",	BIO_CRC32C,	BLTIN },  /* crc32c(str[, crc]) */
 	{ "delete",	DELETE,		DELETE },
 	{ "do",		DO,		DO },
 	{ "edit_dist",	BIO_FEDLIB,	BLTIN }, /* edit_dist() support using edlib library */
@@ -64,6 +72,7 @@ Keyword keywords[] ={	/* keep sorted: binary searched */
 	{ "exp",	FEXP,		BLTIN },
 	{ "fflush",	FFLUSH,		BLTIN },
     { "find_codons", BIO_CODONSFIND, BLTIN },
+	{ "findall",	BIO_FINDALL,	BLTIN },  /* findall(text, needle, pos_arr) */
     { "fldcat", BIO_FLDCAT, BLTIN },
 	{ "for",	FOR,		FOR },
 	{ "func",	FUNC,		FUNC },
@@ -78,15 +87,25 @@ Keyword keywords[] ={	/* keep sorted: binary searched */
 	{ "in",		IN,		IN },
 	{ "index",	INDEX,		INDEX },
 	{ "int",	FINT,		BLTIN },
+	{ "ivl_load",	BIO_IVLLOAD,	BLTIN },  /* ivl_load(handle, file_or_arr[, fmt]) */
+	{ "ivl_overlap",	BIO_IVLOVERLAP,	BLTIN },  /* ivl_overlap(handle, chrom, beg, end[, arr]) */
+	{ "join_next",	BIO_JOINNEXT,	BLTIN },  /* join_next(handle, key[, arr]) */
+	{ "join_open",	BIO_JOINOPEN,	BLTIN },  /* join_open(handle, file, keycol[, fmt]) */
+	{ "kmercount",	BIO_KMERCOUNT,	BLTIN },  /* kmercount(seq, k, handle[, canonical]) */
+	{ "kmerdump",	BIO_KMERDUMP,	BLTIN },  /* kmerdump(handle, arr|file) */
 	{ "length",	FLENGTH,	BLTIN },
+	{ "load_table",	BIO_LOADTABLE,	BLTIN },  /* load_table(file, arr, keycol, valcol[, fs]) */
 	{ "log",	FLOG,		BLTIN },
 	{ "match",	MATCHFCN,	MATCHFCN },
 	{ "md5",	BIO_FMD5,	BLTIN },
+	{ "md5_final",	BIO_MD5FINAL,	BLTIN },  /* md5_final(handle) */
+	{ "md5_update",	BIO_MD5UPDATE,	BLTIN },  /* md5_update(handle, str) */
 	{ "meanqual",	BIO_FMEANQUAL,	BLTIN },
 	{ "modstr", 	BIO_MODSTR,	BLTIN },
 	{ "next",	NEXT,		NEXT },
 	{ "nextfile",	NEXTFILE,	NEXTFILE },
 	{ "or",		BIO_FOR,	BLTIN },
+	{ "orfs",	BIO_ORFS,	BLTIN },  /* orfs(seq, min_len, arr[, table]) */
 	{ "print",	PRINT,		PRINT },
 	{ "printf",	PRINTF,		PRINTF },
 	{ "qualcount",	BIO_FQUALCOUNT,	BLTIN },
@@ -95,8 +114,13 @@ Keyword keywords[] ={	/* keep sorted: binary searched */
 	{ "revcomp",BIO_FREVCOMP, BLTIN },
 	{ "reverse",BIO_FREVERSE, BLTIN },
     { "samattr",BIO_SAMATTR, BLTIN },
+	{ "samtag",	BIO_SAMTAG,	BLTIN },  /* samtag(key[, sam_line]) one tag of $0 */
+	{ "samtag_array",	BIO_SAMTAGARRAY,	BLTIN },  /* samtag_array(key, arr[, sam_line]) */
+	{ "seqpack",	BIO_SEQPACK,	BLTIN },  /* seqpack(seq) packs a nucleotide string 2 bases per byte */
+	{ "sequnpack",	BIO_SEQUNPACK,	BLTIN },
 	{ "setat",	BIO_FSETAT, 	BLTIN },  /* setat() directly changes values in string by position JBH_CAS 06Mar2019 */
 	{ "sin",	FSIN,		BLTIN },
+	{ "sortkeys",	BIO_SORTKEYS,	BLTIN },  /* sortkeys(arr, out[, how]) */
 	{ "split",	SPLIT,		SPLIT },
 	{ "sprintf",	SPRINTF,	SPRINTF },
 	{ "sqrt",	FSQRT,		BLTIN },
@@ -107,10 +131,13 @@ Keyword keywords[] ={	/* keep sorted: binary searched */
 	{ "systime",    BIO_FSYSTIME,   BLTIN },  /* systime() return number of seconds since EPOCH (01Jan1970) JBH_CAS 12Aug2019 */
 	{ "tolower",	FTOLOWER,	BLTIN },
 	{ "toupper",	FTOUPPER,	BLTIN },
+	{ "tr",		BIO_TR,		BLTIN },  /* tr(str, from, to[, delete]) */
     { "translate", BIO_TRANSLATE, BLTIN },
+	{ "translate6",	BIO_TRANSLATE6,	BLTIN },  /* translate6(seq, arr[, table]) */
 	{ "trimq",	BIO_FTRIMQ,	BLTIN },
 	{ "while",	WHILE,		WHILE },
-	{ "xor",	BIO_FXOR,	BLTIN }
+	{ "xor",	BIO_FXOR,	BLTIN },
+	{ "xxh3",	BIO_XXH3,	BLTIN },  /* xxh3(str) */
 };
 
 #define	RET(x)	{ if(dbg)printf("lex %s\n", tokname(x)); return(x); }
@@ -31,6 +31,7 @@ THIS SOFTWARE.
 #include <stdarg.h>
 #include "awk.h"
 #include "ytab.h"
+#include "thrio.h"
 
 FILE	*infile	= NULL;
 char	*file	= "";
@@ -52,8 +53,8 @@ int	lastfld	= 0;	/* last used field */
 int	argno	= 1;	/* current input argument number */
 extern	Awkfloat *ARGC;
 
-static Cell dollar0 = { OCELL, CFLD, NULL, "", 0.0, REC|STR|DONTFREE };
-static Cell dollar1 = { OCELL, CFLD, NULL, "", 0.0, FLD|STR|DONTFREE };
+static Cell dollar0 = { OCELL, CFLD, REC|STR|DONTFREE, NULL, "", 0.0 };
+static Cell dollar1 = { OCELL, CFLD, FLD|STR|DONTFREE, NULL, "", 0.0 };
 
 void recinit(unsigned int n)
 {
@@ -142,6 +143,8 @@ int getrec(char **pbuf, int *pbufsize, int isrecord)	/* get next input record */
 				continue;
 			}
 			*FILENAME = file;
+			filenameloc->tval &= ~(SLEN|SREF|SGROW);	/* not set by setsval */
+			filenameloc->tval |= DONTFREE;
 			   dprintf( ("opening file %s\n", file) );
 			if (*file == '-' && *(file+1) == '\0')
 				infile = stdin;
@@ -153,8 +156,7 @@ int getrec(char **pbuf, int *pbufsize, int isrecord)	/* get next input record */
 		c = readrec(&buf, &bufsize, infile);
 		if (c != 0 || buf[0] != '\0') {	/* normal record */
 			if (isrecord) {
-				if (freeable(fldtab[0]))
-					xfree(fldtab[0]->sval);
+				freesval(fldtab[0]);
 				fldtab[0]->sval = buf;	/* buf == record */
 				fldtab[0]->tval = REC | STR | DONTFREE;
 				if (is_number(fldtab[0]->sval)) {
@@ -278,7 +280,7 @@ void fldbld(void)	/* create fields from current record */
 	if (!isstr(fldtab[0]))
 		getsval(fldtab[0]);
 	r = fldtab[0]->sval;
-	n = strlen(r);
+	n = getslen(fldtab[0]);
 	if (n > fieldssize) {
 		xfree(fields);
 		if ((fields = (char *) malloc(n+2)) == NULL) /* possibly 2 final \0s */
@@ -299,28 +301,26 @@ void fldbld(void)	/* create fields from current record */
 			i++;
 			if (i > nfields)
 				growfldtab(i);
-			if (freeable(fldtab[i]))
-				xfree(fldtab[i]->sval);
+			freesval(fldtab[i]);
 			fldtab[i]->sval = fr;
 			fldtab[i]->tval = FLD | STR | DONTFREE;
 			do
 				*fr++ = *r++;
 			while (*r != ' ' && *r != '\t' && *r != '\n' && *r != '\0');
+			fldtab[i]->slen = fr - fldtab[i]->sval;
+			fldtab[i]->tval |= SLEN;
 			*fr++ = 0;
 		}
 		*fr = 0;
 	} else if ((sep = *inputFS) == 0) {		/* new: FS="" => 1 char/field */
 		for (i = 0; *r != 0; r++) {
-			char buf[2];
 			i++;
 			if (i > nfields)
 				growfldtab(i);
-			if (freeable(fldtab[i]))
-				xfree(fldtab[i]->sval);
-			buf[0] = *r;
-			buf[1] = 0;
-			fldtab[i]->sval = tostring(buf);
-			fldtab[i]->tval = FLD | STR;
+			freesval(fldtab[i]);
+			fldtab[i]->tval = FLD | STR | SLEN;
+			setcellstr(fldtab[i], r, 1);
+			fldtab[i]->slen = 1;
 		}
 		*fr = 0;
 	} else if (*r != 0) {	/* if 0, it's a null field */
@@ -335,12 +335,13 @@ void fldbld(void)	/* create fields from current record */
 			i++;
 			if (i > nfields)
 				growfldtab(i);
-			if (freeable(fldtab[i]))
-				xfree(fldtab[i]->sval);
+			freesval(fldtab[i]);
 			fldtab[i]->sval = fr;
 			fldtab[i]->tval = FLD | STR | DONTFREE;
 			while (*r != sep && *r != rtest && *r != '\0')	/* \n is always a separator */
 				*fr++ = *r++;
+			fldtab[i]->slen = fr - fldtab[i]->sval;
+			fldtab[i]->tval |= SLEN;
 			*fr++ = 0;
 			if (*r++ == 0)
 				break;
@@ -375,10 +376,10 @@ void cleanfld(int n1, int n2)	/* clean out fields n1 .. n2 inclusive */
 
 	for (i = n1; i <= n2; i++) {
 		p = fldtab[i];
-		if (freeable(p))
-			xfree(p->sval);
+		freesval(p);
 		p->sval = "";
-		p->tval = FLD | STR | DONTFREE;
+		p->slen = 0;
+		p->tval = FLD | STR | DONTFREE | SLEN;
 	}
 }
 
@@ -443,8 +444,7 @@ int refldbld(const char *rec, const char *fs)	/* build fields from reg expr in F
 	for (i = 1; ; i++) {
 		if (i > nfields)
 			growfldtab(i);
-		if (freeable(fldtab[i]))
-			xfree(fldtab[i]->sval);
+		freesval(fldtab[i]);
 		fldtab[i]->tval = FLD | STR | DONTFREE;
 		fldtab[i]->sval = fr;
 		   dprintf( ("refldbld: i=%d\n", i) );
@@ -452,6 +452,8 @@ int refldbld(const char *rec, const char *fs)	/* build fields from reg expr in F
 			pfa->initstat = 2;	/* horrible coupling to b.c */
 			   dprintf( ("match %s (%d chars)\n", patbeg, patlen) );
 			strncpy(fr, rec, patbeg-rec);
+			fldtab[i]->slen = patbeg - rec;
+			fldtab[i]->tval |= SLEN;
 			fr += patbeg - rec + 1;
 			*(fr-1) = '\0';
 			rec = patbeg + patlen;
@@ -469,21 +471,23 @@ void recbld(void)	/* create $0 from $1..$NF if necessary */
 {
 	int i;
 	char *r, *p;
+	size_t n, nofs = strlen(*OFS);
 
 	if (donerec == 1)
 		return;
 	r = record;
 	for (i = 1; i <= *NF; i++) {
 		p = getsval(fldtab[i]);
-		if (!adjbuf(&record, &recsize, 1+strlen(p)+r-record, recsize, &r, "recbld 1"))
+		n = getslen(fldtab[i]);
+		if (!adjbuf(&record, &recsize, 1+n+r-record, recsize, &r, "recbld 1"))
 			FATAL("created $0 `%.30s...' too long", record);
-		while ((*r = *p++) != 0)
-			r++;
+		memcpy(r, p, n);
+		r += n;
 		if (i < *NF) {
-			if (!adjbuf(&record, &recsize, 2+strlen(*OFS)+r-record, recsize, &r, "recbld 2"))
+			if (!adjbuf(&record, &recsize, 2+nofs+r-record, recsize, &r, "recbld 2"))
 				FATAL("created $0 `%.30s...' too long", record);
-			for (p = *OFS; (*r = *p++) != 0; )
-				r++;
+			memcpy(r, *OFS, nofs);
+			r += nofs;
 		}
 	}
 	if (!adjbuf(&record, &recsize, 2+r-record, recsize, &r, "recbld 3"))
@@ -491,10 +495,10 @@ void recbld(void)	/* create $0 from $1..$NF if necessary */
 	*r = '\0';
 	   dprintf( ("in recbld inputFS=%s, fldtab[0]=%p\n", inputFS, (void*)fldtab[0]) );
 
-	if (freeable(fldtab[0]))
-		xfree(fldtab[0]->sval);
-	fldtab[0]->tval = REC | STR | DONTFREE;
+	freesval(fldtab[0]);
+	fldtab[0]->tval = REC | STR | DONTFREE | SLEN;
 	fldtab[0]->sval = record;
+	fldtab[0]->slen = r - record;
 
 	   dprintf( ("in recbld inputFS=%s, fldtab[0]=%p\n", inputFS, (void*)fldtab[0]) );
 	   dprintf( ("recbld = |%s|\n", record) );
@@ -568,7 +572,7 @@ void FATAL(const char *fmt, ...)
 	extern char *cmdname;
 	va_list varg;
 
-	fflush(stdout);
+	throut_sync();
 	fprintf(stderr, "%s: ", cmdname);
 	va_start(varg, fmt);
 	vfprintf(stderr, fmt, varg);
@@ -584,7 +588,7 @@ void WARNING(const char *fmt, ...)
 	extern char *cmdname;
 	va_list varg;
 
-	fflush(stdout);
+	throut_sync();
 	fprintf(stderr, "%s: ", cmdname);
 	va_start(varg, fmt);
 	vfprintf(stderr, fmt, varg);
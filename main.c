@@ -23,7 +23,7 @@ THIS SOFTWARE.
 ****************************************************************/
 
 const char	*version = "version 20110810 [bioawk_cas 2024Oct14]";
-const char	*usage_str = "\nusage: %s [-F fs] [-v var=value] [-c fmt] [-tH] [-f progfile | 'prog'] [file ...]\n\n";
+const char	*usage_str = "\nusage: %s [-F fs] [-v var=value] [-c fmt] [-j threads] [-P] [-tH] [-f progfile | 'prog'] [file ...]\n\n";
 
 #define DEBUG
 #include <stdio.h>
@@ -34,6 +34,7 @@ const char	*usage_str = "\nusage: %s [-F fs] [-v var=value] [-c fmt] [-tH] [-f p
 #include <signal.h>
 #include "awk.h"
 #include "ytab.h"
+#include "thrio.h"
 
 extern	char	**environ;
 extern	int	nfields;
@@ -84,7 +85,11 @@ int main(int argc, char *argv[])
                 bio_get_fmt("");
                 printf("\nbioawk functions:\n\tgc meanqual qualcount revcomp reverse trimq and or xor\n"
                        "\ttranslate gffattr gtfattr samattr fldcat systime md5 FILENUM\n"
-                       "\tedit_dist hamming end_adapter_pos charcount applytochars modstr setat find_codons\n\n");
+                       "\tedit_dist hamming end_adapter_pos charcount applytochars modstr setat find_codons\n"
+                       "\tseqpack sequnpack kmercount kmerdump sortkeys findall tr\n"
+                       "\tmd5_update md5_final xxh3 crc32c translate6 orfs attr samtag\n"
+                       "\tcigar cigar_blocks samtag_array cov_add cov_emit ivl_load ivl_overlap\n"
+                       "\tjoin_open join_next load_table array_save array_load\n\n");
                 exit(0);
         }
 		if (strncmp(argv[1], "--", 2) == 0) {	/* explicit end of args */
@@ -156,6 +161,9 @@ int main(int argc, char *argv[])
 		case 'H':
 			bio_flag |= BIO_SHOW_HDR;
 			break;
+		case 'P':	/* read and write on their own threads */
+			bio_flag |= BIO_PIPELINE;
+			break;
 		case 'c':
 			if (argv[1][2] != 0) {	/* arg is -csomething */
 				if ((bio_fmt = bio_get_fmt(&argv[1][2])) == BIO_NULL) return 1;
@@ -166,6 +174,18 @@ int main(int argc, char *argv[])
 				if ((bio_fmt = bio_get_fmt(argv[1])) == BIO_NULL) return 1;
 			}
 			break;
+		case 'j':	/* threads for reading an uncompressed fasta/fastq file */
+			if (argv[1][2] != 0) {	/* arg is -jN */
+				bio_nthreads = atoi(&argv[1][2]);
+			} else {		/* arg is -j N */
+				argc--; argv++;
+				if (argc <= 1)
+					FATAL("no thread count");
+				bio_nthreads = atoi(argv[1]);
+			}
+			if (bio_nthreads < 1)
+				FATAL("bad thread count %s", argv[1]);
+			break;
 		default:
 			WARNING("unknown option %s ignored", argv[1]);
 			break;
@@ -203,6 +223,8 @@ int main(int argc, char *argv[])
 	   dprintf( ("errorflag=%d\n", errorflag) );
 	if (errorflag == 0) {
 		compile_time = 0;
+		if ((bio_flag & BIO_PIPELINE) && throut_start() != 0)
+			WARNING("can't start the output thread; writing stdout directly");
 		run(winner);
 	} else
 		bracecheck();
@@ -4,185 +4,193 @@
  *
  * Compile with: gcc -o md5 -O3 -lm md5.c
  * from: https://gist.github.com/creationix/4710780
+ *
+ * Made streaming: the state lives in an md5_ctx_t, and 64-byte blocks are
+ * hashed where they lie, so no copy of the message is made.
  */
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include "md5.h"
 
 // leftrotate function definition
 #define LEFTROTATE(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
 
-
-// These vars will contain the hash
-uint32_t h0, h1, h2, h3;
-
-void md5(uint8_t *initial_msg, size_t initial_len) {
-
-    // Message (to prepare)
-    uint8_t *msg = NULL;
-
-    // Note: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
-
-    // r specifies the per-round shift amounts
-
-    uint32_t r[] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-                    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-                    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-                    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
-
-    // Use binary integer part of the sines of integers (in radians) as constants// Initialize variables:
-    uint32_t k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
-
-    h0 = 0x67452301;
-    h1 = 0xefcdab89;
-    h2 = 0x98badcfe;
-    h3 = 0x10325476;
-
-    // Pre-processing: adding a single 1 bit
-    //append "1" bit to message
-    /* Notice: the input bytes are considered as bits strings,
-       where the first bit is the most significant bit of the byte.[37] */
-
-    // Pre-processing: padding with zeros
-    //append "0" bit until message length in bit ≡ 448 (mod 512)
-    //append length mod (2 pow 64) to message
-
-    int new_len = ((((initial_len + 8) / 64) + 1) * 64) - 8;
-
-    msg = calloc(new_len + 64, 1); // also appends "0" bits
-                                   // (we alloc also 64 extra bytes...)
-    memcpy(msg, initial_msg, initial_len);
-    msg[initial_len] = 128; // write the "1" bit
-
-    uint32_t bits_len = 8*initial_len; // note, we append the len
-    memcpy(msg + new_len, &bits_len, 4);           // in bits at the end of the buffer
-
-    // Process the message in successive 512-bit chunks:
-    //for each 512-bit chunk of message:
-    int offset;
-    for(offset=0; offset<new_len; offset += (512/8)) {
-
-        // break chunk into sixteen 32-bit words w[j], 0 ≤ j ≤ 15
-        uint32_t *w = (uint32_t *) (msg + offset);
-
-#ifdef DEBUG
-        printf("offset: %d %x\n", offset, offset);
-
-        int j;
-        for(j =0; j < 64; j++) printf("%x ", ((uint8_t *) w)[j]);
-        puts("");
-#endif
-
-        // Initialize hash value for this chunk:
-        uint32_t a = h0;
-        uint32_t b = h1;
-        uint32_t c = h2;
-        uint32_t d = h3;
-
-        // Main loop:
-        uint32_t i;
-        for(i = 0; i<64; i++) {
-
-#ifdef ROUNDS
-            uint8_t *p;
-            printf("%i: ", i);
-            p=(uint8_t *)&a;
-            printf("%2.2x%2.2x%2.2x%2.2x ", p[0], p[1], p[2], p[3], a);
-
-            p=(uint8_t *)&b;
-            printf("%2.2x%2.2x%2.2x%2.2x ", p[0], p[1], p[2], p[3], b);
-
-            p=(uint8_t *)&c;
-            printf("%2.2x%2.2x%2.2x%2.2x ", p[0], p[1], p[2], p[3], c);
-
-            p=(uint8_t *)&d;
-            printf("%2.2x%2.2x%2.2x%2.2x", p[0], p[1], p[2], p[3], d);
-            puts("");
-#endif
-            uint32_t f, g;
-
-             if (i < 16) {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            } else if (i < 32) {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1) % 16;
-            } else if (i < 48) {
-                f = b ^ c ^ d;
-                g = (3*i + 5) % 16;
-            } else {
-                f = c ^ (b | (~d));
-                g = (7*i) % 16;
-            }
-
-#ifdef ROUNDS
-            printf("f=%x g=%d w[g]=%x\n", f, g, w[g]);
-#endif
-            uint32_t temp = d;
-            d = c;
-            c = b;
-            // printf("rotateLeft(%x + %x + %x + %x, %d)\n", a, f, k[i], w[g], r[i]);
-            b = b + LEFTROTATE((a + f + k[i] + w[g]), r[i]);
-            a = temp;
+// r specifies the per-round shift amounts
+static const uint32_t r[] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+                             5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+                             4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                             6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+
+// Use binary integer part of the sines of integers (in radians) as constants
+static const uint32_t k[] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+// Process one 512-bit chunk
+static void md5_block(uint32_t h[4], const unsigned char *p)
+{
+    uint32_t w[16], a, b, c, d, f, g, temp, i;
+
+    // break chunk into sixteen 32-bit little-endian words w[j], 0 ≤ j ≤ 15
+    for (i = 0; i < 16; i++, p += 4)
+        w[i] = (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+
+    // Initialize hash value for this chunk:
+    a = h[0];
+    b = h[1];
+    c = h[2];
+    d = h[3];
+
+    // Main loop:
+    for (i = 0; i < 64; i++) {
+        if (i < 16) {
+            f = (b & c) | ((~b) & d);
+            g = i;
+        } else if (i < 32) {
+            f = (d & b) | ((~d) & c);
+            g = (5*i + 1) % 16;
+        } else if (i < 48) {
+            f = b ^ c ^ d;
+            g = (3*i + 5) % 16;
+        } else {
+            f = c ^ (b | (~d));
+            g = (7*i) % 16;
         }
+        temp = d;
+        d = c;
+        c = b;
+        b = b + LEFTROTATE((a + f + k[i] + w[g]), r[i]);
+        a = temp;
+    }
 
-        // Add this chunk's hash to result so far:
+    // Add this chunk's hash to result so far:
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+}
 
-        h0 += a;
-        h1 += b;
-        h2 += c;
-        h3 += d;
+void md5_init(md5_ctx_t *c)
+{
+    c->h[0] = 0x67452301;
+    c->h[1] = 0xefcdab89;
+    c->h[2] = 0x98badcfe;
+    c->h[3] = 0x10325476;
+    c->len = 0;
+}
 
+void md5_update(md5_ctx_t *c, const void *s, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    size_t have = c->len % 64, take;
+
+    c->len += n;
+    if (have > 0) { // top up the partial block first
+        take = n < 64 - have ? n : 64 - have;
+        memcpy(c->buf + have, p, take);
+        p += take, n -= take;
+        if (have + take < 64) return;
+        md5_block(c->h, c->buf);
     }
-
-    // cleanup
-    free(msg);
+    for (; n >= 64; p += 64, n -= 64)
+        md5_block(c->h, p);
+    memcpy(c->buf, p, n);
 }
 
-char *md5str(uint8_t *msg, size_t len)
+void md5_final(md5_ctx_t *c, unsigned char digest[16])
 {
-    // store results as string
-    char partial[32];
-    char *md5str = calloc(64, 1);
+    uint64_t bits_len = c->len * 8;
+    size_t have = c->len % 64;
+    int i;
+
+    // Pre-processing: append the "1" bit, then "0" bits until the length
+    // in bits ≡ 448 (mod 512), then the length in bits mod 2^64
+    c->buf[have++] = 128;
+    if (have > 56) {
+        memset(c->buf + have, 0, 64 - have);
+        md5_block(c->h, c->buf);
+        have = 0;
+    }
+    memset(c->buf + have, 0, 56 - have);
+    for (i = 0; i < 8; i++)
+        c->buf[56 + i] = (unsigned char)(bits_len >> 8*i);
+    md5_block(c->h, c->buf);
+    for (i = 0; i < 16; i++)
+        digest[i] = (unsigned char)(c->h[i / 4] >> 8*(i % 4));
+}
 
-    md5(msg,len);
+void md5_hex(const unsigned char digest[16], char hex[33])
+{
+    static const char x[] = "0123456789abcdef";
+    int i;
 
-    uint8_t *p;
-    p=(uint8_t *)&h0;
-    sprintf(partial, "%2.2x%2.2x%2.2x%2.2x", p[0], p[1], p[2], p[3]);
-    strcat(md5str, partial);
+    for (i = 0; i < 16; i++) {
+        hex[2*i] = x[digest[i] >> 4];
+        hex[2*i + 1] = x[digest[i] & 15];
+    }
+    hex[32] = '\0';
+}
 
-    p=(uint8_t *)&h1;
-    sprintf(partial, "%2.2x%2.2x%2.2x%2.2x", p[0], p[1], p[2], p[3]);
-    strcat(md5str, partial);
+typedef struct md5_handle_s {
+    char *name;
+    md5_ctx_t ctx;
+    struct md5_handle_s *next;
+} md5_handle_t;
 
-    p=(uint8_t *)&h2;
-    sprintf(partial, "%2.2x%2.2x%2.2x%2.2x", p[0], p[1], p[2], p[3]);
-    strcat(md5str, partial);
+static md5_handle_t *g_handles;
 
-    p=(uint8_t *)&h3;
-    sprintf(partial, "%2.2x%2.2x%2.2x%2.2x", p[0], p[1], p[2], p[3]);
-    strcat(md5str, partial);
+uint64_t md5_handle_update(const char *handle, const void *s, size_t n)
+{
+    md5_handle_t *m;
+
+    for (m = g_handles; m; m = m->next)
+        if (strcmp(m->name, handle) == 0) break;
+    if (m == 0) {
+        if ((m = (md5_handle_t *)malloc(sizeof(md5_handle_t))) == 0 || (m->name = strdup(handle)) == 0) {
+            fprintf(stderr, "md5: out of memory\n");
+            exit(2);
+        }
+        md5_init(&m->ctx);
+        m->next = g_handles;
+        g_handles = m;
+    }
+    md5_update(&m->ctx, s, n);
+    return m->ctx.len;
+}
 
-    // printf("%s\n", md5str);
-    return md5str;
+void md5_handle_final(const char *handle, char hex[33])
+{
+    md5_handle_t *m, **pm;
+    md5_ctx_t c;
+    unsigned char digest[16];
+
+    for (pm = &g_handles; (m = *pm) != 0; pm = &m->next)
+        if (strcmp(m->name, handle) == 0) break;
+    if (m) {
+        c = m->ctx;
+        *pm = m->next;
+        free(m->name);
+        free(m);
+    } else
+        md5_init(&c);
+    md5_final(&c, digest);
+    md5_hex(digest, hex);
 }
 
 #ifdef MAIN
@@ -193,12 +201,15 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    char *msg = argv[1];
-    size_t len = strlen(msg);
+    md5_ctx_t c;
+    unsigned char digest[16];
+    char hex[33];
 
-    char* retstr = md5str(msg, len);
-    printf("%s\n", retstr);
-    free(retstr);
+    md5_init(&c);
+    md5_update(&c, argv[1], strlen(argv[1]));
+    md5_final(&c, digest);
+    md5_hex(digest, hex);
+    printf("%s\n", hex);
 
     return 0;
 }
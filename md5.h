@@ -0,0 +1,25 @@
+#ifndef MD5_H
+#define MD5_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* MD5 for md5(), md5_update() and md5_final(). A context holds all of the
+ * state, so messages can be hashed a piece at a time, and several at once. */
+
+typedef struct md5_ctx {
+    uint32_t h[4];
+    uint64_t len;           /* bytes hashed so far */
+    unsigned char buf[64];  /* the partial block, len % 64 bytes */
+} md5_ctx_t;
+
+void md5_init(md5_ctx_t *c);
+void md5_update(md5_ctx_t *c, const void *s, size_t n);
+void md5_final(md5_ctx_t *c, unsigned char digest[16]);
+void md5_hex(const unsigned char digest[16], char hex[33]);
+
+/* contexts named by a handle, as for kmercount() */
+uint64_t md5_handle_update(const char *handle, const void *s, size_t n); /* returns bytes hashed under handle */
+void md5_handle_final(const char *handle, char hex[33]); /* drops the handle; an unknown one hashes nothing */
+
+#endif
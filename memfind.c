@@ -0,0 +1,124 @@
+#define _GNU_SOURCE /* memmem() */
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "memfind.h"
+
+/* Candidates are the positions where the first and last bytes of the needle
+ * match, found 16 at a time with SSE2 (or with memchr()), then checked with
+ * memcmp(). On text like poly-A nearly every position can be a candidate, so
+ * once checking has cost more than the scan, the rest is left to memmem(),
+ * which is linear in the worst case. */
+
+#define too_slow(work, scanned) ((work) > 2 * (scanned) + 4096)
+
+const char *memfind(const char *h, size_t hn, const char *n, size_t nn)
+{
+    const char *p = h, *last;
+    size_t work = 0;
+
+    if (nn == 0) return h;
+    if (nn > hn) return 0;
+    if (nn == 1) return (const char *)memchr(h, (unsigned char)n[0], hn);
+    last = h + hn - nn; /* last place n can start */
+#ifdef __SSE2__
+    {
+        __m128i f = _mm_set1_epi8(n[0]), l = _mm_set1_epi8(n[nn-1]), a, b;
+        unsigned m;
+        int i;
+
+        for (; last - p >= 15; p += 16) {
+            a = _mm_cmpeq_epi8(f, _mm_loadu_si128((const __m128i *)p));
+            b = _mm_cmpeq_epi8(l, _mm_loadu_si128((const __m128i *)(p + nn - 1)));
+            for (m = _mm_movemask_epi8(_mm_and_si128(a, b)); m; m &= m - 1) {
+                i = __builtin_ctz(m);
+                if (memcmp(p + i + 1, n + 1, nn - 2) == 0) return p + i;
+                work += nn;
+            }
+            if (too_slow(work, (size_t)(p - h)))
+                return (const char *)memmem(p + 16, h + hn - (p + 16), n, nn);
+        }
+    }
+#endif
+    for (; p <= last; ++p) {
+        if ((p = (const char *)memchr(p, (unsigned char)n[0], last - p + 1)) == 0) return 0;
+        if (p[nn-1] == n[nn-1] && memcmp(p + 1, n + 1, nn - 2) == 0) return p;
+        work += nn;
+        if (too_slow(work, (size_t)(p - h)))
+            return (const char *)memmem(p + 1, h + hn - (p + 1), n, nn);
+    }
+    return 0;
+}
+
+void byteset_prep(byteset_t *b)
+{
+    int c, m = 0, nm = 0;
+    unsigned char mc[4], nmc[4];
+
+    for (c = 1; c < 256; ++c) {
+        if (b->in[c]) {
+            if (m < 4) mc[m] = c;
+            ++m;
+        } else {
+            if (nm < 4) nmc[nm] = c;
+            ++nm;
+        }
+    }
+    b->in[0] = 0;
+    if (m <= 4) b->neg = 0, b->nc = m, memcpy(b->c, mc, 4);
+    else if (nm <= 4) b->neg = 1, b->nc = nm, memcpy(b->c, nmc, 4);
+    else b->neg = 0, b->nc = -1;
+}
+
+/* first byte of s that is (eq != 0) or isn't (eq == 0) one of c[0..nc-1] */
+static const char *find_eq(const char *s, size_t n, const unsigned char *c, int nc, int eq)
+{
+    const char *end = s + n;
+    int i;
+#ifdef __SSE2__
+    __m128i v[4], x, hit;
+    unsigned m;
+
+    for (i = 0; i < nc; ++i)
+        v[i] = _mm_set1_epi8(c[i]);
+    for (; end - s >= 16; s += 16) {
+        x = _mm_loadu_si128((const __m128i *)s);
+        hit = _mm_setzero_si128();
+        for (i = 0; i < nc; ++i)
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(x, v[i]));
+        m = _mm_movemask_epi8(hit);
+        if (!eq) m ^= 0xffff;
+        if (m) return s + __builtin_ctz(m);
+    }
+#endif
+    for (; s < end; ++s) {
+        for (i = 0; i < nc && (unsigned char)*s != c[i]; ++i);
+        if ((i < nc) == (eq != 0)) return s;
+    }
+    return 0;
+}
+
+const char *byteset_find(const byteset_t *b, const char *s, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)s, *end = p + n;
+
+    if (b->nc == 1 && !b->neg) return (const char *)memchr(s, b->c[0], n);
+    if (b->nc >= 0) return find_eq(s, n, b->c, b->nc, !b->neg);
+    for (; p < end; ++p)
+        if (b->in[*p]) return (const char *)p;
+    return 0;
+}
+
+size_t byteset_span(const byteset_t *b, const char *s, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)s, *end = p + n;
+    const char *q;
+
+    if (b->nc >= 0) {
+        q = find_eq(s, n, b->c, b->nc, b->neg);
+        return q ? (size_t)(q - s) : n;
+    }
+    for (; p < end && b->in[*p]; ++p);
+    return p - (const unsigned char *)s;
+}
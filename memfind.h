@@ -0,0 +1,22 @@
+#ifndef MEMFIND_H
+#define MEMFIND_H
+
+#include <stddef.h>
+
+/* Substring and byte set search for index(), findall(), sub() and gsub(). */
+
+const char *memfind(const char *h, size_t hn, const char *n, size_t nn); /* first n in h, or NULL; h itself if nn is 0 */
+
+/* A set of bytes. Sets of up to 4 bytes, or of all but up to 4 (not
+ * counting '\0'), are searched 16 bytes at a time with SSE2. */
+typedef struct byteset {
+    unsigned char in[256]; /* in[c] != 0 for members */
+    int nc, neg;           /* the members, or if neg the non-members, are c[0..nc-1]; nc < 0 if too many */
+    unsigned char c[4];
+} byteset_t;
+
+void byteset_prep(byteset_t *b);                             /* set nc, neg and c from in */
+const char *byteset_find(const byteset_t *b, const char *s, size_t n); /* first member in s, or NULL */
+size_t byteset_span(const byteset_t *b, const char *s, size_t n); /* number of members s starts with */
+
+#endif
@@ -115,7 +115,10 @@ Node *stat3(int a, Node *b, Node *c, Node *d)
 {
 	Node *x;
 
-	x = node3(a,b,c,d);
+	if (a == PRINTF)	/* a[3] is the format, if constant, compiled */
+		x = node4(a,b,c,d,fmtconst(b));
+	else
+		x = node3(a,b,c,d);
 	x->ntype = NSTAT;
 	return(x);
 }
@@ -133,7 +136,10 @@ Node *op1(int a, Node *b)
 {
 	Node *x;
 
-	x = node1(a,b);
+	if (a == SPRINTF)	/* a[1] is the format, if constant, compiled */
+		x = node2(a,b,fmtconst(b));
+	else
+		x = node1(a,b);
 	x->ntype = NEXPR;
 	return(x);
 }
@@ -191,7 +197,7 @@ Node *makearr(Node *p)
 		if (isfcn(cp))
 			SYNTAX( "%s is a function, not an array", cp->nval );
 		else if (!isarr(cp)) {
-			xfree(cp->sval);
+			freesval(cp);
 			cp->sval = (char *) makesymtab(NSYMTAB);
 			cp->tval = ARR;
 		}
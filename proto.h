@@ -40,6 +40,7 @@ extern	int	yyinput(void);
 
 extern	fa	*makedfa(const char *, int);
 extern	fa	*mkdfa(const char *, int);
+extern	void	simplere(fa *, Node *);
 extern	int	makeinit(fa *, int);
 extern	void	penter(Node *);
 extern	void	freetr(Node *);
@@ -103,13 +104,30 @@ extern	Cell	*setsymtab(const char *, const char *, double, unsigned int, Array *
 extern	int	hash(const char *, int);
 extern	void	rehash(Array *);
 extern	Cell	*lookup(const char *, Array *);
+extern	Cell	*lookupnum(double, Array *);
+extern	Cell	*setnumsymtab(int, const char *, double, unsigned int, Array *);
+extern	void	trimsymtab(Array *, int);
+extern	int	arraycells(Array *, Cell **);
 extern	double	setfval(Cell *, double);
 extern	void	funnyvar(Cell *, const char *);
 extern	char	*setsval(Cell *, const char *);
+extern	char	*setsnval(Cell *, const char *, size_t);
+extern	void	setcellstr(Cell *, const char *, size_t);
+extern	char	*copysval(Cell *, Cell *);
+extern	char	*ownsval(Cell *);
+extern	char	*takesval(Cell *, char *, size_t);
+extern	size_t	strcap(size_t);
+extern	char	*setsnbuf(Cell *, const char *, size_t);
 extern	double	getfval(Cell *);
 extern	char	*getsval(Cell *);
+extern	size_t	getslen(Cell *);
 extern	char	*getpssval(Cell *);     /* for print */
 extern	char	*tostring(const char *);
+extern	char	*stralloc(size_t);
+extern	char	*strref(char *);
+extern	char	*strgrow(char *, size_t);
+extern	void	strunref(char *);
+extern	void	freestr(char *, int);
 extern	char	*qstring(const char *, int);
 
 extern	void	recinit(unsigned int);
@@ -146,7 +164,7 @@ extern	void	run(Node *);
 extern	Cell	*execute(Node *);
 extern	Cell	*program(Node **, int);
 extern	Cell	*call(Node **, int);
-extern	Cell	*copycell(Cell *);
+extern	Cell	*copycell(Cell *, Cell *);
 extern	Cell	*arg(Node **, int);
 extern	Cell	*jump(Node **, int);
 extern	Cell	*awkgetline(Node **, int);
@@ -163,6 +181,7 @@ extern	Cell	*field(Node **, int);
 extern	Cell	*indirect(Node **, int);
 extern	Cell	*substr(Node **, int);
 extern	Cell	*sindex(Node **, int);
+extern	Node	*fmtconst(Node *);
 extern	int	format(char **, int *, const char *, Node *);
 extern	Cell	*awksprintf(Node **, int);
 extern	Cell	*awkprintf(Node **, int);
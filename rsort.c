@@ -0,0 +1,75 @@
+#include <string.h>
+#include <stdlib.h>
+#include "rsort.h"
+
+/* LSD radix sort a byte at a time, skipping bytes every key shares */
+void rsort_u64(rsort_t *a, size_t n)
+{
+    size_t cnt[8][256], i, sum, t;
+    rsort_t *b, *src = a, *dst, *tmp;
+    int d;
+
+    if (n < 2) return;
+    memset(cnt, 0, sizeof(cnt));
+    for (i = 0; i < n; ++i)
+        for (d = 0; d < 8; ++d)
+            cnt[d][(a[i].key >> 8*d) & 0xff]++;
+    dst = b = (rsort_t *)malloc(n * sizeof(rsort_t));
+    for (d = 0; d < 8; ++d) {
+        if (cnt[d][(a[0].key >> 8*d) & 0xff] == n) continue;
+        for (i = sum = 0; i < 256; ++i)
+            t = cnt[d][i], cnt[d][i] = sum, sum += t;
+        for (i = 0; i < n; ++i)
+            dst[cnt[d][(src[i].key >> 8*d) & 0xff]++] = src[i];
+        tmp = src, src = dst, dst = tmp;
+    }
+    if (src != a) memcpy(a, src, n * sizeof(rsort_t));
+    free(b);
+}
+
+static char *const *g_strs;
+static int g_rev;
+
+static int cmp_tail(const void *p, const void *q) /* past the 8 bytes in the key */
+{
+    const rsort_t *x = (const rsort_t *)p, *y = (const rsort_t *)q;
+    int c = strcmp(g_strs[x->i] + 8, g_strs[y->i] + 8);
+
+    if (c) return g_rev ? -c : c;
+    return x->i < y->i ? -1 : x->i > y->i;
+}
+
+/* radix sort on the first 8 bytes, then compare the rest within runs that
+ * share them */
+void rsort_str(rsort_t *a, size_t n, char *const *s, int rev)
+{
+    size_t i, j;
+    const unsigned char *p;
+    uint64_t k;
+    int b;
+
+    for (i = 0; i < n; ++i) {
+        p = (const unsigned char *)s[a[i].i];
+        for (b = 0, k = 0; b < 8; ++b) {
+            k = k << 8 | *p;
+            if (*p) ++p;
+        }
+        a[i].key = rev ? ~k : k;
+    }
+    rsort_u64(a, n);
+    g_strs = s, g_rev = rev;
+    for (i = 0; i < n; i = j) {
+        for (j = i + 1; j < n && a[j].key == a[i].key; ++j);
+        if (j - i > 1 && (rev ? ~a[i].key : a[i].key) & 0xff) /* 8 bytes and no NUL: compare the rest */
+            qsort(a + i, j - i, sizeof(rsort_t), cmp_tail);
+    }
+}
+
+uint64_t rsort_dbl(double x)
+{
+    uint64_t u;
+
+    if (x == 0) x = 0; /* -0 sorts with 0 */
+    memcpy(&u, &x, 8);
+    return u >> 63 ? ~u : u | 1ULL << 63;
+}
@@ -0,0 +1,20 @@
+#ifndef RSORT_H
+#define RSORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Radix sorts for sortkeys(). Items are (key, i) pairs, i indexing the
+ * caller's data; both sorts are stable, so start with a[j].i = j to break
+ * ties by position. */
+
+typedef struct {
+    uint64_t key;
+    size_t i;
+} rsort_t;
+
+void rsort_u64(rsort_t *a, size_t n);                     /* by key */
+void rsort_str(rsort_t *a, size_t n, char *const *s, int rev); /* by the strings s[a[].i], bytewise; key is scratch */
+uint64_t rsort_dbl(double x);                             /* key that sorts as x does */
+
+#endif
@@ -33,6 +33,8 @@ THIS SOFTWARE.
 #include <time.h>
 #include "awk.h"
 #include "ytab.h"
+#include "thrio.h"
+#include "memfind.h"
 
 #define tempfree(x)	if (istemp(x)) tfree(x); else
 
@@ -71,23 +73,23 @@ extern	Awkfloat	srand_seed;
 Node	*winner = NULL;	/* root of parse tree */
 Cell	*tmps;		/* free temporary cells for execution */
 
-static Cell	truecell	={ OBOOL, BTRUE, 0, 0, 1.0, NUM };
+static Cell	truecell	={ OBOOL, BTRUE, NUM, 0, 0, 1.0 };
 Cell	*True	= &truecell;
-static Cell	falsecell	={ OBOOL, BFALSE, 0, 0, 0.0, NUM };
+static Cell	falsecell	={ OBOOL, BFALSE, NUM, 0, 0, 0.0 };
 Cell	*False	= &falsecell;
-static Cell	breakcell	={ OJUMP, JBREAK, 0, 0, 0.0, NUM };
+static Cell	breakcell	={ OJUMP, JBREAK, NUM, 0, 0, 0.0 };
 Cell	*jbreak	= &breakcell;
-static Cell	contcell	={ OJUMP, JCONT, 0, 0, 0.0, NUM };
+static Cell	contcell	={ OJUMP, JCONT, NUM, 0, 0, 0.0 };
 Cell	*jcont	= &contcell;
-static Cell	nextcell	={ OJUMP, JNEXT, 0, 0, 0.0, NUM };
+static Cell	nextcell	={ OJUMP, JNEXT, NUM, 0, 0, 0.0 };
 Cell	*jnext	= &nextcell;
-static Cell	nextfilecell	={ OJUMP, JNEXTFILE, 0, 0, 0.0, NUM };
+static Cell	nextfilecell	={ OJUMP, JNEXTFILE, NUM, 0, 0, 0.0 };
 Cell	*jnextfile	= &nextfilecell;
-static Cell	exitcell	={ OJUMP, JEXIT, 0, 0, 0.0, NUM };
+static Cell	exitcell	={ OJUMP, JEXIT, NUM, 0, 0, 0.0 };
 Cell	*jexit	= &exitcell;
-static Cell	retcell		={ OJUMP, JRET, 0, 0, 0.0, NUM };
+static Cell	retcell		={ OJUMP, JRET, NUM, 0, 0, 0.0 };
 Cell	*jret	= &retcell;
-static Cell	tempcell	={ OCELL, CTEMP, 0, "", 0.0, NUM|STR|DONTFREE };
+static Cell	tempcell	={ OCELL, CTEMP, NUM|STR|DONTFREE, 0, "", 0.0 };
 
 Node	*curnode = NULL;	/* the node being executed, for debugging */
 
@@ -215,22 +217,74 @@ struct Frame {	/* stack frame for awk function calls */
 	Cell *fcncell;	/* pointer to Cell for function */
 	Cell **args;	/* pointer to array of arguments after execute */
 	Cell *retval;	/* return value */
+	int nslot;	/* size of the arrays below, kept for the next call */
+	Cell *slot;	/* cells for scalar args and locals */
+	Cell **oargs;	/* the caller's cells for them, or NULL */
 };
 
-#define	NARGS	50	/* max args in a call */
-
 struct Frame *frame = NULL;	/* base of stack frames; dynamically allocated */
 int	nframe = 0;		/* number of frames allocated */
 struct Frame *fp = NULL;	/* frame pointer. bottom level unused */
+int	ftop = 0;		/* frames in use, including ones whose args are being evaluated */
 
-Cell *call(Node **a, int n)	/* function call.  very kludgy and fragile */
+static int newframe(int ndef, const char *s)	/* reserve a frame for ndef args */
 {
-	static Cell newcopycell = { OCELL, CCOPY, 0, "", 0.0, NUM|STR|DONTFREE };
-	int i, ncall, ndef;
-	int freed = 0; /* handles potential double freeing when fcn & param share a tempcell */
-	Node *x;
-	Cell *args[NARGS], *oargs[NARGS];	/* BUG: fixed size arrays */
-	Cell *y, *z, *fcn;
+	int dfp, d = ++ftop;
+	struct Frame *f;
+
+	if (d >= nframe) {
+		dfp = fp - frame;	/* old index */
+		f = (struct Frame *)
+			realloc((char *) frame, (nframe + 100) * sizeof(struct Frame));
+		if (f == NULL)
+			FATAL("out of space for stack frames in %s", s);
+		memset(f + nframe, 0, 100 * sizeof(struct Frame));
+		nframe += 100;
+		frame = f;
+		fp = frame + dfp;
+	}
+	f = frame + d;
+	if (ndef > f->nslot) {
+		free(f->slot);
+		free(f->args);
+		free(f->oargs);
+		f->nslot = ndef;
+		f->slot = (Cell *) malloc(ndef * sizeof(Cell));
+		f->args = (Cell **) malloc(ndef * sizeof(Cell *));
+		f->oargs = (Cell **) malloc(ndef * sizeof(Cell *));
+		if (f->slot == NULL || f->args == NULL || f->oargs == NULL)
+			FATAL("out of space for arguments of %s", s);
+	}
+	return d;
+}
+
+static void setretval(Cell *y)	/* return y from the function at fp */
+{
+	if ((y->tval & (STR|NUM)) == (STR|NUM)) {
+		copysval(fp->retval, y);
+		fp->retval->fval = getfval(y);
+		fp->retval->tval |= NUM;
+	}
+	else if (y->tval & STR)
+		copysval(fp->retval, y);
+	else if (y->tval & NUM)
+		setfval(fp->retval, getfval(y));
+	else		/* can't happen */
+		FATAL("bad type variable %d", y->tval);
+}
+
+/* a frame's args and locals live in cells it keeps from call to call, and
+ * strings are shared with the caller where they can be.  scalar args are
+ * copied into the slots as they are evaluated; an arg list can hold calls
+ * of its own, which take the frames above this one. */
+
+Cell *call(Node **a, int n)	/* function call */
+{
+	static Cell newcopycell = { OCELL, CCOPY, NUM|STR|DONTFREE, 0, "", 0.0 };
+	int i, ncall, ndef, d, cd;
+	Node *x, *body;
+	Cell *y, *z, *t, *fcn;
+	struct Frame *f;
 	char *s;
 
 	fcn = execute(a[0]);	/* the function itself */
@@ -249,92 +303,89 @@ Cell *call(Node **a, int n)	/* function call.  very kludgy and fragile */
 	if (ncall > ndef)
 		WARNING("function %s called with %d args, uses only %d",
 			s, ncall, ndef);
-	if (ncall + ndef > NARGS)
-		FATAL("function %s has %d arguments, limit %d", s, ncall+ndef, NARGS);
+	d = newframe(ncall > ndef ? ncall : ndef, s);
 	for (i = 0, x = a[1]; x != NULL; i++, x = x->nnext) {	/* get call args */
 		   dprintf( ("evaluate args[%d], fp=%d:\n", i, (int) (fp-frame)) );
-		y = execute(x);
-		oargs[i] = y;
+		y = execute(x);		/* may call functions, moving frame */
+		f = frame + d;
 		   dprintf( ("args[%d]: %s %f <%s>, t=%o\n",
 			   i, NN(y->nval), y->fval, isarr(y) ? "(array)" : NN(y->sval), y->tval) );
 		if (isfcn(y))
 			FATAL("can't use function %s as argument in %s", y->nval, s);
+		f->oargs[i] = istemp(y) ? NULL : y;
 		if (isarr(y))
-			args[i] = y;	/* arrays by ref */
+			f->args[i] = y;	/* arrays by ref */
 		else
-			args[i] = copycell(y);
+			f->args[i] = copycell(&f->slot[i], y);
 		tempfree(y);
 	}
+	f = frame + d;
 	for ( ; i < ndef; i++) {	/* add null args for ones not provided */
-		args[i] = gettemp();
-		*args[i] = newcopycell;
-	}
-	fp++;	/* now ok to up frame */
-	if (fp >= frame + nframe) {
-		int dfp = fp - frame;	/* old index */
-		frame = (struct Frame *)
-			realloc((char *) frame, (nframe += 100) * sizeof(struct Frame));
-		if (frame == NULL)
-			FATAL("out of space for stack frames in %s", s);
-		fp = frame + dfp;
+		f->slot[i] = newcopycell;
+		f->args[i] = &f->slot[i];
 	}
+	cd = fp - frame;
+	fp = f;	/* now ok to up frame */
 	fp->fcncell = fcn;
-	fp->args = args;
 	fp->nargs = ndef;	/* number defined with (excess are locals) */
 	fp->retval = gettemp();
 
 	   dprintf( ("start exec of %s, fp=%d\n", s, (int) (fp-frame)) );
-	y = execute((Node *)(fcn->sval));	/* execute body */
+	body = (Node *) fcn->sval;
+	if (body != NULL && body->nobj == RETURN && body->nnext == NULL
+	    && body->narg[0] != NULL) {
+		y = execute(body->narg[0]);	/* { return expr }: skip the jump */
+		setretval(y);
+		tempfree(y);
+		y = jret;
+	} else
+		y = execute(body);	/* execute body */
 	   dprintf( ("finished exec of %s, fp=%d\n", s, (int) (fp-frame)) );
 
-	for (i = 0; i < ndef; i++) {
-		Cell *t = fp->args[i];
+	for (i = 0; i < ncall || i < ndef; i++) {
+		t = fp->args[i];
+		if (t != &fp->slot[i])
+			continue;	/* an array passed by reference */
 		if (isarr(t)) {
-			if (t->csub == CCOPY) {
-				if (i >= ncall) {
-					freesymtab(t);
-					t->csub = CTEMP;
-					tempfree(t);
-				} else {
-					oargs[i]->tval = t->tval;
-					oargs[i]->tval &= ~(STR|NUM|DONTFREE);
-					oargs[i]->sval = t->sval;
-					tempfree(t);
-				}
-			}
-		} else if (t != y) {	/* kludge to prevent freeing twice */
-			t->csub = CTEMP;
-			tempfree(t);
-		} else if (t == y && t->csub == CCOPY) {
-			t->csub = CTEMP;
-			tempfree(t);
-			freed = 1;
-		}
+			if (i < ncall && fp->oargs[i] != NULL) {	/* made into an array here */
+				fp->oargs[i]->tval &= ~(STR|NUM|DONTFREE|SLEN|SGROW|SREF);
+				fp->oargs[i]->tval |= ARR;
+				fp->oargs[i]->sval = t->sval;
+			} else
+				freesymtab(t);
+		} else
+			freesval(t);
 	}
 	tempfree(fcn);
-	if (isexit(y) || isnext(y))
+	z = fp->retval;			/* return value */
+	fp = frame + cd;	/* frame may have moved */
+	ftop--;
+	if (isexit(y) || isnext(y)) {
+		tfree(z);
 		return y;
-	if (freed == 0) {
-		tempfree(y);	/* don't free twice! */
 	}
-	z = fp->retval;			/* return value */
+	tempfree(y);
 	   dprintf( ("%s returns %g |%s| %o\n", s, getfval(z), getsval(z), z->tval) );
-	fp--;
 	return(z);
 }
 
-Cell *copycell(Cell *x)	/* make a copy of a cell in a temp */
+Cell *copycell(Cell *y, Cell *x)	/* make y a copy of x, for an argument */
 {
-	Cell *y;
-
-	y = gettemp();
+	y->ctype = OCELL;
 	y->csub = CCOPY;	/* prevents freeing until call is over */
 	y->nval = x->nval;	/* BUG? */
-	if (isstr(x))
-		y->sval = tostring(x->sval);
 	y->fval = x->fval;
-	y->tval = x->tval & ~(CON|FLD|REC|DONTFREE);	/* copy is not constant or field */
-							/* is DONTFREE right? */
+	y->tval = x->tval & ~(CON|FLD|REC|DONTFREE|SGROW|SREF);	/* copy is not constant or field */
+	y->cnext = NULL;
+	if (isstr(x)) {
+		y->slen = getslen(x);
+		if ((x->tval & SREF) && freeable(x)) {	/* share it */
+			y->sval = strref(x->sval);
+			y->tval |= SREF;
+		} else
+			setcellstr(y, x->sval, y->slen);
+		y->tval |= SLEN;
+	}
 	return y;
 }
 
@@ -364,17 +415,7 @@ Cell *jump(Node **a, int n)	/* break, continue, next, nextfile, return */
 	case RETURN:
 		if (a[0] != NULL) {
 			y = execute(a[0]);
-			if ((y->tval & (STR|NUM)) == (STR|NUM)) {
-				setsval(fp->retval, getsval(y));
-				fp->retval->fval = getfval(y);
-				fp->retval->tval |= NUM;
-			}
-			else if (y->tval & STR)
-				setsval(fp->retval, getsval(y));
-			else if (y->tval & NUM)
-				setfval(fp->retval, getfval(y));
-			else		/* can't happen */
-				FATAL("bad type variable %d", y->tval);
+			setretval(y);
 			tempfree(y);
 		}
 		return(jret);
@@ -405,7 +446,7 @@ Cell *awkgetline(Node **a, int n)	/* get next line from specific input */
 	if ((buf = (char *) malloc(bufsize)) == NULL)
 		FATAL("out of memory in getline");
 
-	fflush(stdout);	/* in case someone is waiting for a prompt */
+	throut_sync();	/* in case someone is waiting for a prompt */
 	r = gettemp();
 	if (a[1] != NULL) {		/* getline < file */
 		x = execute(a[2]);		/* filename */
@@ -462,13 +503,22 @@ Cell *array(Node **a, int n)	/* a[0] is symtab, a[1] is list of subscripts */
 	int bufsz = recsize;
 	int nsub = strlen(*SUBSEP);
 
+	x = execute(a[0]);	/* Cell* for symbol table */
+	y = execute(a[1]);	/* first subscript */
+	if (a[1]->nnext == NULL && isarr(x) && (y->tval & (NUM|STR)) == NUM
+	    && (z = lookupnum(y->fval, (Array *) x->sval)) != NULL) {
+		z->ctype = OCELL;	/* x[i] of a dense array: no key string */
+		z->csub = CVAR;
+		tempfree(y);
+		tempfree(x);
+		return(z);
+	}
 	if ((buf = (char *) malloc(bufsz)) == NULL)
 		FATAL("out of memory in array");
-
-	x = execute(a[0]);	/* Cell* for symbol table */
 	buf[0] = 0;
 	for (np = a[1]; np; np = np->nnext) {
-		y = execute(np);	/* subscript */
+		if (np != a[1])
+			y = execute(np);	/* subscript */
 		s = getsval(y);
 		if (!adjbuf(&buf, &bufsz, strlen(buf)+strlen(s)+nsub+1, recsize, 0, "array"))
 			FATAL("out of memory for %s[%s...]", x->nval, buf);
@@ -479,8 +529,7 @@ Cell *array(Node **a, int n)	/* a[0] is symtab, a[1] is list of subscripts */
 	}
 	if (!isarr(x)) {
 		   dprintf( ("making %s into an array\n", NN(x->nval)) );
-		if (freeable(x))
-			xfree(x->sval);
+		freesval(x);
 		x->tval &= ~(STR|NUM|DONTFREE);
 		x->tval |= ARR;
 		x->sval = (char *) makesymtab(NSYMTAB);
@@ -543,8 +592,7 @@ Cell *intest(Node **a, int n)	/* a[0] is index (list), a[1] is symtab */
 	ap = execute(a[1]);	/* array name */
 	if (!isarr(ap)) {
 		   dprintf( ("making %s into an array\n", ap->nval) );
-		if (freeable(ap))
-			xfree(ap->sval);
+		freesval(ap);
 		ap->tval &= ~(STR|NUM|DONTFREE);
 		ap->tval |= ARR;
 		ap->sval = (char *) makesymtab(NSYMTAB);
@@ -685,7 +733,8 @@ void tfree(Cell *a)	/* free a tempcell */
 {
 	if (freeable(a)) {
 		   dprintf( ("freeing %s %s %o\n", NN(a->nval), NN(a->sval), a->tval) );
-		xfree(a->sval);
+		freestr(a->sval, a->tval);
+		a->sval = NULL;
 	}
 	if (a == tmps)
 		FATAL("tempcell list is curdled");
@@ -737,7 +786,6 @@ Cell *substr(Node **a, int nnn)		/* substr(a[0], a[1], a[2]) */
 {
 	int k, m, n;
 	char *s;
-	int temp;
 	Cell *x, *y, *z = 0;
 
 	x = execute(a[0]);
@@ -745,7 +793,7 @@ Cell *substr(Node **a, int nnn)		/* substr(a[0], a[1], a[2]) */
 	if (a[2] != 0)
 		z = execute(a[2]);
 	s = getsval(x);
-	k = strlen(s) + 1;
+	k = getslen(x) + 1;
 	if (k <= 1) {
 		tempfree(x);
 		tempfree(y);
@@ -773,10 +821,7 @@ Cell *substr(Node **a, int nnn)		/* substr(a[0], a[1], a[2]) */
 		n = k - m;
 	   dprintf( ("substr: m=%d, n=%d, s=%s\n", m, n, s) );
 	y = gettemp();
-	temp = s[n+m-1];	/* with thanks to John Linderman */
-	s[n+m-1] = '\0';
-	setsval(y, s + m - 1);
-	s[n+m-1] = temp;
+	setsnval(y, s + m - 1, n);
 	tempfree(x);
 	return(y);
 }
@@ -784,23 +829,21 @@ Cell *substr(Node **a, int nnn)		/* substr(a[0], a[1], a[2]) */
 Cell *sindex(Node **a, int nnn)		/* index(a[0], a[1]) */
 {
 	Cell *x, *y, *z;
-	char *s1, *s2, *p1, *p2, *q;
+	char *s1, *s2;
+	const char *p1;
+	size_t n1, n2;
 	Awkfloat v = 0.0;
 
 	x = execute(a[0]);
 	s1 = getsval(x);
+	n1 = getslen(x);
 	y = execute(a[1]);
 	s2 = getsval(y);
+	n2 = getslen(y);
 
 	z = gettemp();
-	for (p1 = s1; *p1 != '\0'; p1++) {
-		for (q=p1, p2=s2; *p2 != '\0' && *q == *p2; q++, p2++)
-			;
-		if (*p2 == '\0') {
-			v = (Awkfloat) (p1 - s1 + 1);	/* origin 1 */
-			break;
-		}
-	}
+	if (n1 > 0 && (p1 = memfind(s1, n1, s2, n2)) != NULL)
+		v = (Awkfloat) (p1 - s1 + 1);	/* origin 1 */
 	tempfree(x);
 	tempfree(y);
 	setfval(z, v);
@@ -809,6 +852,337 @@ Cell *sindex(Node **a, int nnn)		/* index(a[0], a[1]) */
 
 #define	MAXNUMSIZE	50
 
+/* compiled printf formats.  fmtcompile() breaks a format string into a list
+ * of literal runs and conversions once; fmtexec() then runs that list for each
+ * printf/sprintf without re-scanning the format or building a scratch copy.
+ * a constant format is compiled by the parser (fmtconst()) and kept in the
+ * printf or sprintf node; others are kept in a small cache, most recently
+ * used first.
+ */
+
+#define	FMTLIT	1	/* literal text, "%%" already folded to "%" */
+#define	FMTINT	2	/* plain %d or %i: emitted without snprintf */
+#define	FMTSTR	3	/* plain %s: copied without snprintf */
+#define	FMTFIX	4	/* plain %f or %.Nf: fmtfixed(), else as FMTCONV */
+#define	FMTCONV	5	/* anything else: snprintf with the saved spec */
+
+typedef struct Fmtitem {
+	int	type;		/* FMTLIT, FMTINT, FMTSTR, FMTFIX or FMTCONV */
+	int	flag;		/* conversion class, as in format(): f d u s c ? */
+	int	len;		/* length of spec */
+	int	fmtwd;		/* field width from the spec */
+	int	prec;		/* digits after the point, for FMTFIX */
+	char	*spec;		/* literal text or printf spec */
+} Fmtitem;
+
+typedef struct Fmtcache {
+	char	*fmt;		/* format string this was compiled from */
+	int	nitem;		/* -1 if it can't be compiled (uses *) */
+	Fmtitem	*item;
+	int	busy;		/* fmtexec() calls running it: an argument may printf too */
+	int	dropped;	/* evicted while busy; freed when the last call ends */
+} Fmtcache;
+
+#define	NFMTCACHE	16
+static Fmtcache	*fmtcache[NFMTCACHE];	/* most recently used first */
+
+static void fmtadd(Fmtcache *fc, int *nalloc, int type, int flag, int fmtwd, const char *spec, int len)
+{
+	Fmtitem *ip;
+
+	if (fc->nitem >= *nalloc) {
+		*nalloc = 2 * *nalloc + 4;
+		fc->item = (Fmtitem *) realloc(fc->item, *nalloc * sizeof(Fmtitem));
+		if (fc->item == NULL)
+			FATAL("out of memory compiling format %.30s...", fc->fmt);
+	}
+	ip = &fc->item[fc->nitem++];
+	ip->type = type;
+	ip->flag = flag;
+	ip->fmtwd = fmtwd;
+	ip->len = len;
+	if ((ip->spec = (char *) malloc(len + 3)) == NULL)	/* room for an added l */
+		FATAL("out of memory compiling format %.30s...", fc->fmt);
+	memcpy(ip->spec, spec, len);
+	ip->spec[len] = '\0';
+}
+
+static Fmtcache *fmtcompile(const char *s)	/* parse format s the way format() does */
+{
+	Fmtcache *fc;
+	const char *lit, *beg;
+	int nalloc = 0, flag, fmtwd;
+
+	if ((fc = (Fmtcache *) calloc(1, sizeof(Fmtcache))) == NULL)
+		FATAL("out of memory compiling format %.30s...", s);
+	fc->fmt = tostring(s);
+	for (lit = s; *s; ) {
+		if (*s != '%') {
+			s++;
+			continue;
+		}
+		if (*(s+1) == '%') {	/* keep the first %, skip the second */
+			fmtadd(fc, &nalloc, FMTLIT, 0, 0, lit, s+1 - lit);
+			lit = s += 2;
+			continue;
+		}
+		if (s > lit)
+			fmtadd(fc, &nalloc, FMTLIT, 0, 0, lit, s - lit);
+		fmtwd = atoi(s+1);
+		if (fmtwd < 0)
+			fmtwd = -fmtwd;
+		for (beg = s; *s != '\0'; s++) {
+			if (isalpha((uschar)*s) && *s != 'l' && *s != 'h' && *s != 'L')
+				break;	/* the ansi panoply */
+			if (*s == '*') {	/* width comes from an argument */
+				fc->nitem = -1;
+				return fc;
+			}
+		}
+		switch (*s) {
+		case 'f': case 'e': case 'g': case 'E': case 'G':
+			flag = 'f';
+			break;
+		case 'd': case 'i':
+			flag = 'd';
+			break;
+		case 'o': case 'x': case 'X': case 'u':
+			flag = *(s-1) == 'l' ? 'd' : 'u';
+			break;
+		case 's':
+			flag = 's';
+			break;
+		case 'c':
+			flag = 'c';
+			break;
+		default:
+			flag = '?';
+			break;
+		}
+		if (flag == 'd' && (*s == 'd' || *s == 'i') && s == beg+1)
+			fmtadd(fc, &nalloc, FMTINT, flag, 0, beg, 2);
+		else if (flag == 's' && s == beg+1)
+			fmtadd(fc, &nalloc, FMTSTR, flag, 0, beg, 2);
+		else if (*s == 'f' && (s == beg+1 || (s == beg+3 && beg[1] == '.' && isdigit((uschar)beg[2])))) {
+			fmtadd(fc, &nalloc, FMTFIX, flag, 0, beg, s+1 - beg);
+			fc->item[fc->nitem-1].prec = s == beg+1 ? 6 : beg[2] - '0';
+		} else {
+			fmtadd(fc, &nalloc, FMTCONV, flag, fmtwd, beg, s + (*s != '\0') - beg);
+			if (flag == 'd' && (*s == 'd' || *s == 'i') && *(s-1) != 'l') {
+				Fmtitem *ip = &fc->item[fc->nitem-1];
+				ip->spec[ip->len-1] = 'l';	/* as format() does: %d => %ld */
+				ip->spec[ip->len++] = 'd';
+				ip->spec[ip->len] = '\0';
+			}
+		}
+		if (*s != '\0')
+			s++;
+		lit = s;
+	}
+	if (s > lit)
+		fmtadd(fc, &nalloc, FMTLIT, 0, 0, lit, s - lit);
+	return fc;
+}
+
+static void fmtfree(Fmtcache *fc)
+{
+	int i;
+
+	for (i = 0; i < fc->nitem; i++)
+		free(fc->item[i].spec);
+	free(fc->item);
+	free(fc->fmt);
+	free(fc);
+}
+
+static Fmtcache *fmtlookup(const char *s)	/* find or compile format s */
+{
+	Fmtcache *fc;
+	int i;
+
+	for (i = 0; i < NFMTCACHE && fmtcache[i] != NULL; i++)
+		if (strcmp(fmtcache[i]->fmt, s) == 0)
+			break;
+	if (i < NFMTCACHE && fmtcache[i] != NULL)
+		fc = fmtcache[i];
+	else {
+		fc = fmtcompile(s);
+		if (i == NFMTCACHE) {	/* full: drop the least recently used */
+			if (fmtcache[--i]->busy)
+				fmtcache[i]->dropped = 1;
+			else
+				fmtfree(fmtcache[i]);
+		}
+	}
+	for ( ; i > 0; i--)		/* move to the front */
+		fmtcache[i] = fmtcache[i-1];
+	fmtcache[0] = fc;
+	return fc->nitem < 0 ? NULL : fc;
+}
+
+static int fmtlong(char *p, long v)	/* decimal digits of v at p; returns length */
+{
+	char tmp[24], *t = tmp + sizeof(tmp);
+	unsigned long u = v < 0 ? -(unsigned long) v : (unsigned long) v;
+	int n;
+
+	do
+		*--t = '0' + u % 10;
+	while ((u /= 10) != 0);
+	if (v < 0)
+		*--t = '-';
+	n = tmp + sizeof(tmp) - t;
+	memcpy(p, t, n);
+	return n;
+}
+
+/* v as %.<prec>f would print it, prec <= 9; -1 if snprintf has to do it.
+ * v * 10^prec is rounded to an integer, which is right unless it is
+ * within the error of the product of a tie; big values, NaN and inf, and
+ * near ties go to snprintf. */
+static int fmtfixed(char *p, double v, int prec)
+{
+	static const double p10[] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+	double r, fr;
+	unsigned long k, sc = (unsigned long) p10[prec];
+	char *q = p;
+	int i;
+
+	r = fabs(v) * p10[prec];
+	if (!(r < 8796093022208.0))	/* 2^43, so the product is off by under 0.001 */
+		return -1;
+	k = (unsigned long) r;
+	fr = r - k;
+	if (fr > 0.49 && fr < 0.51)
+		return -1;
+	if (fr > 0.5)
+		k++;
+	if (signbit(v))		/* as printf: -0.00 */
+		*q++ = '-';
+	q += fmtlong(q, (long) (k / sc));
+	if (prec > 0) {
+		*q++ = '.';
+		k %= sc;
+		for (i = prec; i > 0; i--, k /= 10)
+			q[i-1] = '0' + k % 10;
+		q += prec;
+	}
+	return q - p;
+}
+
+static int fmtexec(char **pbuf, int *pbufsize, const char *os, Fmtcache *fc, Node *a)
+{
+	char *buf = *pbuf, *p, *t;
+	int bufsize = *pbufsize, i, n, avail;
+	Fmtitem *ip;
+	Cell *x;
+
+	p = buf;
+	fc->busy++;
+	for (i = 0; i < fc->nitem; i++) {
+		ip = &fc->item[i];
+		if (ip->type == FMTLIT) {
+			adjbuf(&buf, &bufsize, 1+ip->len+p-buf, recsize, &p, "fmtexec1");
+			memcpy(p, ip->spec, ip->len);
+			p += ip->len;
+			continue;
+		}
+		if (ip->flag == '?')
+			WARNING("weird printf conversion %s", ip->spec);
+		if (a == NULL)
+			FATAL("not enough args in printf(%s)", os);
+		x = execute(a);
+		a = a->nnext;
+		switch (ip->type) {
+		case FMTINT:
+			adjbuf(&buf, &bufsize, 1+MAXNUMSIZE+p-buf, recsize, &p, "fmtexec2");
+			p += fmtlong(p, (long) getfval(x));
+			break;
+		case FMTSTR:
+			t = getsval(x);
+			n = strlen(t);
+			if (!adjbuf(&buf, &bufsize, 1+n+p-buf, recsize, &p, "fmtexec3"))
+				FATAL("huge string/format (%d chars) in printf %.30s... ran format() out of memory", n, t);
+			memcpy(p, t, n);
+			p += n;
+			break;
+		case FMTFIX:
+			adjbuf(&buf, &bufsize, 1+MAXNUMSIZE+p-buf, recsize, &p, "fmtexec6");
+			if ((n = fmtfixed(p, getfval(x), ip->prec)) >= 0) {
+				p += n;
+				break;
+			}
+			/* else as any other conversion */
+		default:
+			n = ip->fmtwd > MAXNUMSIZE ? ip->fmtwd : MAXNUMSIZE;
+			if (ip->flag == 's' || ip->flag == '?') {
+				t = getsval(x);
+				n += strlen(t) + ip->len;
+			}
+			for (;;) {	/* until snprintf fits */
+				adjbuf(&buf, &bufsize, 1+n+p-buf, recsize, &p, "fmtexec4");
+				avail = bufsize - (p - buf);
+				switch (ip->flag) {
+				case '?':	/* unknown, so dump it too */
+					n = snprintf(p, avail, "%s%s", ip->spec, getsval(x));
+					break;
+				case 'f':	n = snprintf(p, avail, ip->spec, getfval(x)); break;
+				case 'd':	n = snprintf(p, avail, ip->spec, (long) getfval(x)); break;
+				case 'u':	n = snprintf(p, avail, ip->spec, (int) getfval(x)); break;
+				case 's':	n = snprintf(p, avail, ip->spec, getsval(x)); break;
+				case 'c':
+					if (isnum(x)) {
+						if (getfval(x))
+							snprintf(p, avail, ip->spec, (int) getfval(x));
+						else {
+							*p++ = '\0'; /* explicit null byte */
+							*p = '\0';   /* next output will start here */
+						}
+					} else
+						snprintf(p, avail, ip->spec, getsval(x)[0]);
+					n = strlen(p);	/* %c of "" adds nothing */
+					break;
+				default:
+					FATAL("can't happen: bad conversion %c in format()", ip->flag);
+				}
+				if (n < avail)
+					break;
+				n++;
+			}
+			p += n;
+			break;
+		}
+		tempfree(x);
+	}
+	adjbuf(&buf, &bufsize, 1+p-buf, recsize, &p, "fmtexec5");
+	*p = '\0';
+	if (--fc->busy == 0 && fc->dropped)
+		fmtfree(fc);
+	for ( ; a; a = a->nnext)		/* evaluate any remaining args */
+		execute(a);
+	*pbuf = buf;
+	*pbufsize = bufsize;
+	return p - buf;
+}
+
+Node *fmtconst(Node *a)	/* format a compiled, if printf or sprintf can use it so */
+{
+	Fmtcache *fc;
+	Cell *x;
+
+	if (a == NULL || !isvalue(a))
+		return NULL;
+	x = (Cell *) a->narg[0];
+	if ((x->tval & (CON|STR)) != (CON|STR))
+		return NULL;
+	fc = fmtcompile(x->sval);
+	if (fc->nitem < 0) {
+		fmtfree(fc);
+		return NULL;
+	}
+	return (Node *) fc;
+}
+
 int format(char **pbuf, int *pbufsize, const char *s, Node *a)	/* printf-like conversions */
 {
 	char *fmt;
@@ -820,7 +1194,10 @@ int format(char **pbuf, int *pbufsize, const char *s, Node *a)	/* printf-like co
 	int fmtsz = recsize;
 	char *buf = *pbuf;
 	int bufsize = *pbufsize;
+	Fmtcache *fc;
 
+	if ((fc = fmtlookup(s)) != NULL)
+		return fmtexec(pbuf, pbufsize, s, fc, a);
 	os = s;
 	p = buf;
 	if ((fmt = (char *) malloc(fmtsz)) == NULL)
@@ -954,10 +1331,15 @@ Cell *awksprintf(Node **a, int n)		/* sprintf(a[0]) */
 	if ((buf = (char *) malloc(bufsz)) == NULL)
 		FATAL("out of memory in awksprintf");
 	y = a[0]->nnext;
-	x = execute(a[0]);
-	if (format(&buf, &bufsz, getsval(x), y) == -1)
-		FATAL("sprintf string %.30s... too long.  can't happen.", buf);
-	tempfree(x);
+	if (a[1] != NULL) {	/* compiled by the parser */
+		if (fmtexec(&buf, &bufsz, ((Fmtcache *) a[1])->fmt, (Fmtcache *) a[1], y) == -1)
+			FATAL("sprintf string %.30s... too long.  can't happen.", buf);
+	} else {
+		x = execute(a[0]);
+		if (format(&buf, &bufsz, getsval(x), y) == -1)
+			FATAL("sprintf string %.30s... too long.  can't happen.", buf);
+		tempfree(x);
+	}
 	x = gettemp();
 	x->sval = buf;
 	x->tval = STR;
@@ -977,10 +1359,15 @@ Cell *awkprintf(Node **a, int n)		/* printf */
 	if ((buf = (char *) malloc(bufsz)) == NULL)
 		FATAL("out of memory in awkprintf");
 	y = a[0]->nnext;
-	x = execute(a[0]);
-	if ((len = format(&buf, &bufsz, getsval(x), y)) == -1)
-		FATAL("printf string %.30s... too long.  can't happen.", buf);
-	tempfree(x);
+	if (a[3] != NULL) {	/* compiled by the parser */
+		if ((len = fmtexec(&buf, &bufsz, ((Fmtcache *) a[3])->fmt, (Fmtcache *) a[3], y)) == -1)
+			FATAL("printf string %.30s... too long.  can't happen.", buf);
+	} else {
+		x = execute(a[0]);
+		if ((len = format(&buf, &bufsz, getsval(x), y)) == -1)
+			FATAL("printf string %.30s... too long.  can't happen.", buf);
+		tempfree(x);
+	}
 	if (a[1] == NULL) {
 		/* fputs(buf, stdout); */
 		fwrite(buf, len, 1, stdout);
@@ -1083,24 +1470,91 @@ Cell *incrdecr(Node **a, int n)		/* a[0]++, etc. */
 	return(z);
 }
 
+#define	MAXSELFCAT	16	/* longest v = v a b ... done in place */
+
+static int samevar(Node *p, Node *q)	/* p and q name the same variable */
+{
+	if (isvalue(p) && isvalue(q))
+		return p->narg[0] == q->narg[0];
+	return isexpr(p) && isexpr(q) && p->nobj == ARG && q->nobj == ARG
+		&& p->narg[0] == q->narg[0];
+}
+
+/* v = v a b ...: append a, b, ... to the string of v in place.  Its buffer
+ * grows geometrically (SGROW), so building a string piece by piece is linear
+ * rather than quadratic.  returns 0 if a[1] isn't such a concatenation. */
+static Cell *selfcat(Node **a)
+{
+	Node *ops[MAXSELFCAT], *p;
+	Cell *x, *y[MAXSELFCAT];
+	size_t n0, n, cap, k;
+	int i, nops;
+	char *s;
+
+	for (p = a[1], nops = 0; isexpr(p) && p->nobj == CAT; p = p->narg[0]) {
+		if (nops == MAXSELFCAT)
+			return 0;
+		ops[nops++] = p->narg[1];
+	}
+	if (nops == 0 || !samevar(p, a[0]))
+		return 0;
+	x = execute(a[0]);
+	if ((x->tval & (STR|NUM)) == 0 || (x->tval & (FLD|REC|CON|ARR|FCN)))
+		return 0;
+	for (i = 0; i < nops; i++) {	/* left to right, as cat() would */
+		y[i] = execute(ops[nops-1-i]);
+		getsval(y[i]);
+	}
+	s = getsval(x);
+	n = n0 = getslen(x);
+	for (i = 0; i < nops; i++)
+		n += getslen(y[i]);
+	if (!(x->tval & SGROW) || !freeable(x) || n + 1 > strcap(n0 + 1)) {
+		cap = strcap(n + 1);
+		if (freeable(x) && !(x->tval & SREF))
+			s = (char *) realloc(s, cap);
+		else if ((s = (char *) malloc(cap)) != NULL)
+			memcpy(s, x->sval, n0);
+		if (s == NULL)
+			FATAL("out of space concatenating %.15s...", x->sval);
+		if (x->tval & SREF)	/* s has the copy; others may share the old */
+			freesval(x);
+	}
+	for (i = 0, n = n0; i < nops; i++) {
+		k = y[i] == x ? n0 : y[i]->slen;
+		memcpy(s + n, y[i] == x ? s : y[i]->sval, k);	/* s = s s copies the old s */
+		n += k;
+	}
+	s[n] = '\0';
+	x->sval = s;
+	x->slen = n;
+	x->tval &= ~(NUM|DONTFREE|SREF);
+	x->tval |= STR|SLEN|SGROW;
+	for (i = 0; i < nops; i++)
+		tempfree(y[i]);
+	return x;
+}
+
 Cell *assign(Node **a, int n)	/* a[0] = a[1], a[0] += a[1], etc. */
 {		/* this is subtle; don't muck with it. */
 	Cell *x, *y;
 	Awkfloat xf, yf;
 	double v;
 
+	if (n == ASSIGN && (x = selfcat(a)) != NULL)
+		return(x);
 	y = execute(a[1]);
 	x = execute(a[0]);
 	if (n == ASSIGN) {	/* ordinary assignment */
 		if (x == y && !(x->tval & (FLD|REC)))	/* self-assignment: */
 			;		/* leave alone unless it's a field */
 		else if ((y->tval & (STR|NUM)) == (STR|NUM)) {
-			setsval(x, getsval(y));
+			copysval(x, y);
 			x->fval = getfval(y);
 			x->tval |= NUM;
 		}
 		else if (isstr(y))
-			setsval(x, getsval(y));
+			copysval(x, y);
 		else if (isnum(y))
 			setfval(x, getfval(y));
 		else
@@ -1149,26 +1603,28 @@ Cell *assign(Node **a, int n)	/* a[0] = a[1], a[0] += a[1], etc. */
 Cell *cat(Node **a, int q)	/* a[0] cat a[1] */
 {
 	Cell *x, *y, *z;
-	int n1, n2;
+	size_t n1, n2;
 	char *s;
 
 	x = execute(a[0]);
 	y = execute(a[1]);
-	getsval(x);
-	getsval(y);
-	n1 = strlen(x->sval);
-	n2 = strlen(y->sval);
-	s = (char *) malloc(n1 + n2 + 1);
-	if (s == NULL)
-		FATAL("out of space concatenating %.15s... and %.15s...",
-			x->sval, y->sval);
-	strcpy(s, x->sval);
-	strcpy(s+n1, y->sval);
-	tempfree(x);
-	tempfree(y);
+	n1 = getslen(x);
+	n2 = getslen(y);
 	z = gettemp();
+	z->tval = STR|SLEN;
+	if (n1 + n2 < NSBUF) {
+		s = z->sbuf;
+		z->tval |= DONTFREE;
+	} else {
+		s = stralloc(n1 + n2);	/* so an assignment can take it over */
+		z->tval |= SREF;
+	}
+	memcpy(s, x->sval, n1);
+	memcpy(s+n1, y->sval, n2+1);
 	z->sval = s;
-	z->tval = STR;
+	z->slen = n1 + n2;
+	tempfree(x);
+	tempfree(y);
 	return(z);
 }
 
@@ -1216,8 +1672,9 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 	Cell *x = 0, *y, *ap;
 	char *s;
 	int sep;
-	char *t, temp, num[50], *fs = 0;
+	char *t, temp, *fs = 0, *copy = NULL;
 	int n, tempstat, arg3type;
+	Array *tp;
 
 	y = execute(a[0]);	/* source string */
 	s = getsval(y);
@@ -1233,11 +1690,17 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 		FATAL("illegal type of split");
 	sep = *fs;
 	ap = execute(a[1]);	/* array name */
-	freesymtab(ap);
 	   dprintf( ("split: s=|%s|, a=%s, sep=|%s|\n", s, NN(ap->nval), fs) );
-	ap->tval &= ~STR;
-	ap->tval |= ARR;
-	ap->sval = (char *) makesymtab(NSYMTAB);
+	if (!istemp(y) && !(y->tval & (FLD|REC)))
+		s = copy = tostring(s);	/* y may be an element of ap */
+	if (isarr(ap) && ((Array *) ap->sval)->ndense >= 0) {
+		tp = (Array *) ap->sval;	/* refill the elements in place */
+	} else {
+		freesymtab(ap);
+		ap->tval &= ~STR;
+		ap->tval |= ARR;
+		ap->sval = (char *) (tp = makesymtab(NSYMTAB));
+	}
 
 	n = 0;
         if (arg3type == REGEXPR && strlen((char*)((fa*)a[2])->restr) == 0) {
@@ -1258,19 +1721,17 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 			pfa->initstat = 2;
 			do {
 				n++;
-				sprintf(num, "%d", n);
 				temp = *patbeg;
 				*patbeg = '\0';
 				if (is_number(s))
-					setsymtab(num, s, atof(s), STR|NUM, (Array *) ap->sval);
+					setnumsymtab(n, s, atof(s), STR|NUM, tp);
 				else
-					setsymtab(num, s, 0.0, STR, (Array *) ap->sval);
+					setnumsymtab(n, s, 0.0, STR, tp);
 				*patbeg = temp;
 				s = patbeg + patlen;
 				if (*(patbeg+patlen-1) == 0 || *s == 0) {
 					n++;
-					sprintf(num, "%d", n);
-					setsymtab(num, "", 0.0, STR, (Array *) ap->sval);
+					setnumsymtab(n, "", 0.0, STR, tp);
 					pfa->initstat = tempstat;
 					goto spdone;
 				}
@@ -1279,11 +1740,10 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 							/* cf gsub and refldbld */
 		}
 		n++;
-		sprintf(num, "%d", n);
 		if (is_number(s))
-			setsymtab(num, s, atof(s), STR|NUM, (Array *) ap->sval);
+			setnumsymtab(n, s, atof(s), STR|NUM, tp);
 		else
-			setsymtab(num, s, 0.0, STR, (Array *) ap->sval);
+			setnumsymtab(n, s, 0.0, STR, tp);
   spdone:
 		pfa = NULL;
 	} else if (sep == ' ') {
@@ -1299,11 +1759,10 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 			while (*s!=' ' && *s!='\t' && *s!='\n' && *s!='\0');
 			temp = *s;
 			*s = '\0';
-			sprintf(num, "%d", n);
 			if (is_number(t))
-				setsymtab(num, t, atof(t), STR|NUM, (Array *) ap->sval);
+				setnumsymtab(n, t, atof(t), STR|NUM, tp);
 			else
-				setsymtab(num, t, 0.0, STR, (Array *) ap->sval);
+				setnumsymtab(n, t, 0.0, STR, tp);
 			*s = temp;
 			if (*s != 0)
 				s++;
@@ -1312,13 +1771,12 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 		for (n = 0; *s != 0; s++) {
 			char buf[2];
 			n++;
-			sprintf(num, "%d", n);
 			buf[0] = *s;
 			buf[1] = 0;
 			if (isdigit((uschar)buf[0]))
-				setsymtab(num, buf, atof(buf), STR|NUM, (Array *) ap->sval);
+				setnumsymtab(n, buf, atof(buf), STR|NUM, tp);
 			else
-				setsymtab(num, buf, 0.0, STR, (Array *) ap->sval);
+				setnumsymtab(n, buf, 0.0, STR, tp);
 		}
 	} else if (*s != 0) {
 		for (;;) {
@@ -1328,18 +1786,21 @@ Cell *split(Node **a, int nnn)	/* split(a[0], a[1], a[2]); a[3] is type */
 				s++;
 			temp = *s;
 			*s = '\0';
-			sprintf(num, "%d", n);
 			if (is_number(t))
-				setsymtab(num, t, atof(t), STR|NUM, (Array *) ap->sval);
+				setnumsymtab(n, t, atof(t), STR|NUM, tp);
 			else
-				setsymtab(num, t, 0.0, STR, (Array *) ap->sval);
+				setnumsymtab(n, t, 0.0, STR, tp);
 			*s = temp;
 			if (*s++ == 0)
 				break;
 		}
 	}
+	trimsymtab(tp, n);
+	if (copy)
+		free(copy);	/* y isn't a temp, and may be gone */
+	else
+		tempfree(y);
 	tempfree(ap);
-	tempfree(y);
 	if (a[2] != 0 && arg3type == STRING) {
 		tempfree(x);
 	}
@@ -1444,7 +1905,8 @@ Cell *instat(Node **a, int n)	/* for (a[0] in a[1]) a[2] */
 {
 	Cell *x, *vp, *arrayp, *cp, *ncp;
 	Array *tp;
-	int i;
+	int i, ne;
+	char num[20];
 
 	vp = execute(a[0]);
 	arrayp = execute(a[1]);
@@ -1453,9 +1915,33 @@ Cell *instat(Node **a, int n)	/* for (a[0] in a[1]) a[2] */
 	}
 	tp = (Array *) arrayp->sval;
 	tempfree(arrayp);
+	if ((ne = tp->ndense) >= 0) {	/* "1".."n" in order; the hash table is empty */
+		for (i = 0; i < ne; i++) {
+			if (tp->ndense >= 0)	/* unless the body has hashed it */
+				cp = i < tp->ndense ? tp->dense[i] : NULL;
+			else {
+				sprintf(num, "%d", i + 1);
+				cp = lookup(num, tp);
+			}
+			if (cp == NULL)
+				continue;
+			setsnbuf(vp, cp->nval, strlen(cp->nval));
+			x = execute(a[2]);
+			if (isbreak(x)) {
+				tempfree(vp);
+				return True;
+			}
+			if (isnext(x) || isexit(x) || isret(x)) {
+				tempfree(vp);
+				return(x);
+			}
+			tempfree(x);
+		}
+		return True;
+	}
 	for (i = 0; i < tp->size; i++) {	/* this routine knows too much */
 		for (cp = tp->tab[i]; cp != NULL; cp = ncp) {
-			setsval(vp, cp->nval);
+			setsnbuf(vp, cp->nval, strlen(cp->nval));
 			ncp = cp->cnext;
 			x = execute(a[2]);
 			if (isbreak(x)) {
@@ -1491,7 +1977,7 @@ Cell *bltin(Node **a, int n)	/* builtin functions. a[0] is type, a[1] is arg lis
 		if (isarr(x))
 			u = ((Array *) x->sval)->nelem;	/* GROT.  should be function*/
 		else
-			u = strlen(getsval(x));
+			u = getslen(x);
 		break;
 	case FLOG:
 		u = errcheck(log(getfval(x)), "log"); break;
@@ -1517,7 +2003,7 @@ Cell *bltin(Node **a, int n)	/* builtin functions. a[0] is type, a[1] is arg lis
 		}
 		break;
 	case FSYSTEM:
-		fflush(stdout);		/* in case something is buffered already */
+		throut_sync();		/* in case something is buffered already */
 		u = (Awkfloat) system(getsval(x)) / 256;   /* 256 is unix-dep */
 		break;
 	case FRAND:
@@ -1557,8 +2043,8 @@ Cell *bltin(Node **a, int n)	/* builtin functions. a[0] is type, a[1] is arg lis
 			u = 0;
 		} else if ((fp = openfile(FFLUSH, getsval(x))) == NULL)
 			u = EOF;
-		else
-			u = fflush(fp);
+		else if ((u = fflush(fp)) == 0 && fp == stdout)
+			throut_sync();
 		break;
 	default:	/* can't happen */
 		if ((y = bio_func(t, x, a)) != 0) {
@@ -1684,7 +2170,7 @@ FILE *openfile(int a, const char *us)
 		nfiles = nnf;
 		files = nf;
 	}
-	fflush(stdout);	/* force a semblance of order */
+	throut_sync();	/* force a semblance of order */
 	m = a;
 	if (a == GT) {
 		fp = fopen(s, "w");
@@ -1773,20 +2259,115 @@ void flush_all(void)
 	for (i = 0; i < nfiles; i++)
 		if (files[i].fp)
 			fflush(files[i].fp);
+	throut_sync();
 }
 
 void backsub(char **pb_ptr, char **sptr_ptr);
 
+/* sub and gsub build their result in one pass: the text between matches
+ * goes over in bulk, and the replacement is expanded once, before any
+ * matching.  for a byte, a run of bytes out of a set, or a literal string
+ * (see simplere in b.c) matches are found by scanning, without pmatch. */
+
+typedef struct {	/* replacement text, \ sequences done */
+	char	*s;
+	size_t	n;
+	size_t	*amp;	/* offsets in s where the matched text goes */
+	int	namp;
+} Repl;
+
+typedef struct {	/* result, in a buffer from stralloc */
+	char	*buf;
+	size_t	n, size;
+} Outbuf;
+
+static void mkrepl(Repl *r, char *sptr)
+{
+	char *pb;
+	size_t n = strlen(sptr);
+
+	r->s = (char *) malloc(n + 1);	/* backsub never lengthens */
+	r->amp = (size_t *) malloc((n + 1) * sizeof(size_t));
+	if (r->s == NULL || r->amp == NULL)
+		FATAL("out of memory in sub");
+	pb = r->s;
+	r->namp = 0;
+	while (*sptr != 0) {
+		if (*sptr == '\\') {
+			backsub(&pb, &sptr);
+		} else if (*sptr == '&') {
+			sptr++;
+			r->amp[r->namp++] = pb - r->s;
+		} else
+			*pb++ = *sptr++;
+	}
+	r->n = pb - r->s;
+}
+
+static void output(Outbuf *o, const char *s, size_t n)
+{
+	if (o->n + n > o->size) {
+		o->size = o->n + n > 2 * o->size ? o->n + n : 2 * o->size;
+		o->buf = strgrow(o->buf, o->size);
+	}
+	memcpy(o->buf + o->n, s, n);
+	o->n += n;
+}
+
+static void outrepl(Outbuf *o, const Repl *r, const char *m, size_t mlen)	/* r, with m for & */
+{
+	size_t k = 0;
+	int i;
+
+	for (i = 0; i < r->namp; i++) {
+		output(o, r->s + k, r->amp[i] - k);
+		output(o, m, mlen);
+		k = r->amp[i];
+	}
+	output(o, r->s + k, r->n - k);
+}
+
+static const char *simplematch(fa *f, const char *s, const char *end, size_t *len)
+{			/* leftmost longest match of a simplere in s, or NULL */
+	const char *p;
+
+	switch (f->simple) {
+	case RESET:
+		*len = 1;
+		return byteset_find(f->sset, s, end - s);
+	case RERUN:
+		if ((p = byteset_find(f->sset, s, end - s)) != NULL)
+			*len = 1 + byteset_span(f->sset, p + 1, end - (p + 1));
+		return p;
+	default:
+		*len = f->slitlen;
+		return memfind(s, end - s, f->slit, f->slitlen);
+	}
+}
+
+static size_t matchlen(const char *end)	/* patlen, not counting past end */
+{
+	return patbeg + patlen > end ? (size_t) (end - patbeg) : (size_t) patlen;
+}
+
+static void subresult(Cell *x, Outbuf *o)	/* make o the string val of x */
+{
+	if (o->size - o->n > 4096)
+		o->buf = strgrow(o->buf, o->n);
+	o->buf[o->n] = '\0';
+	takesval(x, o->buf, o->n);
+}
+
 Cell *sub(Node **a, int nnn)	/* substitute command */
 {
-	char *sptr, *pb, *q;
 	Cell *x, *y, *result;
-	char *t, *buf;
+	char *t, *end;
+	const char *m;
+	size_t mlen;
 	fa *pfa;
-	int bufsz = recsize;
+	Repl r;
+	Outbuf o;
 
-	if ((buf = (char *) malloc(bufsz)) == NULL)
-		FATAL("out of memory in sub");
 	x = execute(a[3]);	/* target string */
 	t = getsval(x);
 	if (a[0] == 0)		/* 0 => a[1] is already-compiled regexpr */
@@ -1797,57 +2378,43 @@ Cell *sub(Node **a, int nnn)	/* substitute command */
 		tempfree(y);
 	}
 	y = execute(a[2]);	/* replacement string */
+	end = t + strlen(t);
 	result = False;
-	if (pmatch(pfa, t)) {
-		sptr = t;
-		adjbuf(&buf, &bufsz, 1+patbeg-sptr, recsize, 0, "sub");
-		pb = buf;
-		while (sptr < patbeg)
-			*pb++ = *sptr++;
-		sptr = getsval(y);
-		while (*sptr != 0) {
-			adjbuf(&buf, &bufsz, 5+pb-buf, recsize, &pb, "sub");
-			if (*sptr == '\\') {
-				backsub(&pb, &sptr);
-			} else if (*sptr == '&') {
-				sptr++;
-				adjbuf(&buf, &bufsz, 1+patlen+pb-buf, recsize, &pb, "sub");
-				for (q = patbeg; q < patbeg+patlen; )
-					*pb++ = *q++;
-			} else
-				*pb++ = *sptr++;
-		}
-		*pb = '\0';
-		if (pb > buf + bufsz)
-			FATAL("sub result1 %.30s too big; can't happen", buf);
-		sptr = patbeg + patlen;
-		if ((patlen == 0 && *patbeg) || (patlen && *(sptr-1))) {
-			adjbuf(&buf, &bufsz, 1+strlen(sptr)+pb-buf, 0, &pb, "sub");
-			while ((*pb++ = *sptr++) != 0)
-				;
-		}
-		if (pb > buf + bufsz)
-			FATAL("sub result2 %.30s too big; can't happen", buf);
-		setsval(x, buf);	/* BUG: should be able to avoid copy */
-		result = True;;
+	if (pfa->simple)
+		m = simplematch(pfa, t, end, &mlen);
+	else if (pmatch(pfa, t))
+		m = patbeg, mlen = matchlen(end);
+	else
+		m = NULL;
+	if (m != NULL) {
+		mkrepl(&r, getsval(y));
+		o.size = (end - t) - mlen + r.n + r.namp * mlen;
+		o.buf = stralloc(o.size);
+		o.n = 0;
+		output(&o, t, m - t);
+		outrepl(&o, &r, m, mlen);
+		output(&o, m + mlen, end - (m + mlen));
+		subresult(x, &o);
+		free(r.s);
+		free(r.amp);
+		result = True;
 	}
 	tempfree(x);
 	tempfree(y);
-	free(buf);
 	return result;
 }
 
 Cell *gsub(Node **a, int nnn)	/* global substitute */
 {
 	Cell *x, *y;
-	char *rptr, *sptr, *t, *pb, *q;
-	char *buf;
+	char *t, *end;
+	const char *m;
+	size_t mlen;
 	fa *pfa;
 	int mflag, tempstat, num;
-	int bufsz = recsize;
+	Repl r;
+	Outbuf o;
 
-	if ((buf = (char *) malloc(bufsz)) == NULL)
-		FATAL("out of memory in gsub");
 	mflag = 0;	/* if mflag == 0, can replace empty string */
 	num = 0;
 	x = execute(a[3]);	/* target string */
@@ -1860,81 +2427,59 @@ Cell *gsub(Node **a, int nnn)	/* global substitute */
 		tempfree(y);
 	}
 	y = execute(a[2]);	/* replacement string */
-	if (pmatch(pfa, t)) {
+	end = t + strlen(t);
+	mkrepl(&r, getsval(y));
+	o.buf = NULL;
+	o.size = end - t + r.n;	/* exact for one-for-one replacements */
+	o.n = 0;
+	if (pfa->simple) {	/* never matches the empty string */
+		for (; (m = simplematch(pfa, t, end, &mlen)) != NULL; t = (char *) m + mlen) {
+			if (num++ == 0)
+				o.buf = stralloc(o.size);
+			output(&o, t, m - t);
+			outrepl(&o, &r, m, mlen);
+		}
+		if (num > 0) {
+			output(&o, t, end - t);
+			subresult(x, &o);
+		}
+	} else if (pmatch(pfa, t)) {
+		o.buf = stralloc(o.size);
 		tempstat = pfa->initstat;
 		pfa->initstat = 2;
-		pb = buf;
-		rptr = getsval(y);
 		do {
 			if (patlen == 0 && *patbeg != 0) {	/* matched empty string */
 				if (mflag == 0) {	/* can replace empty */
 					num++;
-					sptr = rptr;
-					while (*sptr != 0) {
-						adjbuf(&buf, &bufsz, 5+pb-buf, recsize, &pb, "gsub");
-						if (*sptr == '\\') {
-							backsub(&pb, &sptr);
-						} else if (*sptr == '&') {
-							sptr++;
-							adjbuf(&buf, &bufsz, 1+patlen+pb-buf, recsize, &pb, "gsub");
-							for (q = patbeg; q < patbeg+patlen; )
-								*pb++ = *q++;
-						} else
-							*pb++ = *sptr++;
-					}
+					outrepl(&o, &r, patbeg, 0);
 				}
 				if (*t == 0)	/* at end */
 					goto done;
-				adjbuf(&buf, &bufsz, 2+pb-buf, recsize, &pb, "gsub");
-				*pb++ = *t++;
-				if (pb > buf + bufsz)	/* BUG: not sure of this test */
-					FATAL("gsub result0 %.30s too big; can't happen", buf);
+				output(&o, t++, 1);
 				mflag = 0;
 			}
 			else {	/* matched nonempty string */
 				num++;
-				sptr = t;
-				adjbuf(&buf, &bufsz, 1+(patbeg-sptr)+pb-buf, recsize, &pb, "gsub");
-				while (sptr < patbeg)
-					*pb++ = *sptr++;
-				sptr = rptr;
-				while (*sptr != 0) {
-					adjbuf(&buf, &bufsz, 5+pb-buf, recsize, &pb, "gsub");
-					if (*sptr == '\\') {
-						backsub(&pb, &sptr);
-					} else if (*sptr == '&') {
-						sptr++;
-						adjbuf(&buf, &bufsz, 1+patlen+pb-buf, recsize, &pb, "gsub");
-						for (q = patbeg; q < patbeg+patlen; )
-							*pb++ = *q++;
-					} else
-						*pb++ = *sptr++;
-				}
-				t = patbeg + patlen;
-				if (patlen == 0 || *t == 0 || *(t-1) == 0)
+				mlen = matchlen(end);
+				output(&o, t, patbeg - t);
+				outrepl(&o, &r, patbeg, mlen);
+				t = patbeg + mlen;
+				if (patlen == 0 || t == end)
 					goto done;
-				if (pb > buf + bufsz)
-					FATAL("gsub result1 %.30s too big; can't happen", buf);
 				mflag = 1;
 			}
 		} while (pmatch(pfa,t));
-		sptr = t;
-		adjbuf(&buf, &bufsz, 1+strlen(sptr)+pb-buf, 0, &pb, "gsub");
-		while ((*pb++ = *sptr++) != 0)
-			;
-	done:	if (pb < buf + bufsz)
-			*pb = '\0';
-		else if (*(pb-1) != '\0')
-			FATAL("gsub result2 %.30s truncated; can't happen", buf);
-		setsval(x, buf);	/* BUG: should be able to avoid copy + free */
+		output(&o, t, end - t);
+	done:	subresult(x, &o);
 		pfa->initstat = tempstat;
 	}
+	free(r.s);
+	free(r.amp);
 	tempfree(x);
 	tempfree(y);
 	x = gettemp();
 	x->tval = NUM;
 	x->fval = num;
-	free(buf);
 	return(x);
 }
 
@@ -0,0 +1,163 @@
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include "seqpack.h"
+
+static const unsigned char nt_code[256] = {
+    ['A'] = 1, ['C'] = 2, ['G'] = 4, ['T'] = 8, ['N'] = 15,
+    ['a'] = 1, ['c'] = 2, ['g'] = 4, ['t'] = 8, ['n'] = 15
+};
+static const char nt_char[16] = { 0, 'A', 'C', 0, 'G', 0, 0, 0, 'T', 0, 0, 0, 0, 0, 0, 'N' };
+static const char nt_val[16] = { 4, 2, 1, 4, 3, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4 };
+
+#define NIB_LOW 0x1111111111111111ULL /* low bit of every nibble */
+
+#define NIB_BASE 0x8116 /* bit c set for the code c of A, C, G, T and N */
+
+int seqpack_is(const char *s)
+{
+    const unsigned char *u = (const unsigned char *)s;
+
+    if (u[0] != SEQPACK_MARK || u[1] == '\0') return 0;
+    for (++u; *u; ++u)
+        if (!(NIB_BASE >> (*u >> 4) & 1) || !(NIB_BASE >> (*u & 0xf) & 1 || ((*u & 0xf) == 0 && u[1] == '\0')))
+            return 0;
+    return 1;
+}
+
+char *seqpack(const char *s)
+{
+    size_t i, n = strlen(s);
+    const unsigned char *u = (const unsigned char *)s;
+    char *p, *d;
+
+    if (n == 0) return 0;
+    for (i = 0; i < n; ++i)
+        if (nt_code[u[i]] == 0) return 0;
+    p = (char *)malloc(2 + (n + 1) / 2);
+    p[0] = SEQPACK_MARK;
+    for (i = 0, d = p + 1; i + 1 < n; i += 2)
+        *d++ = nt_code[u[i]] << 4 | nt_code[u[i+1]];
+    if (n & 1) *d++ = nt_code[u[n-1]] << 4;
+    *d = '\0';
+    return p;
+}
+
+size_t seqpack_len(const char *p)
+{
+    size_t nb = strlen(p) - 1;
+
+    if (nb == 0) return 0;
+    return 2 * nb - ((p[nb] & 0xf) == 0);
+}
+
+char *sequnpack(const char *p)
+{
+    size_t i, n = seqpack_len(p);
+    char *s = (char *)malloc(n + 1);
+
+    for (i = 0; i < n; ++i)
+        s[i] = nt_char[seqpack_nib(p, i)];
+    s[n] = '\0';
+    return s;
+}
+
+/* reverse the nibbles of x and, for comp, the bits of each nibble: reversing
+ * the bits of A 0001, C 0010, G 0100, T 1000 and N 1111 complements them */
+static inline uint64_t rev_word(uint64_t x, int comp)
+{
+    if (comp) {
+        x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    }
+    x = ((x >> 4) & 0x0f0f0f0f0f0f0f0fULL) | ((x & 0x0f0f0f0f0f0f0f0fULL) << 4);
+    return __builtin_bswap64(x);
+}
+
+static inline unsigned char rev_byte(unsigned char c, int comp)
+{
+    return rev_word(c, comp) >> 56;
+}
+
+void seqpack_reverse(char *p, int comp)
+{
+    unsigned char *d = (unsigned char *)p + 1, t;
+    size_t i, lo = 0, hi = strlen(p) - 1, nb = hi;
+    int odd = nb > 0 && (d[nb-1] & 0xf) == 0;
+    uint64_t a, b;
+
+    while (hi - lo >= 16) {
+        memcpy(&a, d + lo, 8);
+        memcpy(&b, d + hi - 8, 8);
+        a = rev_word(a, comp), b = rev_word(b, comp);
+        memcpy(d + lo, &b, 8);
+        memcpy(d + hi - 8, &a, 8);
+        lo += 8, hi -= 8;
+    }
+    for (; hi - lo >= 2; ++lo, --hi) {
+        t = rev_byte(d[lo], comp);
+        d[lo] = rev_byte(d[hi-1], comp);
+        d[hi-1] = t;
+    }
+    if (hi > lo) d[lo] = rev_byte(d[lo], comp);
+    if (odd) { /* the padding nibble is now first: shift it to the end */
+        for (i = 0; i + 1 < nb; ++i)
+            d[i] = d[i] << 4 | d[i+1] >> 4;
+        d[nb-1] <<= 4;
+    }
+}
+
+size_t seqpack_gc(const char *p)
+{
+    const unsigned char *d = (const unsigned char *)p + 1;
+    size_t i, nb = strlen(p) - 1, gc = 0;
+    uint64_t w;
+
+    /* C 0010 and G 0100 are the codes with bit 1 or 2 set and bit 0 clear */
+    for (i = 0; i + 8 <= nb; i += 8) {
+        memcpy(&w, d + i, 8);
+        gc += __builtin_popcountll(((w >> 1) | (w >> 2)) & ~w & NIB_LOW);
+    }
+    for (; i < nb; ++i) {
+        w = d[i];
+        gc += __builtin_popcountll(((w >> 1) | (w >> 2)) & ~w & NIB_LOW);
+    }
+    return gc;
+}
+
+/* mismatches of p against q starting at base qofs, as hamming() counts
+ * them: bases of p past the end of q are mismatches */
+size_t seqpack_hamming(const char *p, const char *q, size_t qofs)
+{
+    const unsigned char *a = (const unsigned char *)p + 1, *b;
+    size_t i, n = seqpack_len(p), m = seqpack_len(q), k, diff;
+    uint64_t x, y;
+
+    k = m > qofs ? m - qofs : 0;
+    if (k > n) k = n;
+    diff = n - k;
+    if (qofs & 1) {
+        for (i = 0; i < k; ++i)
+            diff += seqpack_nib(p, i) != seqpack_nib(q, qofs + i);
+        return diff;
+    }
+    b = (const unsigned char *)q + 1 + qofs / 2;
+    for (i = 0; i + 8 <= k / 2; i += 8) {
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        x ^= y;
+        diff += __builtin_popcountll((x | x >> 1 | x >> 2 | x >> 3) & NIB_LOW);
+    }
+    for (; i < k / 2; ++i) {
+        x = a[i] ^ b[i];
+        diff += __builtin_popcountll((x | x >> 1 | x >> 2 | x >> 3) & NIB_LOW);
+    }
+    if (k & 1)
+        diff += seqpack_nib(p, k - 1) != seqpack_nib(q, qofs + k - 1);
+    return diff;
+}
+
+int seqpack_ntval(int nib)
+{
+    return nt_val[nib & 0xf];
+}
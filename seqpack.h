@@ -0,0 +1,27 @@
+#ifndef SEQPACK_H
+#define SEQPACK_H
+
+#include <stddef.h>
+
+/* Packed nucleotide strings made by seqpack(). A packed string is SEQPACK_MARK
+ * followed by two bases per byte, first base in the high nibble, coded as in
+ * nt4bit[] of end_adapter.h: A 1, C 2, G 4, T 8, N 15. No nibble of a base is
+ * 0, so a packed string never contains a NUL and is an ordinary awk string;
+ * an odd length leaves a 0 low nibble in the last byte. The mark is in the
+ * string itself, so seqpack_is() checks every nibble; a string that passes
+ * is taken as packed whoever made it. */
+
+#define SEQPACK_MARK '\001'
+
+#define seqpack_nib(p, i) ((((const unsigned char *)(p))[1 + ((i)>>1)] >> ((i)&1? 0 : 4)) & 0xf)
+
+int seqpack_is(const char *s);         /* whether s is packed: SEQPACK_MARK then only base nibbles */
+char *seqpack(const char *s);          /* malloc'd packed copy of s, or NULL if s isn't ACGTN */
+char *sequnpack(const char *p);        /* malloc'd upper case ACGTN string */
+size_t seqpack_len(const char *p);     /* number of bases */
+void seqpack_reverse(char *p, int comp); /* in place; comp != 0 for the reverse complement */
+size_t seqpack_gc(const char *p);      /* number of G and C */
+size_t seqpack_hamming(const char *p, const char *q, size_t qofs); /* mismatches of p at base qofs of q */
+int seqpack_ntval(int nib);            /* 0-3 for T C A G as in ntval4[], 4 for N */
+
+#endif
@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "snap.h"
+
+#define SNAP_MAGIC "bawkarr\1"
+#define SNAP_BOM   0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t bom, version;
+    uint64_t n, klen, vlen, reserved;
+} snap_hdr_t;
+
+typedef struct {
+    double f;
+    uint32_t kn, vn, t, pad;
+} snap_ent_t;
+
+struct snap_s {
+    const char *data;   /* the whole file */
+    size_t size;
+    int mapped;
+    const snap_ent_t *e;
+    const char *k, *v;  /* the next key and string */
+    const char *kend;   /* where the keys end and the strings start */
+    size_t i, n;
+};
+
+long snap_save(const char *file, size_t n, snap_get_fn get, void *data)
+{
+    snap_hdr_t h;
+    snap_ent_t e;
+    snap_item_t it;
+    FILE *fp;
+    size_t i;
+
+    if ((fp = fopen(file, "wb")) == NULL)
+        return -1;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, SNAP_MAGIC, 8);
+    h.bom = SNAP_BOM, h.version = 1, h.n = n;
+    for (i = 0; i < n; ++i) {
+        get(i, &it, data);
+        h.klen += it.kn + 1, h.vlen += it.vn + 1;
+    }
+    fwrite(&h, sizeof(h), 1, fp);
+    memset(&e, 0, sizeof(e));
+    for (i = 0; i < n; ++i) {
+        get(i, &it, data);
+        e.f = it.f, e.kn = it.kn, e.vn = it.vn, e.t = it.t;
+        fwrite(&e, sizeof(e), 1, fp);
+    }
+    for (i = 0; i < n; ++i) {
+        get(i, &it, data);
+        fwrite(it.key, 1, it.kn + 1, fp);
+    }
+    for (i = 0; i < n; ++i) {
+        get(i, &it, data);
+        fwrite(it.val, 1, it.vn + 1, fp);
+    }
+    if (ferror(fp)) {
+        fclose(fp);
+        return -1;
+    }
+    return fclose(fp) == 0 ? (long) n : -1;
+}
+
+/* the whole of fd, when it can't be mapped */
+static char *read_all(int fd, size_t *size)
+{
+    char *buf = NULL;
+    size_t m = 0;
+    ssize_t r;
+
+    *size = 0;
+    do {
+        if (*size == m) {
+            m = m ? m * 2 : 1 << 16;
+            if ((buf = (char *) realloc(buf, m)) == NULL) {
+                fprintf(stderr, "snap: out of memory\n");
+                exit(2);
+            }
+        }
+        r = read(fd, buf + *size, m - *size);
+        *size += r > 0 ? r : 0;
+    } while (r > 0);
+    if (r < 0) {
+        free(buf);
+        return NULL;
+    }
+    return buf;
+}
+
+snap_t *snap_open(const char *file, size_t *n)
+{
+    snap_t *s;
+    snap_hdr_t h;
+    struct stat st;
+    void *p = MAP_FAILED;
+    uint64_t need;
+    int fd;
+
+    if ((fd = strcmp(file, "-") == 0 ? dup(0) : open(file, O_RDONLY)) < 0)
+        return NULL;
+    if ((s = (snap_t *) calloc(1, sizeof(snap_t))) == NULL) {
+        fprintf(stderr, "snap: out of memory\n");
+        exit(2);
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+        p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+        s->data = (const char *) p, s->size = st.st_size, s->mapped = 1;
+        madvise(p, st.st_size, MADV_SEQUENTIAL);
+    } else
+        s->data = read_all(fd, &s->size);
+    close(fd);
+    if (s->data == NULL || s->size < sizeof(h))
+        goto bad;
+    memcpy(&h, s->data, sizeof(h));
+    if (memcmp(h.magic, SNAP_MAGIC, 8) != 0 || h.bom != SNAP_BOM || h.version != 1
+            || h.n > (s->size - sizeof(h)) / sizeof(snap_ent_t))
+        goto bad;
+    need = sizeof(h) + h.n * sizeof(snap_ent_t);
+    if (h.klen > s->size - need || h.vlen != s->size - need - h.klen) // the sizes must add up exactly
+        goto bad;
+    s->e = (const snap_ent_t *) (s->data + sizeof(h));
+    s->k = s->data + need;
+    s->v = s->kend = s->k + h.klen;
+    s->n = *n = h.n;
+    return s;
+bad:
+    snap_close(s);
+    return NULL;
+}
+
+int snap_next(snap_t *s, snap_item_t *it)
+{
+    const snap_ent_t *e = &s->e[s->i];
+    const char *end = s->data + s->size;
+
+    if (s->i == s->n)
+        return 0;
+    if (e->kn >= (size_t)(s->kend - s->k) || s->k[e->kn] != '\0'
+            || e->vn >= (size_t)(end - s->v) || s->v[e->vn] != '\0') {
+        s->i = s->n;
+        return -1;
+    }
+    it->key = s->k, it->kn = e->kn;
+    it->val = s->v, it->vn = e->vn;
+    it->f = e->f, it->t = e->t;
+    s->k += e->kn + 1, s->v += e->vn + 1;
+    ++s->i;
+    return 1;
+}
+
+void snap_close(snap_t *s)
+{
+    if (s->mapped)
+        munmap((void *) s->data, s->size);
+    else
+        free((void *) s->data);
+    free(s);
+}
@@ -0,0 +1,33 @@
+#ifndef SNAP_H
+#define SNAP_H
+
+#include <stddef.h>
+
+/* Binary array snapshots for array_save() and array_load(). A snapshot is
+ * a header, a fixed size entry per element (number value, type, key and
+ * string lengths), then all the keys and then all the strings, each ended
+ * by a NUL, in two contiguous arenas. It is read by mapping the file, so
+ * loading is a walk over the entries with no parsing; byte order is that
+ * of the machine that wrote it and checked on reading. */
+
+#define SNAP_NUM 1
+#define SNAP_STR 2
+
+typedef struct snap_item {
+    const char *key, *val; /* NUL ended */
+    size_t kn, vn;
+    double f;
+    int t;                 /* SNAP_NUM and/or SNAP_STR */
+} snap_item_t;
+
+typedef void (*snap_get_fn)(size_t i, snap_item_t *it, void *data); /* element i of those to save */
+
+long snap_save(const char *file, size_t n, snap_get_fn get, void *data); /* n, or -1 if file can't be written */
+
+typedef struct snap_s snap_t;
+
+snap_t *snap_open(const char *file, size_t *n); /* NULL if file can't be read or isn't a snapshot */
+int snap_next(snap_t *s, snap_item_t *it);     /* 1 for an element, 0 at the end, -1 if the file is damaged */
+void snap_close(snap_t *s);
+
+#endif
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include "table.h"
+
+#define TABLE_BLOCK (1 << 20) /* bytes read at a time from a gzipped file */
+
+typedef struct {
+    int fs, keycol, valcol;
+    table_fn fn;
+    void *data;
+    long n;
+} table_t;
+
+/* field col (1-based) of s[0..n), or NULL */
+static const char *field(const table_t *t, const char *s, size_t n, int col, size_t *len)
+{
+    const char *end = s + n, *q;
+
+    if (col == 0) {
+        *len = n;
+        return s;
+    }
+    if (t->fs == ' ') {
+        for (;;) {
+            while (s < end && (*s == ' ' || *s == '\t')) ++s;
+            if (s == end)
+                return NULL;
+            for (q = s; q < end && *q != ' ' && *q != '\t'; ++q)
+                ;
+            if (--col == 0) {
+                *len = q - s;
+                return s;
+            }
+            s = q;
+        }
+    }
+    for (; col > 1; --col) {
+        if ((q = (const char *) memchr(s, t->fs, end - s)) == NULL)
+            return NULL;
+        s = q + 1;
+    }
+    if ((q = (const char *) memchr(s, t->fs, end - s)) == NULL)
+        q = end;
+    *len = q - s;
+    return s;
+}
+
+static void do_line(table_t *t, const char *s, size_t n)
+{
+    const char *k, *v;
+    size_t kn, vn;
+
+    if (n == 0 || (k = field(t, s, n, t->keycol, &kn)) == NULL)
+        return;
+    if ((v = field(t, s, n, t->valcol, &vn)) == NULL)
+        v = "", vn = 0;
+    t->fn(k, kn, v, vn, t->data);
+    ++t->n;
+}
+
+/* the lines in s[0..n); returns where the last, unfinished one starts */
+static size_t do_lines(table_t *t, const char *s, size_t n)
+{
+    const char *p = s, *end = s + n, *q;
+
+    while (p < end && (q = (const char *) memchr(p, '\n', end - p)) != NULL) {
+        do_line(t, p, q - p);
+        p = q + 1;
+    }
+    return p - s;
+}
+
+static int read_gz(table_t *t, int fd)
+{
+    gzFile fp;
+    char *buf;
+    size_t size = TABLE_BLOCK, len = 0, used;
+    int r;
+
+    if ((fp = gzdopen(fd, "r")) == NULL)
+        return -1;
+    if ((buf = (char *) malloc(size)) == NULL) {
+        fprintf(stderr, "table: out of memory\n");
+        exit(2);
+    }
+    while ((r = gzread(fp, buf + len, size - len)) > 0) {
+        len += r;
+        used = do_lines(t, buf, len);
+        memmove(buf, buf + used, len - used);
+        len -= used;
+        if (len == size) { // a line longer than the buffer
+            size *= 2;
+            if ((buf = (char *) realloc(buf, size)) == NULL) {
+                fprintf(stderr, "table: out of memory\n");
+                exit(2);
+            }
+        }
+    }
+    if (len > 0)
+        do_line(t, buf, len);
+    free(buf);
+    gzclose(fp);
+    return r < 0 ? -1 : 0;
+}
+
+long table_read(const char *file, int fs, int keycol, int valcol, table_fn fn, void *data)
+{
+    table_t t;
+    struct stat st;
+    unsigned char magic[2];
+    const char *s;
+    size_t used;
+    int fd;
+
+    t.fs = fs, t.keycol = keycol, t.valcol = valcol;
+    t.fn = fn, t.data = data, t.n = 0;
+    if (strcmp(file, "-") == 0)
+        return read_gz(&t, dup(0)) < 0 ? -1 : t.n;
+    if ((fd = open(file, O_RDONLY)) < 0)
+        return -1;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size < 2
+            || (pread(fd, magic, 2, 0) == 2 && magic[0] == 0x1f && magic[1] == 0x8b))
+        return read_gz(&t, fd) < 0 ? -1 : t.n; // gzipped, or not a file to map
+    if ((s = (const char *) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+        return read_gz(&t, fd) < 0 ? -1 : t.n;
+    madvise((void *) s, st.st_size, MADV_SEQUENTIAL);
+    used = do_lines(&t, s, st.st_size);
+    if (used < (size_t) st.st_size)
+        do_line(&t, s + used, st.st_size - used);
+    munmap((void *) s, st.st_size);
+    close(fd);
+    return t.n;
+}
@@ -0,0 +1,20 @@
+#ifndef TABLE_H
+#define TABLE_H
+
+#include <stddef.h>
+
+/* Bulk reading of a key/value table for load_table(). A plain file is
+ * mapped and cut into lines and fields with memchr(); a gzipped one, or
+ * stdin, is read in large blocks. Either way no line goes through the
+ * interpreter. */
+
+typedef void (*table_fn)(const char *key, size_t kn, const char *val, size_t vn, void *data);
+
+/* Calls fn with columns keycol and valcol of each line of file ("-" for
+ * stdin), 1-based, 0 for the whole line. Fields are split by fs, or by runs
+ * of blanks if fs is ' '. Empty lines and lines without keycol are skipped,
+ * a missing valcol is empty. Returns the number of lines given to fn, or
+ * -1 if file can't be read. */
+long table_read(const char *file, int fs, int keycol, int valcol, table_fn fn, void *data);
+
+#endif
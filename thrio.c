@@ -0,0 +1,277 @@
+#define _GNU_SOURCE /* fopencookie() */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "thrio.h"
+
+/* A queue of NSLOT buffers passed from one producer thread to one consumer.
+ * The buffers are large, so a mutex per hand-off costs next to nothing. */
+
+#define NSLOT 8
+
+typedef struct {
+    char *s;
+    int l, m; /* l < 0 for a read error */
+} slot_t;
+
+typedef struct {
+    slot_t slot[NSLOT];
+    int head, tail; /* slots filled so far, slots emptied so far */
+    int stop;
+    pthread_mutex_t lock;
+    pthread_cond_t cv;
+} squeue_t;
+
+static void sq_init(squeue_t *q)
+{
+    memset(q, 0, sizeof(squeue_t));
+    pthread_mutex_init(&q->lock, 0);
+    pthread_cond_init(&q->cv, 0);
+}
+
+static void sq_destroy(squeue_t *q)
+{
+    int i;
+
+    for (i = 0; i < NSLOT; ++i)
+        free(q->slot[i].s);
+    pthread_cond_destroy(&q->cv);
+    pthread_mutex_destroy(&q->lock);
+}
+
+/* producer: next empty slot, or NULL if the consumer has stopped */
+static slot_t *sq_get_empty(squeue_t *q)
+{
+    slot_t *s = 0;
+
+    pthread_mutex_lock(&q->lock);
+    while (!q->stop && q->head - q->tail == NSLOT)
+        pthread_cond_wait(&q->cv, &q->lock);
+    if (!q->stop) s = &q->slot[q->head % NSLOT];
+    pthread_mutex_unlock(&q->lock);
+    return s;
+}
+
+static void sq_put(squeue_t *q)
+{
+    pthread_mutex_lock(&q->lock);
+    q->head++;
+    pthread_cond_broadcast(&q->cv);
+    pthread_mutex_unlock(&q->lock);
+}
+
+/* consumer: next filled slot, or NULL if empty and the producer has stopped */
+static slot_t *sq_get_full(squeue_t *q)
+{
+    slot_t *s = 0;
+
+    pthread_mutex_lock(&q->lock);
+    while (!q->stop && q->head == q->tail)
+        pthread_cond_wait(&q->cv, &q->lock);
+    if (q->head != q->tail) s = &q->slot[q->tail % NSLOT];
+    pthread_mutex_unlock(&q->lock);
+    return s;
+}
+
+static void sq_release(squeue_t *q)
+{
+    pthread_mutex_lock(&q->lock);
+    q->tail++;
+    pthread_cond_broadcast(&q->cv);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void sq_stop(squeue_t *q)
+{
+    pthread_mutex_lock(&q->lock);
+    q->stop = 1;
+    pthread_cond_broadcast(&q->cv);
+    pthread_mutex_unlock(&q->lock);
+}
+
+/*****************
+ * reader thread *
+ *****************/
+
+#define THRIN_BUFSIZE (256 * 1024)
+
+struct thrin_s {
+    gzFile fp;
+    squeue_t q;
+    slot_t *cur; /* slot being read by thrin_read() */
+    int pos;
+    pthread_t tid;
+};
+
+static void *thrin_worker(void *data)
+{
+    thrin_t *r = (thrin_t *)data;
+    slot_t *s;
+
+    while ((s = sq_get_empty(&r->q)) != 0) {
+        if (s->s == 0) s->s = (char *)malloc(s->m = THRIN_BUFSIZE);
+        s->l = gzread(r->fp, s->s, s->m);
+        sq_put(&r->q);
+        if (s->l <= 0) break; /* EOF or error: the consumer sees it last */
+    }
+    return 0;
+}
+
+thrin_t *thrin_open(gzFile fp)
+{
+    thrin_t *r = (thrin_t *)calloc(1, sizeof(thrin_t));
+
+    r->fp = fp;
+    sq_init(&r->q);
+    if (pthread_create(&r->tid, 0, thrin_worker, r) != 0) {
+        sq_destroy(&r->q);
+        free(r);
+        return 0;
+    }
+    return r;
+}
+
+int thrin_read(thrin_t *r, void *buf, int len)
+{
+    int n = 0, k;
+
+    while (n < len) {
+        if (r->cur == 0) {
+            if ((r->cur = sq_get_full(&r->q)) == 0) break;
+            r->pos = 0;
+        }
+        if (r->cur->l <= 0) { /* stays the last slot */
+            if (n == 0) n = r->cur->l;
+            break;
+        }
+        k = r->cur->l - r->pos < len - n ? r->cur->l - r->pos : len - n;
+        memcpy((char *)buf + n, r->cur->s + r->pos, k);
+        n += k;
+        if ((r->pos += k) == r->cur->l) {
+            r->cur = 0;
+            sq_release(&r->q);
+        }
+    }
+    return n;
+}
+
+void thrin_close(thrin_t *r)
+{
+    sq_stop(&r->q);
+    pthread_join(r->tid, 0);
+    sq_destroy(&r->q);
+    free(r);
+}
+
+/*****************
+ * writer thread *
+ *****************/
+
+#ifdef __GLIBC__
+
+#define THROUT_BUFSIZE (256 * 1024)
+
+static squeue_t g_outq;
+static pthread_t g_outtid;
+static int g_out_on, g_out_err;
+
+static void *throut_worker(void *data)
+{
+    slot_t *s;
+    char *p;
+    int n;
+
+    while ((s = sq_get_full(&g_outq)) != 0) {
+        for (p = s->s; !g_out_err && p < s->s + s->l; p += n)
+            if ((n = write(1, p, s->s + s->l - p)) < 0) {
+                if (errno != EINTR) g_out_err = errno;
+                n = 0;
+            }
+        sq_release(&g_outq);
+    }
+    return 0;
+}
+
+static ssize_t throut_write(void *cookie, const char *buf, size_t size)
+{
+    slot_t *s;
+    ssize_t n;
+
+    if (g_out_err) {
+        errno = g_out_err;
+        return -1;
+    }
+    if (!g_out_on) { /* after the writer has been shut down */
+        n = write(1, buf, size);
+        return n;
+    }
+    s = sq_get_empty(&g_outq);
+    if (s->m < (int)size) {
+        s->m = size;
+        s->s = (char *)realloc(s->s, s->m);
+    }
+    memcpy(s->s, buf, size);
+    s->l = size;
+    sq_put(&g_outq);
+    return size;
+}
+
+static void throut_drain(void)
+{
+    pthread_mutex_lock(&g_outq.lock);
+    while (g_outq.head != g_outq.tail)
+        pthread_cond_wait(&g_outq.cv, &g_outq.lock);
+    pthread_mutex_unlock(&g_outq.lock);
+}
+
+static void throut_stop(void)
+{
+    if (!g_out_on) return;
+    fflush(stdout);
+    throut_drain();
+    g_out_on = 0;
+    sq_stop(&g_outq);
+    pthread_join(g_outtid, 0);
+}
+
+static int throut_close(void *cookie)
+{
+    throut_stop();
+    return g_out_err ? -1 : 0;
+}
+
+int throut_start(void)
+{
+    cookie_io_functions_t io = { 0, throut_write, 0, throut_close };
+    FILE *fp;
+
+    if (g_out_on) return 0;
+    if ((fp = fopencookie(0, "w", io)) == 0) return -1;
+    setvbuf(fp, 0, _IOFBF, THROUT_BUFSIZE);
+    sq_init(&g_outq);
+    if (pthread_create(&g_outtid, 0, throut_worker, 0) != 0) {
+        fclose(fp);
+        return -1;
+    }
+    fflush(stdout);
+    stdout = fp;
+    g_out_on = 1;
+    atexit(throut_stop); /* for exits that don't go through closeall() */
+    return 0;
+}
+
+void throut_sync(void)
+{
+    fflush(stdout);
+    if (g_out_on) throut_drain();
+}
+
+#else /* no fopencookie(): stdout is written by the interpreter thread */
+
+int throut_start(void) { return -1; }
+void throut_sync(void) { fflush(stdout); }
+
+#endif
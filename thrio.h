@@ -0,0 +1,20 @@
+#ifndef THRIO_H
+#define THRIO_H
+
+#include <zlib.h>
+
+/* Pipeline mode (-P): a reader thread decompresses the input of bio_getrec()
+ * ahead of the interpreter, and a writer thread does the write()s for
+ * stdout. Both are connected to the interpreter thread by small bounded
+ * queues of large buffers. */
+
+typedef struct thrin_s thrin_t;
+
+thrin_t *thrin_open(gzFile fp);                 /* start reading fp on a thread */
+int thrin_read(thrin_t *r, void *buf, int len); /* same results as gzread() */
+void thrin_close(thrin_t *r);                   /* stop the thread; fp is left open */
+
+int throut_start(void); /* send stdout through the writer thread; 0 on success */
+void throut_sync(void); /* fflush(stdout) and wait until it has been written */
+
+#endif
@@ -28,6 +28,7 @@ THIS SOFTWARE.
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 #include "awk.h"
 #include "ytab.h"
 
@@ -54,6 +55,7 @@ Awkfloat *RLENGTH;	/* length of same */
 
 Cell	*fsloc;		/* FS */
 Cell    *filenumloc;	/* FILENUM */
+Cell	*filenameloc;	/* FILENAME */
 Cell	*nrloc;		/* NR */
 Cell	*nfloc;		/* NF */
 Cell	*fnrloc;	/* FNR */
@@ -83,7 +85,8 @@ void syminit(void)	/* initialize symbol table with builtin vars */
 	ORS = &setsymtab("ORS", "\n", 0.0, STR|DONTFREE, symtab)->sval;
 	OFMT = &setsymtab("OFMT", "%.6g", 0.0, STR|DONTFREE, symtab)->sval;
 	CONVFMT = &setsymtab("CONVFMT", "%.6g", 0.0, STR|DONTFREE, symtab)->sval;
-	FILENAME = &setsymtab("FILENAME", "", 0.0, STR|DONTFREE, symtab)->sval;
+	filenameloc = setsymtab("FILENAME", "", 0.0, STR|DONTFREE, symtab);
+	FILENAME = &filenameloc->sval;
 	filenumloc = setsymtab("FILENUM", "", 0.0, NUM, symtab); /* 26Sep2022 count files */
 	FILENUM = &filenumloc->fval;
 	nfloc = setsymtab("NF", "", 0.0, NUM, symtab);
@@ -155,9 +158,106 @@ Array *makesymtab(int n)	/* make a new symbol table */
 	ap->nelem = 0;
 	ap->size = n;
 	ap->tab = tp;
+	ap->ndense = 0;
+	ap->dsize = 0;
+	ap->dense = NULL;
 	return(ap);
 }
 
+/* while its keys are "1".."n", as after split(), an array keeps its
+ * elements in dense[] and doesn't hash them.  deleting leaves a NULL;
+ * the first other key moves them into the hash table for good. */
+
+static int densekey(const char *s)	/* k if s is "k" for an int k > 0, else 0 */
+{
+	int k = 0;
+
+	if (*s < '1' || *s > '9')
+		return 0;
+	for ( ; *s >= '0' && *s <= '9'; s++) {
+		if (k > (INT_MAX - 9) / 10)
+			return 0;
+		k = 10 * k + *s - '0';
+	}
+	return *s == '\0' ? k : 0;
+}
+
+static void undense(Array *tp)	/* move the dense elements into the hash table */
+{
+	int i, h, n = tp->ndense;
+	Cell *p;
+
+	tp->ndense = -1;
+	while (tp->nelem > FULLTAB * tp->size)
+		rehash(tp);
+	for (i = 0; i < n; i++) {
+		if ((p = tp->dense[i]) == NULL)
+			continue;
+		h = hash(p->nval, tp->size);
+		p->cnext = tp->tab[h];
+		tp->tab[h] = p;
+	}
+	free(tp->dense);
+	tp->dense = NULL;
+	tp->dsize = 0;
+}
+
+static void freecell(Cell *cp)	/* free an element and its string */
+{
+	freesval(cp);
+	free(cp);
+}
+
+Cell *lookupnum(Awkfloat f, Array *tp)	/* element f if tp is dense and has it */
+{
+	if (f >= 1 && f <= tp->ndense && f == (int) f)
+		return tp->dense[(int) f - 1];	/* maybe NULL */
+	return(NULL);
+}
+
+/* set element k of tp, replacing the value of an existing dense element.
+ * in a hashed table, k must not be there already. */
+Cell *setnumsymtab(int k, const char *s, Awkfloat f, unsigned t, Array *tp)
+{
+	char num[20];
+	Cell *p;
+
+	if (k <= tp->ndense && (p = tp->dense[k-1]) != NULL) {
+		freesval(p);
+		p->fval = f;
+		p->tval = t;
+		setcellstr(p, s, strlen(s));
+		return(p);
+	}
+	sprintf(num, "%d", k);
+	return(setsymtab(num, s, f, t, tp));
+}
+
+int arraycells(Array *tp, Cell **v)	/* put the elements of tp in v, tp->nelem of them */
+{
+	int i, n = 0;
+	Cell *p;
+
+	for (i = 0; i < tp->ndense; i++)
+		if (tp->dense[i] != NULL)
+			v[n++] = tp->dense[i];
+	for (i = 0; i < tp->size; i++)
+		for (p = tp->tab[i]; p != NULL; p = p->cnext)
+			v[n++] = p;
+	return n;
+}
+
+void trimsymtab(Array *tp, int n)	/* drop dense elements after n */
+{
+	Cell *p;
+
+	while (tp->ndense > n)
+		if ((p = tp->dense[--tp->ndense]) != NULL) {
+			freecell(p);
+			tp->nelem--;
+		}
+}
+
 void freesymtab(Cell *ap)	/* free a symbol table */
 {
 	Cell *cp, *temp;
@@ -169,13 +269,12 @@ void freesymtab(Cell *ap)	/* free a symbol table */
 	tp = (Array *) ap->sval;
 	if (tp == NULL)
 		return;
+	trimsymtab(tp, 0);
+	free(tp->dense);
 	for (i = 0; i < tp->size; i++) {
 		for (cp = tp->tab[i]; cp != NULL; cp = temp) {
-			xfree(cp->nval);
-			if (freeable(cp))
-				xfree(cp->sval);
 			temp = cp->cnext;	/* avoids freeing then using */
-			free(cp); 
+			freecell(cp);
 			tp->nelem--;
 		}
 		tp->tab[i] = 0;
@@ -193,6 +292,17 @@ void freeelem(Cell *ap, const char *s)	/* free elem s from ap (i.e., ap["s"] */
 	int h;
 	
 	tp = (Array *) ap->sval;
+	if (tp->ndense >= 0) {
+		h = densekey(s);
+		if (h == 0 || h > tp->ndense || (p = tp->dense[h-1]) == NULL)
+			return;
+		freecell(p);
+		tp->nelem--;
+		tp->dense[h-1] = NULL;
+		while (tp->ndense > 0 && tp->dense[tp->ndense-1] == NULL)
+			tp->ndense--;
+		return;
+	}
 	h = hash(s, tp->size);
 	for (p = tp->tab[h]; p != NULL; prev = p, p = p->cnext)
 		if (strcmp(s, p->nval) == 0) {
@@ -200,10 +310,7 @@ void freeelem(Cell *ap, const char *s)	/* free elem s from ap (i.e., ap["s"] */
 				tp->tab[h] = p->cnext;
 			else			/* middle somewhere */
 				prev->cnext = p->cnext;
-			if (freeable(p))
-				xfree(p->sval);
-			free(p->nval);
-			free(p);
+			freecell(p);
 			tp->nelem--;
 			return;
 		}
@@ -212,6 +319,7 @@ void freeelem(Cell *ap, const char *s)	/* free elem s from ap (i.e., ap["s"] */
 Cell *setsymtab(const char *n, const char *s, Awkfloat f, unsigned t, Array *tp)
 {
 	int h;
+	size_t nl;
 	Cell *p;
 
 	if (n != NULL && (p = lookup(n, tp)) != NULL) {
@@ -219,16 +327,40 @@ Cell *setsymtab(const char *n, const char *s, Awkfloat f, unsigned t, Array *tp)
 			(void*)p, NN(p->nval), NN(p->sval), p->fval, p->tval) );
 		return(p);
 	}
-	p = (Cell *) malloc(sizeof(Cell));
+	nl = strlen(n) + 1;
+	p = (Cell *) malloc(sizeof(Cell) + nl);	/* the name follows the cell */
 	if (p == NULL)
 		FATAL("out of space for symbol table at %s", n);
-	p->nval = tostring(n);
-	p->sval = s ? tostring(s) : tostring("");
+	p->nval = (char *) (p + 1);
+	memcpy(p->nval, n, nl);
 	p->fval = f;
 	p->tval = t;
+	if (s == NULL)
+		s = "";
+	setcellstr(p, s, strlen(s));
 	p->csub = CUNK;
 	p->ctype = OCELL;
 	tp->nelem++;
+	if (tp->ndense >= 0) {
+		h = densekey(n);
+		if (h > 0 && h <= tp->ndense) {	/* fill a hole */
+			tp->dense[h-1] = p;
+			p->cnext = NULL;
+			return(p);
+		}
+		if (h == tp->ndense + 1) {	/* append it */
+			if (tp->ndense == tp->dsize) {
+				tp->dsize = tp->dsize ? 2 * tp->dsize : NSYMTAB;
+				tp->dense = (Cell **) realloc(tp->dense, tp->dsize * sizeof(Cell *));
+				if (tp->dense == NULL)
+					FATAL("out of space for array %s", n);
+			}
+			tp->dense[tp->ndense++] = p;
+			p->cnext = NULL;
+			return(p);
+		}
+		undense(tp);
+	}
 	if (tp->nelem > FULLTAB * tp->size)
 		rehash(tp);
 	h = hash(n, tp->size);
@@ -275,6 +407,10 @@ Cell *lookup(const char *s, Array *tp)	/* look for s in tp */
 	Cell *p;
 	int h;
 
+	if (tp->ndense >= 0) {
+		h = densekey(s);
+		return h > 0 && h <= tp->ndense ? tp->dense[h-1] : NULL;
+	}
 	h = hash(s, tp->size);
 	for (p = tp->tab[h]; p != NULL; p = p->cnext)
 		if (strcmp(s, p->nval) == 0)
@@ -298,9 +434,8 @@ Awkfloat setfval(Cell *vp, Awkfloat f)	/* set float val of a Cell */
 		donefld = 0;	/* mark $1... invalid */
 		donerec = 1;
 	}
-	if (freeable(vp))
-		xfree(vp->sval); /* free any previous string */
-	vp->tval &= ~STR;	/* mark string invalid */
+	freesval(vp); /* free any previous string */
+	vp->tval &= ~(STR|SLEN|SGROW);	/* mark string invalid */
 	vp->tval |= NUM;	/* mark number ok */
 	   dprintf( ("setfval %p: %s = %g, t=%o\n", (void*)vp, NN(vp->nval), f, vp->tval) );
 	return vp->fval = f;
@@ -318,11 +453,13 @@ void funnyvar(Cell *vp, const char *rw)
 
 char *setsval(Cell *vp, const char *s)	/* set string val of a Cell */
 {
-	char *t;
+	return(setsnval(vp, s, strlen(s)));
+}
+
+static void setsvar(Cell *vp)	/* about to set the string val of vp */
+{
 	int fldno;
 
-	   dprintf( ("starting setsval %p: %s = \"%s\", t=%o, r,f=%d,%d\n", 
-		(void*)vp, NN(vp->nval), s, vp->tval, donerec, donefld) );
 	if ((vp->tval & (NUM | STR)) == 0)
 		funnyvar(vp, "assign to");
 	if (isfld(vp)) {
@@ -330,20 +467,134 @@ char *setsval(Cell *vp, const char *s)	/* set string val of a Cell */
 		fldno = atoi(vp->nval);
 		if (fldno > *NF)
 			newfld(fldno);
-		   dprintf( ("setting field %d to %s (%p)\n", fldno, s, s) );
+		   dprintf( ("setting field %d\n", fldno) );
 	} else if (isrec(vp)) {
 		donefld = 0;	/* mark $1... invalid */
 		donerec = 1;
 	}
-	t = tostring(s);	/* in case it's self-assign */
-	if (freeable(vp))
-		xfree(vp->sval);
-	vp->tval &= ~NUM;
-	vp->tval |= STR;
-	vp->tval &= ~DONTFREE;
+}
+
+char *setsnval(Cell *vp, const char *s, size_t n)	/* set string val to the n bytes at s */
+{
+	char *t;
+	int tv;
+
+	   dprintf( ("starting setsval %p: %s = \"%.*s\", t=%o, r,f=%d,%d\n", 
+		(void*)vp, NN(vp->nval), (int) n, s, vp->tval, donerec, donefld) );
+	setsvar(vp);
+	tv = vp->tval;
+	t = freeable(vp) ? vp->sval : NULL;	/* freed after the copy in case it's self-assign */
+	setcellstr(vp, s, n);
+	if (t != NULL)
+		freestr(t, tv);
+	vp->slen = n;
+	vp->tval &= ~(NUM|SGROW);
+	vp->tval |= STR|SLEN;
 	   dprintf( ("setsval %p: %s = \"%s (%p) \", t=%o r,f=%d,%d\n", 
-		(void*)vp, NN(vp->nval), t,t, vp->tval, donerec, donefld) );
-	return(vp->sval = t);
+		(void*)vp, NN(vp->nval), vp->sval, vp->sval, vp->tval, donerec, donefld) );
+	return(vp->sval);
+}
+
+char *copysval(Cell *vp, Cell *from)	/* set string val of vp to that of from */
+{					/* sharing its buffer if it's refcounted */
+	size_t n = getslen(from);
+	char *t;
+
+	if (!(from->tval & SREF) || !freeable(from) || vp == from)
+		return(setsnval(vp, from->sval, n));
+	setsvar(vp);
+	t = strref(from->sval);	/* before the free: vp may share it already */
+	freesval(vp);
+	vp->sval = t;
+	vp->slen = n;
+	vp->tval &= ~(NUM|SGROW|DONTFREE);
+	vp->tval |= STR|SLEN|SREF;
+	   dprintf( ("copysval %p: %s = \"%s (%p) \", t=%o\n", 
+		(void*)vp, NN(vp->nval), vp->sval, vp->sval, vp->tval) );
+	return(vp->sval);
+}
+
+char *ownsval(Cell *vp)	/* string val of vp, unshared so it can be changed in place */
+{
+	char *s = getsval(vp), *t;
+	size_t n;
+
+	if ((vp->tval & SREF) && freeable(vp) && ((size_t *) s)[-1] > 1) {
+		n = getslen(vp);
+		t = stralloc(n);
+		memcpy(t, s, n + 1);
+		strunref(s);
+		vp->sval = t;
+	}
+	return(vp->sval);
+}
+
+char *takesval(Cell *vp, char *s, size_t n)	/* set string val of vp to s, */
+{						/* n chars from stralloc() it takes over */
+	if (n < NSBUF) {	/* short ones go in vp->sbuf */
+		setsnval(vp, s, n);
+		strunref(s);
+		return(vp->sval);
+	}
+	setsvar(vp);
+	freesval(vp);
+	vp->sval = s;
+	vp->slen = n;
+	vp->tval &= ~(NUM|DONTFREE|SGROW);
+	vp->tval |= STR|SLEN|SREF;
+	return(vp->sval);
+}
+
+size_t strcap(size_t n)	/* room allocated for n bytes of a growing string */
+{
+	size_t m = 32;
+
+	while (m < n)
+		m <<= 1;
+	return m;
+}
+
+/* setsnval for a variable set over and over, as by for-in: the string
+ * goes into a growable buffer of vp's own, reused while it's big enough */
+char *setsnbuf(Cell *vp, const char *s, size_t n)
+{
+	char *t;
+
+	if (vp->tval & (FLD|REC))
+		return(setsnval(vp, s, n));
+	setsvar(vp);
+	if (!(vp->tval & SGROW) || !freeable(vp) || n + 1 > strcap(vp->slen + 1)) {
+		if ((t = (char *) malloc(strcap(n + 1))) == NULL)
+			FATAL("out of space for string of length %lu", (unsigned long) n);
+		freesval(vp);
+		vp->sval = t;
+	}
+	memcpy(vp->sval, s, n);
+	vp->sval[n] = '\0';
+	vp->slen = n;
+	vp->tval &= ~(NUM|DONTFREE|SREF);
+	vp->tval |= STR|SLEN|SGROW;
+	return(vp->sval);
+}
+
+/* point vp->sval at a copy of the n bytes at s: in vp->sbuf if they fit,
+ * marked DONTFREE, else in a refcounted buffer.  the old sval is left alone. */
+void setcellstr(Cell *vp, const char *s, size_t n)
+{
+	char *t;
+
+	if (n < NSBUF) {
+		t = vp->sbuf;
+		vp->tval &= ~SREF;
+		vp->tval |= DONTFREE;
+	} else {
+		t = stralloc(n);
+		vp->tval &= ~DONTFREE;
+		vp->tval |= SREF;
+	}
+	memmove(t, s, n);
+	t[n] = '\0';
+	vp->sval = t;
 }
 
 Awkfloat getfval(Cell *vp)	/* get float val of a Cell */
@@ -376,15 +627,15 @@ static char *get_str_val(Cell *vp, char **fmt)        /* get string val of a Cel
 	else if (isrec(vp) && donerec == 0)
 		recbld();
 	if (isstr(vp) == 0) {
-		if (freeable(vp))
-			xfree(vp->sval);
+		freesval(vp);
 		if (modf(vp->fval, &dtemp) == 0)	/* it's integral */
 			sprintf(s, "%.30g", vp->fval);
 		else
 			sprintf(s, *fmt, vp->fval);
-		vp->sval = tostring(s);
-		vp->tval &= ~DONTFREE;
-		vp->tval |= STR;
+		vp->slen = strlen(s);
+		setcellstr(vp, s, vp->slen);
+		vp->tval &= ~SGROW;
+		vp->tval |= STR|SLEN;
 	}
 	   dprintf( ("getsval %p: %s = \"%s (%p)\", t=%o\n",
 		(void*)vp, NN(vp->nval), vp->sval, vp->sval, vp->tval) );
@@ -396,6 +647,16 @@ char *getsval(Cell *vp)       /* get string val of a Cell */
       return get_str_val(vp, CONVFMT);
 }
 
+size_t getslen(Cell *vp)	/* get length of string val of a Cell */
+{
+	getsval(vp);
+	if ((vp->tval & SLEN) == 0) {
+		vp->slen = strlen(vp->sval);
+		vp->tval |= SLEN;
+	}
+	return(vp->slen);
+}
+
 char *getpssval(Cell *vp)     /* get string val of a Cell for print */
 {
       return get_str_val(vp, OFMT);
@@ -413,6 +674,52 @@ char *tostring(const char *s)	/* make a copy of string s */
 	return(p);
 }
 
+/* string buffers that cells can share.  a count of the references to the
+ * buffer is kept in front of it; the last strunref() frees it. */
+
+char *stralloc(size_t n)	/* refcounted buffer for n chars and a '\0' */
+{
+	size_t *p;
+
+	if ((p = (size_t *) malloc(sizeof(size_t) + n + 1)) == NULL)
+		FATAL("out of space for a string of %lu chars", (unsigned long) n);
+	*p = 1;
+	return (char *) (p + 1);
+}
+
+char *strref(char *s)	/* another reference to s */
+{
+	((size_t *) s)[-1]++;
+	return(s);
+}
+
+char *strgrow(char *s, size_t n)	/* resize s, referenced only once, */
+{					/* for n chars; NULL s is a new buffer */
+	size_t *p;
+
+	if (s == NULL)
+		return(stralloc(n));
+	if ((p = (size_t *) realloc((size_t *) s - 1, sizeof(size_t) + n + 1)) == NULL)
+		FATAL("out of space for a string of %lu chars", (unsigned long) n);
+	return (char *) (p + 1);
+}
+
+void strunref(char *s)
+{
+	size_t *p = (size_t *) s - 1;
+
+	if (--*p == 0)
+		free(p);
+}
+
+void freestr(char *s, int tval)	/* free sval s of a cell of type tval */
+{
+	if (tval & SREF)
+		strunref(s);
+	else
+		free(s);
+}
+
 char *qstring(const char *is, int delim)	/* collect string up to next delim */
 {
 	const char *os = is;
@@ -0,0 +1,119 @@
+#include <string.h>
+#include <stdlib.h>
+#include "xlate.h"
+
+/* When no more than 4 bytes are replaced or deleted, the spans between
+ * them are found 16 bytes at a time (see byteset_find()) and copied in
+ * bulk, which also does deletion by compaction. Otherwise, or once those
+ * bytes turn out to be common, each byte goes through the table. */
+
+#define XLATE_NCACHE 8
+
+typedef struct {
+    char *from, *to, *del; /* NULL for an unused entry */
+    xlate_t t;
+} xlate_entry_t;
+
+static xlate_entry_t g_cache[XLATE_NCACHE];
+static int g_next; /* entry to replace next */
+
+typedef struct {
+    const unsigned char *s;
+    int lo, hi;
+} setiter_t;
+
+static int next_byte(setiter_t *it) /* next byte of the set, -1 at the end */
+{
+    const unsigned char *s = it->s;
+
+    if (it->lo > it->hi) {
+        if (*s == 0) return -1;
+        if (s[1] == '-' && s[2] != 0 && s[2] >= s[0])
+            it->lo = s[0], it->hi = s[2], it->s += 3;
+        else
+            it->lo = it->hi = s[0], it->s += 1;
+    }
+    return it->lo++;
+}
+
+static void compile(xlate_t *t, const char *from, const char *to, const char *del)
+{
+    setiter_t f = { (const unsigned char *)from, 1, 0 }, o = { (const unsigned char *)to, 1, 0 };
+    int c, d, last = -1;
+
+    for (c = 0; c < 256; ++c)
+        t->map[c] = c, t->keep[c] = 1;
+    while ((c = next_byte(&f)) >= 0) {
+        if ((d = next_byte(&o)) >= 0) last = d;
+        t->map[c] = last >= 0 ? last : c;
+    }
+    f.s = (const unsigned char *)del, f.lo = 1, f.hi = 0;
+    while ((c = next_byte(&f)) >= 0)
+        t->keep[c] = 0;
+    t->ndel = 0;
+    memset(t->touch.in, 0, sizeof(t->touch.in));
+    for (c = 1; c < 256; ++c) {
+        t->ndel += !t->keep[c];
+        t->touch.in[c] = t->map[c] != c || !t->keep[c];
+    }
+    byteset_prep(&t->touch);
+}
+
+const xlate_t *xlate_get(const char *from, const char *to, const char *del)
+{
+    xlate_entry_t *e;
+    int i;
+
+    for (i = 0; i < XLATE_NCACHE; ++i) {
+        e = &g_cache[i];
+        if (e->from && strcmp(e->from, from) == 0 && strcmp(e->to, to) == 0 && strcmp(e->del, del) == 0)
+            return &e->t;
+    }
+    e = &g_cache[g_next];
+    g_next = (g_next + 1) % XLATE_NCACHE;
+    free(e->from); free(e->to); free(e->del);
+    e->from = strdup(from), e->to = strdup(to), e->del = strdup(del);
+    compile(&e->t, from, to, del);
+    return &e->t;
+}
+
+static size_t apply_table(const xlate_t *t, const unsigned char *p, const unsigned char *end, unsigned char *o)
+{
+    unsigned char *o0 = o;
+
+    if (t->ndel == 0) {
+        for (; end - p >= 4; p += 4, o += 4)
+            o[0] = t->map[p[0]], o[1] = t->map[p[1]], o[2] = t->map[p[2]], o[3] = t->map[p[3]];
+        for (; p < end; ++p)
+            *o++ = t->map[*p];
+    } else {
+        for (; p < end; ++p) { /* no branch on whether to keep *p */
+            *o = t->map[*p];
+            o += t->keep[*p];
+        }
+    }
+    return o - o0;
+}
+
+size_t xlate_apply(const xlate_t *t, const char *s, size_t n, char *out)
+{
+    const unsigned char *p = (const unsigned char *)s, *end = p + n, *q;
+    unsigned char *o = (unsigned char *)out;
+    size_t hits = 0;
+
+    if (t->touch.nc >= 0 && !t->touch.neg) {
+        while ((q = (const unsigned char *)byteset_find(&t->touch, (const char *)p, end - p)) != NULL) {
+            memcpy(o, p, q - p);
+            o += q - p;
+            for (p = q; p < end && t->touch.in[*p]; ++p, ++hits) {
+                *o = t->map[*p];
+                o += t->keep[*p];
+            }
+            if (hits > 4096 && hits > (size_t)(p - (const unsigned char *)s) / 16)
+                return o - (unsigned char *)out + apply_table(t, p, end, o); /* too many to skip to */
+        }
+        memcpy(o, p, end - p);
+        return o + (end - p) - (unsigned char *)out;
+    }
+    return apply_table(t, p, end, o);
+}
@@ -0,0 +1,25 @@
+#ifndef XLATE_H
+#define XLATE_H
+
+#include <stddef.h>
+#include "memfind.h"
+
+/* Byte translation for tr(). A table gives each byte its replacement or
+ * marks it for deletion; tables are compiled once for each (from, to, del)
+ * and kept in a small cache. */
+
+typedef struct xlate {
+    unsigned char map[256];  /* replacement for each byte */
+    unsigned char keep[256]; /* 0 for bytes to delete */
+    int ndel;                /* number of bytes deleted */
+    byteset_t touch;         /* bytes that are replaced or deleted */
+} xlate_t;
+
+/* from, to and del are sets of bytes with a-z style ranges. Each byte of
+ * from maps to the byte at the same place in to, the last byte of to
+ * standing in for the rest; an empty to leaves bytes as they are. Bytes
+ * in del are deleted. */
+const xlate_t *xlate_get(const char *from, const char *to, const char *del);
+size_t xlate_apply(const xlate_t *t, const char *s, size_t n, char *out); /* s into out, which must not overlap it; returns the length of out */
+
+#endif
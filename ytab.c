@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,113 +57,177 @@
 /* Pure parsers.  */
 #define YYPURE 0
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 25 "awkgram.y"
+
+#include <stdio.h>
+#include <string.h>
+#include "awk.h"
+
+void checkdup(Node *list, Cell *item);
+int yywrap(void) { return(1); }
+
+Node	*beginloc = 0;
+Node	*endloc = 0;
+int	infunc	= 0;	/* = 1 if in arglist or body of func */
+int	inloop	= 0;	/* = 1 if in while, for, do */
+char	*curfname = 0;	/* current function name */
+Node	*arglist = 0;	/* list of args for current function */
+
+#line 87 "y.tab.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     FIRSTTOKEN = 258,
-     PROGRAM = 259,
-     PASTAT = 260,
-     PASTAT2 = 261,
-     XBEGIN = 262,
-     XEND = 263,
-     NL = 264,
-     ARRAY = 265,
-     MATCH = 266,
-     NOTMATCH = 267,
-     MATCHOP = 268,
-     FINAL = 269,
-     DOT = 270,
-     ALL = 271,
-     CCL = 272,
-     NCCL = 273,
-     CHAR = 274,
-     OR = 275,
-     STAR = 276,
-     QUEST = 277,
-     PLUS = 278,
-     EMPTYRE = 279,
-     AND = 280,
-     BOR = 281,
-     APPEND = 282,
-     EQ = 283,
-     GE = 284,
-     GT = 285,
-     LE = 286,
-     LT = 287,
-     NE = 288,
-     IN = 289,
-     ARG = 290,
-     BLTIN = 291,
-     BREAK = 292,
-     CLOSE = 293,
-     CONTINUE = 294,
-     DELETE = 295,
-     DO = 296,
-     EXIT = 297,
-     FOR = 298,
-     FUNC = 299,
-     SUB = 300,
-     GSUB = 301,
-     IF = 302,
-     INDEX = 303,
-     LSUBSTR = 304,
-     MATCHFCN = 305,
-     NEXT = 306,
-     NEXTFILE = 307,
-     ADD = 308,
-     MINUS = 309,
-     MULT = 310,
-     DIVIDE = 311,
-     MOD = 312,
-     ASSIGN = 313,
-     ASGNOP = 314,
-     ADDEQ = 315,
-     SUBEQ = 316,
-     MULTEQ = 317,
-     DIVEQ = 318,
-     MODEQ = 319,
-     POWEQ = 320,
-     PRINT = 321,
-     PRINTF = 322,
-     SPRINTF = 323,
-     ELSE = 324,
-     INTEST = 325,
-     CONDEXPR = 326,
-     POSTINCR = 327,
-     PREINCR = 328,
-     POSTDECR = 329,
-     PREDECR = 330,
-     VAR = 331,
-     IVAR = 332,
-     VARNF = 333,
-     CALL = 334,
-     NUMBER = 335,
-     STRING = 336,
-     REGEXPR = 337,
-     GETLINE = 338,
-     SUBSTR = 339,
-     SPLIT = 340,
-     RETURN = 341,
-     WHILE = 342,
-     CAT = 343,
-     UMINUS = 344,
-     NOT = 345,
-     POWER = 346,
-     INCR = 347,
-     DECR = 348,
-     INDIRECT = 349,
-     LASTTOKEN = 350
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    FIRSTTOKEN = 258,              /* FIRSTTOKEN  */
+    PROGRAM = 259,                 /* PROGRAM  */
+    PASTAT = 260,                  /* PASTAT  */
+    PASTAT2 = 261,                 /* PASTAT2  */
+    XBEGIN = 262,                  /* XBEGIN  */
+    XEND = 263,                    /* XEND  */
+    NL = 264,                      /* NL  */
+    ARRAY = 265,                   /* ARRAY  */
+    MATCH = 266,                   /* MATCH  */
+    NOTMATCH = 267,                /* NOTMATCH  */
+    MATCHOP = 268,                 /* MATCHOP  */
+    FINAL = 269,                   /* FINAL  */
+    DOT = 270,                     /* DOT  */
+    ALL = 271,                     /* ALL  */
+    CCL = 272,                     /* CCL  */
+    NCCL = 273,                    /* NCCL  */
+    CHAR = 274,                    /* CHAR  */
+    OR = 275,                      /* OR  */
+    STAR = 276,                    /* STAR  */
+    QUEST = 277,                   /* QUEST  */
+    PLUS = 278,                    /* PLUS  */
+    EMPTYRE = 279,                 /* EMPTYRE  */
+    AND = 280,                     /* AND  */
+    BOR = 281,                     /* BOR  */
+    APPEND = 282,                  /* APPEND  */
+    EQ = 283,                      /* EQ  */
+    GE = 284,                      /* GE  */
+    GT = 285,                      /* GT  */
+    LE = 286,                      /* LE  */
+    LT = 287,                      /* LT  */
+    NE = 288,                      /* NE  */
+    IN = 289,                      /* IN  */
+    ARG = 290,                     /* ARG  */
+    BLTIN = 291,                   /* BLTIN  */
+    BREAK = 292,                   /* BREAK  */
+    CLOSE = 293,                   /* CLOSE  */
+    CONTINUE = 294,                /* CONTINUE  */
+    DELETE = 295,                  /* DELETE  */
+    DO = 296,                      /* DO  */
+    EXIT = 297,                    /* EXIT  */
+    FOR = 298,                     /* FOR  */
+    FUNC = 299,                    /* FUNC  */
+    SUB = 300,                     /* SUB  */
+    GSUB = 301,                    /* GSUB  */
+    IF = 302,                      /* IF  */
+    INDEX = 303,                   /* INDEX  */
+    LSUBSTR = 304,                 /* LSUBSTR  */
+    MATCHFCN = 305,                /* MATCHFCN  */
+    NEXT = 306,                    /* NEXT  */
+    NEXTFILE = 307,                /* NEXTFILE  */
+    ADD = 308,                     /* ADD  */
+    MINUS = 309,                   /* MINUS  */
+    MULT = 310,                    /* MULT  */
+    DIVIDE = 311,                  /* DIVIDE  */
+    MOD = 312,                     /* MOD  */
+    ASSIGN = 313,                  /* ASSIGN  */
+    ASGNOP = 314,                  /* ASGNOP  */
+    ADDEQ = 315,                   /* ADDEQ  */
+    SUBEQ = 316,                   /* SUBEQ  */
+    MULTEQ = 317,                  /* MULTEQ  */
+    DIVEQ = 318,                   /* DIVEQ  */
+    MODEQ = 319,                   /* MODEQ  */
+    POWEQ = 320,                   /* POWEQ  */
+    PRINT = 321,                   /* PRINT  */
+    PRINTF = 322,                  /* PRINTF  */
+    SPRINTF = 323,                 /* SPRINTF  */
+    ELSE = 324,                    /* ELSE  */
+    INTEST = 325,                  /* INTEST  */
+    CONDEXPR = 326,                /* CONDEXPR  */
+    POSTINCR = 327,                /* POSTINCR  */
+    PREINCR = 328,                 /* PREINCR  */
+    POSTDECR = 329,                /* POSTDECR  */
+    PREDECR = 330,                 /* PREDECR  */
+    VAR = 331,                     /* VAR  */
+    IVAR = 332,                    /* IVAR  */
+    VARNF = 333,                   /* VARNF  */
+    CALL = 334,                    /* CALL  */
+    NUMBER = 335,                  /* NUMBER  */
+    STRING = 336,                  /* STRING  */
+    REGEXPR = 337,                 /* REGEXPR  */
+    GETLINE = 338,                 /* GETLINE  */
+    RETURN = 339,                  /* RETURN  */
+    SPLIT = 340,                   /* SPLIT  */
+    SUBSTR = 341,                  /* SUBSTR  */
+    WHILE = 342,                   /* WHILE  */
+    CAT = 343,                     /* CAT  */
+    NOT = 344,                     /* NOT  */
+    UMINUS = 345,                  /* UMINUS  */
+    POWER = 346,                   /* POWER  */
+    DECR = 347,                    /* DECR  */
+    INCR = 348,                    /* INCR  */
+    INDIRECT = 349,                /* INDIRECT  */
+    LASTTOKEN = 350                /* LASTTOKEN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define FIRSTTOKEN 258
 #define PROGRAM 259
 #define PASTAT 260
@@ -243,112 +309,302 @@
 #define STRING 336
 #define REGEXPR 337
 #define GETLINE 338
-#define SUBSTR 339
+#define RETURN 339
 #define SPLIT 340
-#define RETURN 341
+#define SUBSTR 341
 #define WHILE 342
 #define CAT 343
-#define UMINUS 344
-#define NOT 345
+#define NOT 344
+#define UMINUS 345
 #define POWER 346
-#define INCR 347
-#define DECR 348
+#define DECR 347
+#define INCR 348
 #define INDIRECT 349
 #define LASTTOKEN 350
 
-
-
-
-/* Copy the first part of user declarations.  */
-#line 25 "awkgram.y"
-
-#include <stdio.h>
-#include <string.h>
-#include "awk.h"
-
-void checkdup(Node *list, Cell *item);
-int yywrap(void) { return(1); }
-
-Node	*beginloc = 0;
-Node	*endloc = 0;
-int	infunc	= 0;	/* = 1 if in arglist or body of func */
-int	inloop	= 0;	/* = 1 if in while, for, do */
-char	*curfname = 0;	/* current function name */
-Node	*arglist = 0;	/* list of args for current function */
-
-
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 41 "awkgram.y"
+union YYSTYPE
 {
+#line 41 "awkgram.y"
+
 	Node	*p;
 	Cell	*cp;
 	int	i;
 	char	*s;
-}
-/* Line 193 of yacc.c.  */
-#line 309 "y.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 337 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
 
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_FIRSTTOKEN = 3,                 /* FIRSTTOKEN  */
+  YYSYMBOL_PROGRAM = 4,                    /* PROGRAM  */
+  YYSYMBOL_PASTAT = 5,                     /* PASTAT  */
+  YYSYMBOL_PASTAT2 = 6,                    /* PASTAT2  */
+  YYSYMBOL_XBEGIN = 7,                     /* XBEGIN  */
+  YYSYMBOL_XEND = 8,                       /* XEND  */
+  YYSYMBOL_NL = 9,                         /* NL  */
+  YYSYMBOL_10_ = 10,                       /* ','  */
+  YYSYMBOL_11_ = 11,                       /* '{'  */
+  YYSYMBOL_12_ = 12,                       /* '('  */
+  YYSYMBOL_13_ = 13,                       /* '|'  */
+  YYSYMBOL_14_ = 14,                       /* ';'  */
+  YYSYMBOL_15_ = 15,                       /* '/'  */
+  YYSYMBOL_16_ = 16,                       /* ')'  */
+  YYSYMBOL_17_ = 17,                       /* '}'  */
+  YYSYMBOL_18_ = 18,                       /* '['  */
+  YYSYMBOL_19_ = 19,                       /* ']'  */
+  YYSYMBOL_ARRAY = 20,                     /* ARRAY  */
+  YYSYMBOL_MATCH = 21,                     /* MATCH  */
+  YYSYMBOL_NOTMATCH = 22,                  /* NOTMATCH  */
+  YYSYMBOL_MATCHOP = 23,                   /* MATCHOP  */
+  YYSYMBOL_FINAL = 24,                     /* FINAL  */
+  YYSYMBOL_DOT = 25,                       /* DOT  */
+  YYSYMBOL_ALL = 26,                       /* ALL  */
+  YYSYMBOL_CCL = 27,                       /* CCL  */
+  YYSYMBOL_NCCL = 28,                      /* NCCL  */
+  YYSYMBOL_CHAR = 29,                      /* CHAR  */
+  YYSYMBOL_OR = 30,                        /* OR  */
+  YYSYMBOL_STAR = 31,                      /* STAR  */
+  YYSYMBOL_QUEST = 32,                     /* QUEST  */
+  YYSYMBOL_PLUS = 33,                      /* PLUS  */
+  YYSYMBOL_EMPTYRE = 34,                   /* EMPTYRE  */
+  YYSYMBOL_AND = 35,                       /* AND  */
+  YYSYMBOL_BOR = 36,                       /* BOR  */
+  YYSYMBOL_APPEND = 37,                    /* APPEND  */
+  YYSYMBOL_EQ = 38,                        /* EQ  */
+  YYSYMBOL_GE = 39,                        /* GE  */
+  YYSYMBOL_GT = 40,                        /* GT  */
+  YYSYMBOL_LE = 41,                        /* LE  */
+  YYSYMBOL_LT = 42,                        /* LT  */
+  YYSYMBOL_NE = 43,                        /* NE  */
+  YYSYMBOL_IN = 44,                        /* IN  */
+  YYSYMBOL_ARG = 45,                       /* ARG  */
+  YYSYMBOL_BLTIN = 46,                     /* BLTIN  */
+  YYSYMBOL_BREAK = 47,                     /* BREAK  */
+  YYSYMBOL_CLOSE = 48,                     /* CLOSE  */
+  YYSYMBOL_CONTINUE = 49,                  /* CONTINUE  */
+  YYSYMBOL_DELETE = 50,                    /* DELETE  */
+  YYSYMBOL_DO = 51,                        /* DO  */
+  YYSYMBOL_EXIT = 52,                      /* EXIT  */
+  YYSYMBOL_FOR = 53,                       /* FOR  */
+  YYSYMBOL_FUNC = 54,                      /* FUNC  */
+  YYSYMBOL_SUB = 55,                       /* SUB  */
+  YYSYMBOL_GSUB = 56,                      /* GSUB  */
+  YYSYMBOL_IF = 57,                        /* IF  */
+  YYSYMBOL_INDEX = 58,                     /* INDEX  */
+  YYSYMBOL_LSUBSTR = 59,                   /* LSUBSTR  */
+  YYSYMBOL_MATCHFCN = 60,                  /* MATCHFCN  */
+  YYSYMBOL_NEXT = 61,                      /* NEXT  */
+  YYSYMBOL_NEXTFILE = 62,                  /* NEXTFILE  */
+  YYSYMBOL_ADD = 63,                       /* ADD  */
+  YYSYMBOL_MINUS = 64,                     /* MINUS  */
+  YYSYMBOL_MULT = 65,                      /* MULT  */
+  YYSYMBOL_DIVIDE = 66,                    /* DIVIDE  */
+  YYSYMBOL_MOD = 67,                       /* MOD  */
+  YYSYMBOL_ASSIGN = 68,                    /* ASSIGN  */
+  YYSYMBOL_ASGNOP = 69,                    /* ASGNOP  */
+  YYSYMBOL_ADDEQ = 70,                     /* ADDEQ  */
+  YYSYMBOL_SUBEQ = 71,                     /* SUBEQ  */
+  YYSYMBOL_MULTEQ = 72,                    /* MULTEQ  */
+  YYSYMBOL_DIVEQ = 73,                     /* DIVEQ  */
+  YYSYMBOL_MODEQ = 74,                     /* MODEQ  */
+  YYSYMBOL_POWEQ = 75,                     /* POWEQ  */
+  YYSYMBOL_PRINT = 76,                     /* PRINT  */
+  YYSYMBOL_PRINTF = 77,                    /* PRINTF  */
+  YYSYMBOL_SPRINTF = 78,                   /* SPRINTF  */
+  YYSYMBOL_ELSE = 79,                      /* ELSE  */
+  YYSYMBOL_INTEST = 80,                    /* INTEST  */
+  YYSYMBOL_CONDEXPR = 81,                  /* CONDEXPR  */
+  YYSYMBOL_POSTINCR = 82,                  /* POSTINCR  */
+  YYSYMBOL_PREINCR = 83,                   /* PREINCR  */
+  YYSYMBOL_POSTDECR = 84,                  /* POSTDECR  */
+  YYSYMBOL_PREDECR = 85,                   /* PREDECR  */
+  YYSYMBOL_VAR = 86,                       /* VAR  */
+  YYSYMBOL_IVAR = 87,                      /* IVAR  */
+  YYSYMBOL_VARNF = 88,                     /* VARNF  */
+  YYSYMBOL_CALL = 89,                      /* CALL  */
+  YYSYMBOL_NUMBER = 90,                    /* NUMBER  */
+  YYSYMBOL_STRING = 91,                    /* STRING  */
+  YYSYMBOL_REGEXPR = 92,                   /* REGEXPR  */
+  YYSYMBOL_93_ = 93,                       /* '?'  */
+  YYSYMBOL_94_ = 94,                       /* ':'  */
+  YYSYMBOL_GETLINE = 95,                   /* GETLINE  */
+  YYSYMBOL_RETURN = 96,                    /* RETURN  */
+  YYSYMBOL_SPLIT = 97,                     /* SPLIT  */
+  YYSYMBOL_SUBSTR = 98,                    /* SUBSTR  */
+  YYSYMBOL_WHILE = 99,                     /* WHILE  */
+  YYSYMBOL_CAT = 100,                      /* CAT  */
+  YYSYMBOL_101_ = 101,                     /* '+'  */
+  YYSYMBOL_102_ = 102,                     /* '-'  */
+  YYSYMBOL_103_ = 103,                     /* '*'  */
+  YYSYMBOL_104_ = 104,                     /* '%'  */
+  YYSYMBOL_NOT = 105,                      /* NOT  */
+  YYSYMBOL_UMINUS = 106,                   /* UMINUS  */
+  YYSYMBOL_POWER = 107,                    /* POWER  */
+  YYSYMBOL_DECR = 108,                     /* DECR  */
+  YYSYMBOL_INCR = 109,                     /* INCR  */
+  YYSYMBOL_INDIRECT = 110,                 /* INDIRECT  */
+  YYSYMBOL_LASTTOKEN = 111,                /* LASTTOKEN  */
+  YYSYMBOL_YYACCEPT = 112,                 /* $accept  */
+  YYSYMBOL_program = 113,                  /* program  */
+  YYSYMBOL_and = 114,                      /* and  */
+  YYSYMBOL_bor = 115,                      /* bor  */
+  YYSYMBOL_comma = 116,                    /* comma  */
+  YYSYMBOL_do = 117,                       /* do  */
+  YYSYMBOL_else = 118,                     /* else  */
+  YYSYMBOL_for = 119,                      /* for  */
+  YYSYMBOL_120_1 = 120,                    /* $@1  */
+  YYSYMBOL_121_2 = 121,                    /* $@2  */
+  YYSYMBOL_122_3 = 122,                    /* $@3  */
+  YYSYMBOL_funcname = 123,                 /* funcname  */
+  YYSYMBOL_if = 124,                       /* if  */
+  YYSYMBOL_lbrace = 125,                   /* lbrace  */
+  YYSYMBOL_nl = 126,                       /* nl  */
+  YYSYMBOL_opt_nl = 127,                   /* opt_nl  */
+  YYSYMBOL_opt_pst = 128,                  /* opt_pst  */
+  YYSYMBOL_opt_simple_stmt = 129,          /* opt_simple_stmt  */
+  YYSYMBOL_pas = 130,                      /* pas  */
+  YYSYMBOL_pa_pat = 131,                   /* pa_pat  */
+  YYSYMBOL_pa_stat = 132,                  /* pa_stat  */
+  YYSYMBOL_133_4 = 133,                    /* $@4  */
+  YYSYMBOL_pa_stats = 134,                 /* pa_stats  */
+  YYSYMBOL_patlist = 135,                  /* patlist  */
+  YYSYMBOL_ppattern = 136,                 /* ppattern  */
+  YYSYMBOL_pattern = 137,                  /* pattern  */
+  YYSYMBOL_plist = 138,                    /* plist  */
+  YYSYMBOL_pplist = 139,                   /* pplist  */
+  YYSYMBOL_prarg = 140,                    /* prarg  */
+  YYSYMBOL_print = 141,                    /* print  */
+  YYSYMBOL_pst = 142,                      /* pst  */
+  YYSYMBOL_rbrace = 143,                   /* rbrace  */
+  YYSYMBOL_re = 144,                       /* re  */
+  YYSYMBOL_reg_expr = 145,                 /* reg_expr  */
+  YYSYMBOL_146_5 = 146,                    /* $@5  */
+  YYSYMBOL_rparen = 147,                   /* rparen  */
+  YYSYMBOL_simple_stmt = 148,              /* simple_stmt  */
+  YYSYMBOL_st = 149,                       /* st  */
+  YYSYMBOL_stmt = 150,                     /* stmt  */
+  YYSYMBOL_151_6 = 151,                    /* $@6  */
+  YYSYMBOL_152_7 = 152,                    /* $@7  */
+  YYSYMBOL_153_8 = 153,                    /* $@8  */
+  YYSYMBOL_stmtlist = 154,                 /* stmtlist  */
+  YYSYMBOL_subop = 155,                    /* subop  */
+  YYSYMBOL_term = 156,                     /* term  */
+  YYSYMBOL_var = 157,                      /* var  */
+  YYSYMBOL_varlist = 158,                  /* varlist  */
+  YYSYMBOL_varname = 159,                  /* varname  */
+  YYSYMBOL_while = 160                     /* while  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 322 "y.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -356,55 +612,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -421,11 +728,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -433,8 +740,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -448,92 +755,93 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  8
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   4628
+#define YYLAST   4659
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  112
@@ -541,24 +849,29 @@ union yyalloc
 #define YYNNTS  49
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  185
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  368
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   350
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,   104,     2,     2,
-      12,    16,   103,   101,     9,   102,     2,    15,     2,     2,
+      12,    16,   103,   101,    10,   102,     2,    15,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,    94,    14,
        2,     2,     2,    93,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -580,7 +893,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,    10,    20,    21,    22,    23,    24,
+       5,     6,     7,     8,     9,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
@@ -593,106 +906,8 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
-{
-       0,     0,     3,     5,     7,     9,    12,    14,    17,    19,
-      22,    24,    27,    29,    32,    33,    46,    47,    58,    59,
-      68,    70,    72,    77,    79,    82,    84,    87,    88,    90,
-      91,    93,    94,    96,    98,   102,   104,   106,   111,   116,
-     124,   128,   133,   138,   139,   149,   151,   155,   157,   161,
-     165,   171,   175,   179,   183,   187,   191,   197,   200,   202,
-     204,   208,   214,   218,   222,   226,   230,   234,   238,   242,
-     246,   250,   254,   258,   264,   269,   273,   276,   278,   280,
-     284,   288,   290,   294,   295,   297,   301,   303,   305,   307,
-     309,   312,   315,   317,   320,   322,   325,   326,   331,   333,
-     336,   341,   346,   351,   354,   360,   363,   365,   367,   369,
-     372,   375,   378,   379,   380,   390,   394,   397,   399,   404,
-     407,   411,   414,   417,   421,   424,   427,   428,   432,   435,
-     437,   440,   442,   444,   449,   453,   457,   461,   465,   469,
-     473,   476,   479,   482,   486,   491,   493,   497,   502,   505,
-     508,   511,   514,   517,   522,   526,   529,   531,   538,   545,
-     549,   556,   563,   565,   574,   583,   590,   595,   597,   604,
-     611,   620,   629,   638,   645,   647,   649,   654,   656,   659,
-     660,   662,   666,   668,   670,   672
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     113,     0,    -1,   130,    -1,     1,    -1,    35,    -1,   114,
-      10,    -1,    36,    -1,   115,    10,    -1,     9,    -1,   116,
-      10,    -1,    51,    -1,   117,    10,    -1,    79,    -1,   118,
-      10,    -1,    -1,    53,    12,   129,    14,   127,   137,    14,
-     127,   129,   147,   120,   150,    -1,    -1,    53,    12,   129,
-      14,    14,   127,   129,   147,   121,   150,    -1,    -1,    53,
-      12,   159,    44,   159,   147,   122,   150,    -1,    86,    -1,
-      89,    -1,    57,    12,   137,   147,    -1,    11,    -1,   125,
-      10,    -1,    10,    -1,   126,    10,    -1,    -1,   126,    -1,
-      -1,   142,    -1,    -1,   148,    -1,   128,    -1,   128,   134,
-     128,    -1,   137,    -1,   131,    -1,   131,   125,   154,    17,
-      -1,   131,     9,   127,   131,    -1,   131,     9,   127,   131,
-     125,   154,    17,    -1,   125,   154,    17,    -1,     7,   125,
-     154,    17,    -1,     8,   125,   154,    17,    -1,    -1,    54,
-     123,    12,   158,   147,   133,   125,   154,    17,    -1,   132,
-      -1,   134,   128,   132,    -1,   137,    -1,   135,   116,   137,
-      -1,   157,    69,   136,    -1,   136,    93,   136,    94,   136,
-      -1,   136,   115,   136,    -1,   136,   114,   136,    -1,   136,
-      23,   145,    -1,   136,    23,   136,    -1,   136,    44,   159,
-      -1,    12,   138,    16,    44,   159,    -1,   136,   156,    -1,
-     144,    -1,   156,    -1,   157,    69,   137,    -1,   137,    93,
-     137,    94,   137,    -1,   137,   115,   137,    -1,   137,   114,
-     137,    -1,   137,    38,   137,    -1,   137,    39,   137,    -1,
-     137,    40,   137,    -1,   137,    41,   137,    -1,   137,    42,
-     137,    -1,   137,    43,   137,    -1,   137,    23,   145,    -1,
-     137,    23,   137,    -1,   137,    44,   159,    -1,    12,   138,
-      16,    44,   159,    -1,   137,    13,    95,   157,    -1,   137,
-      13,    95,    -1,   137,   156,    -1,   144,    -1,   156,    -1,
-     137,   116,   137,    -1,   138,   116,   137,    -1,   136,    -1,
-     139,   116,   136,    -1,    -1,   139,    -1,    12,   138,    16,
-      -1,    76,    -1,    77,    -1,    10,    -1,    14,    -1,   142,
-      10,    -1,   142,    14,    -1,    17,    -1,   143,    10,    -1,
-     145,    -1,   106,   144,    -1,    -1,    15,   146,    92,    15,
-      -1,    16,    -1,   147,    10,    -1,   141,   140,    13,   156,
-      -1,   141,   140,    37,   156,    -1,   141,   140,    40,   156,
-      -1,   141,   140,    -1,    50,   159,    18,   135,    19,    -1,
-      50,   159,    -1,   137,    -1,     1,    -1,   126,    -1,    14,
-     127,    -1,    47,   149,    -1,    49,   149,    -1,    -1,    -1,
-     117,   151,   150,   152,    99,    12,   137,    16,   149,    -1,
-      52,   137,   149,    -1,    52,   149,    -1,   119,    -1,   124,
-     150,   118,   150,    -1,   124,   150,    -1,   125,   154,   143,
-      -1,    61,   149,    -1,    62,   149,    -1,    98,   137,   149,
-      -1,    98,   149,    -1,   148,   149,    -1,    -1,   160,   153,
-     150,    -1,    14,   127,    -1,   150,    -1,   154,   150,    -1,
-      55,    -1,    56,    -1,   156,    15,    69,   156,    -1,   156,
-     101,   156,    -1,   156,   102,   156,    -1,   156,   103,   156,
-      -1,   156,    15,   156,    -1,   156,   104,   156,    -1,   156,
-     107,   156,    -1,   102,   156,    -1,   101,   156,    -1,   106,
-     156,    -1,    46,    12,    16,    -1,    46,    12,   135,    16,
-      -1,    46,    -1,    89,    12,    16,    -1,    89,    12,   135,
-      16,    -1,    48,   156,    -1,   109,   157,    -1,   108,   157,
-      -1,   157,   109,    -1,   157,   108,    -1,    95,   157,    42,
-     156,    -1,    95,    42,   156,    -1,    95,   157,    -1,    95,
-      -1,    58,    12,   137,   116,   137,    16,    -1,    58,    12,
-     137,   116,   145,    16,    -1,    12,   137,    16,    -1,    60,
-      12,   137,   116,   145,    16,    -1,    60,    12,   137,   116,
-     137,    16,    -1,    90,    -1,    97,    12,   137,   116,   159,
-     116,   137,    16,    -1,    97,    12,   137,   116,   159,   116,
-     145,    16,    -1,    97,    12,   137,   116,   159,    16,    -1,
-      78,    12,   135,    16,    -1,    91,    -1,   155,    12,   145,
-     116,   137,    16,    -1,   155,    12,   137,   116,   137,    16,
-      -1,   155,    12,   145,   116,   137,   116,   157,    16,    -1,
-     155,    12,   137,   116,   137,   116,   157,    16,    -1,    96,
-      12,   137,   116,   137,   116,   137,    16,    -1,    96,    12,
-     137,   116,   137,    16,    -1,   157,    -1,   159,    -1,   159,
-      18,   135,    19,    -1,    87,    -1,   110,   156,    -1,    -1,
-      86,    -1,   158,   116,    86,    -1,    86,    -1,    45,    -1,
-      88,    -1,    99,    12,   137,   147,    -1
-};
-
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
        0,    98,    98,   100,   104,   104,   108,   108,   112,   112,
      116,   116,   120,   120,   124,   124,   126,   126,   128,   128,
@@ -716,105 +931,103 @@ static const yytype_uint16 yyrline[] =
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "FIRSTTOKEN", "PROGRAM", "PASTAT",
-  "PASTAT2", "XBEGIN", "XEND", "','", "NL", "'{'", "'('", "'|'", "';'",
-  "'/'", "')'", "'}'", "'['", "']'", "ARRAY", "MATCH", "NOTMATCH",
-  "MATCHOP", "FINAL", "DOT", "ALL", "CCL", "NCCL", "CHAR", "OR", "STAR",
-  "QUEST", "PLUS", "EMPTYRE", "AND", "BOR", "APPEND", "EQ", "GE", "GT",
-  "LE", "LT", "NE", "IN", "ARG", "BLTIN", "BREAK", "CLOSE", "CONTINUE",
-  "DELETE", "DO", "EXIT", "FOR", "FUNC", "SUB", "GSUB", "IF", "INDEX",
-  "LSUBSTR", "MATCHFCN", "NEXT", "NEXTFILE", "ADD", "MINUS", "MULT",
-  "DIVIDE", "MOD", "ASSIGN", "ASGNOP", "ADDEQ", "SUBEQ", "MULTEQ", "DIVEQ",
-  "MODEQ", "POWEQ", "PRINT", "PRINTF", "SPRINTF", "ELSE", "INTEST",
-  "CONDEXPR", "POSTINCR", "PREINCR", "POSTDECR", "PREDECR", "VAR", "IVAR",
-  "VARNF", "CALL", "NUMBER", "STRING", "REGEXPR", "'?'", "':'", "GETLINE",
-  "SUBSTR", "SPLIT", "RETURN", "WHILE", "CAT", "'+'", "'-'", "'*'", "'%'",
-  "UMINUS", "NOT", "POWER", "INCR", "DECR", "INDIRECT", "LASTTOKEN",
-  "$accept", "program", "and", "bor", "comma", "do", "else", "for", "@1",
-  "@2", "@3", "funcname", "if", "lbrace", "nl", "opt_nl", "opt_pst",
-  "opt_simple_stmt", "pas", "pa_pat", "pa_stat", "@4", "pa_stats",
-  "patlist", "ppattern", "pattern", "plist", "pplist", "prarg", "print",
-  "pst", "rbrace", "re", "reg_expr", "@5", "rparen", "simple_stmt", "st",
-  "stmt", "@6", "@7", "@8", "stmtlist", "subop", "term", "var", "varlist",
-  "varname", "while", 0
+  "\"end of file\"", "error", "\"invalid token\"", "FIRSTTOKEN",
+  "PROGRAM", "PASTAT", "PASTAT2", "XBEGIN", "XEND", "NL", "','", "'{'",
+  "'('", "'|'", "';'", "'/'", "')'", "'}'", "'['", "']'", "ARRAY", "MATCH",
+  "NOTMATCH", "MATCHOP", "FINAL", "DOT", "ALL", "CCL", "NCCL", "CHAR",
+  "OR", "STAR", "QUEST", "PLUS", "EMPTYRE", "AND", "BOR", "APPEND", "EQ",
+  "GE", "GT", "LE", "LT", "NE", "IN", "ARG", "BLTIN", "BREAK", "CLOSE",
+  "CONTINUE", "DELETE", "DO", "EXIT", "FOR", "FUNC", "SUB", "GSUB", "IF",
+  "INDEX", "LSUBSTR", "MATCHFCN", "NEXT", "NEXTFILE", "ADD", "MINUS",
+  "MULT", "DIVIDE", "MOD", "ASSIGN", "ASGNOP", "ADDEQ", "SUBEQ", "MULTEQ",
+  "DIVEQ", "MODEQ", "POWEQ", "PRINT", "PRINTF", "SPRINTF", "ELSE",
+  "INTEST", "CONDEXPR", "POSTINCR", "PREINCR", "POSTDECR", "PREDECR",
+  "VAR", "IVAR", "VARNF", "CALL", "NUMBER", "STRING", "REGEXPR", "'?'",
+  "':'", "GETLINE", "RETURN", "SPLIT", "SUBSTR", "WHILE", "CAT", "'+'",
+  "'-'", "'*'", "'%'", "NOT", "UMINUS", "POWER", "DECR", "INCR",
+  "INDIRECT", "LASTTOKEN", "$accept", "program", "and", "bor", "comma",
+  "do", "else", "for", "$@1", "$@2", "$@3", "funcname", "if", "lbrace",
+  "nl", "opt_nl", "opt_pst", "opt_simple_stmt", "pas", "pa_pat", "pa_stat",
+  "$@4", "pa_stats", "patlist", "ppattern", "pattern", "plist", "pplist",
+  "prarg", "print", "pst", "rbrace", "re", "reg_expr", "$@5", "rparen",
+  "simple_stmt", "st", "stmt", "$@6", "$@7", "$@8", "stmtlist", "subop",
+  "term", "var", "varlist", "varname", "while", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,    44,
-     264,   123,    40,   124,    59,    47,    41,   125,    91,    93,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,    63,    58,   338,   339,   340,   341,   342,
-     343,    43,    45,    42,    37,   344,   345,   346,   347,   348,
-     349,   350
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,   112,   113,   113,   114,   114,   115,   115,   116,   116,
-     117,   117,   118,   118,   120,   119,   121,   119,   122,   119,
-     123,   123,   124,   125,   125,   126,   126,   127,   127,   128,
-     128,   129,   129,   130,   130,   131,   132,   132,   132,   132,
-     132,   132,   132,   133,   132,   134,   134,   135,   135,   136,
-     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
-     137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
-     137,   137,   137,   137,   137,   137,   137,   137,   137,   138,
-     138,   139,   139,   140,   140,   140,   141,   141,   142,   142,
-     142,   142,   143,   143,   144,   144,   146,   145,   147,   147,
-     148,   148,   148,   148,   148,   148,   148,   148,   149,   149,
-     150,   150,   151,   152,   150,   150,   150,   150,   150,   150,
-     150,   150,   150,   150,   150,   150,   153,   150,   150,   154,
-     154,   155,   155,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   156,   157,   157,   157,   157,   158,
-     158,   158,   159,   159,   159,   160
-};
+#define YYPACT_NINF (-308)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-32)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     1,     1,     1,     2,     1,     2,     1,     2,
-       1,     2,     1,     2,     0,    12,     0,    10,     0,     8,
-       1,     1,     4,     1,     2,     1,     2,     0,     1,     0,
-       1,     0,     1,     1,     3,     1,     1,     4,     4,     7,
-       3,     4,     4,     0,     9,     1,     3,     1,     3,     3,
-       5,     3,     3,     3,     3,     3,     5,     2,     1,     1,
-       3,     5,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     5,     4,     3,     2,     1,     1,     3,
-       3,     1,     3,     0,     1,     3,     1,     1,     1,     1,
-       2,     2,     1,     2,     1,     2,     0,     4,     1,     2,
-       4,     4,     4,     2,     5,     2,     1,     1,     1,     2,
-       2,     2,     0,     0,     9,     3,     2,     1,     4,     2,
-       3,     2,     2,     3,     2,     2,     0,     3,     2,     1,
-       2,     1,     1,     4,     3,     3,     3,     3,     3,     3,
-       2,     2,     2,     3,     4,     1,     3,     4,     2,     2,
-       2,     2,     2,     4,     3,     2,     1,     6,     6,     3,
-       6,     6,     1,     8,     8,     6,     4,     1,     6,     6,
-       8,     8,     8,     6,     1,     1,     4,     1,     2,     0,
-       1,     3,     1,     1,     1,     4
+     681,  -308,  -308,  -308,    77,  1585,  -308,    86,  -308,    50,
+      50,  -308,  4223,  -308,  -308,    66,  4549,   -56,  -308,  -308,
+      76,    90,    92,  -308,  -308,  -308,    93,  -308,  -308,   212,
+     104,   113,  4549,  4549,  4281,   248,   248,  4549,   812,    34,
+    -308,   132,  3509,  -308,  -308,   121,   -11,   -44,   117,  -308,
+    -308,   812,   812,  2194,    38,    57,  4038,  4223,  4549,   -11,
+      44,  -308,  -308,   130,  4223,  4223,  4223,  4096,  4549,   115,
+    4223,  4223,    51,    51,  -308,    51,  -308,  -308,  -308,  -308,
+    -308,   151,   141,   141,   -31,  -308,  1745,   149,   153,   141,
+     141,  -308,  -308,  1745,   160,   154,  -308,  1426,   812,  3509,
+    4339,   141,  -308,   880,  -308,   151,   812,  1585,    82,  4223,
+    -308,  -308,  4223,  4223,  4223,  4223,  4223,  4223,   -31,  4223,
+    1803,  1861,   -11,  4223,  4397,  4549,  4549,  4549,  4549,  4549,
+    4223,  -308,  -308,  4223,   948,  1016,  -308,  -308,  1919,   140,
+    1919,   171,  -308,    65,  3509,  2682,   102,  2591,  2591,    69,
+    -308,   107,   -11,  4549,  2591,  2591,  -308,   182,  -308,   151,
+     182,  -308,  -308,   176,  1687,  -308,  1493,  4223,  -308,  -308,
+    1687,  -308,  4223,  -308,  1426,   133,  1084,  4223,  3911,   201,
+      10,  -308,   -11,    -2,  -308,  -308,  -308,  1426,  4223,  1152,
+    -308,   248,  3760,  -308,  3760,  3760,  3760,  3760,  3760,  3760,
+    -308,  2773,  -308,  3680,  -308,  3600,  2591,   201,  4549,    51,
+      -6,    -6,    51,    51,    51,  3509,    21,  -308,  -308,  -308,
+    3509,   -31,  3509,  -308,  -308,  1919,  -308,   108,  1919,  1919,
+    -308,  -308,   -11,     1,  1919,  -308,  -308,  4223,  -308,   200,
+    -308,    18,  2864,  -308,  2864,  -308,  -308,  1222,  -308,   208,
+     110,  4455,   -31,  4455,  1977,  2035,   -11,  2093,  4549,  4549,
+    4549,  4455,  -308,    50,  -308,  -308,  4223,  1919,  1919,   -11,
+    -308,  -308,  3509,  -308,    13,   209,  2955,   204,  3046,   211,
+     111,  2295,    24,   142,   -31,   209,   209,   125,  -308,  -308,
+    -308,   189,  4223,  4524,  -308,  -308,  3831,  4165,  3980,  3911,
+     -11,   -11,   -11,  3911,   812,  3509,  2396,  2497,  -308,  -308,
+      50,  -308,  -308,  -308,  -308,  -308,  1919,  -308,  1919,  -308,
+     151,  4223,   218,   224,   -31,   120,  4455,  1290,  -308,   187,
+    -308,   187,   812,  3137,   232,  3228,  1560,  3327,   209,  4223,
+    -308,   189,  3911,  -308,   233,   234,  1358,  -308,  -308,  -308,
+     218,   151,  1426,  3418,  -308,  -308,  -308,   209,  1560,  -308,
+     141,  1426,   218,  -308,  -308,   209,  1426,  -308
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
@@ -825,13 +1038,13 @@ static const yytype_uint8 yydefact[] =
       45,    29,    35,    77,    94,     0,    78,   174,   175,    90,
       91,     0,     0,     0,     0,     0,     0,     0,     0,   148,
      174,    20,    21,     0,     0,     0,     0,     0,     0,   155,
-       0,     0,   141,   140,    95,   142,   150,   149,   178,   107,
+       0,     0,   141,   140,    95,   142,   149,   150,   178,   107,
       24,    27,     0,     0,     0,    10,     0,     0,     0,     0,
        0,    86,    87,     0,     0,   112,   117,     0,     0,   106,
       83,     0,   129,     0,   126,    27,     0,    34,     0,     0,
        4,     6,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    76,     0,     0,     0,     0,     0,     0,     0,
-       0,   152,   151,     0,     0,     0,     8,   159,     0,     0,
+       0,   151,   152,     0,     0,     0,     8,   159,     0,     0,
        0,     0,   143,     0,    47,     0,   179,     0,     0,     0,
      146,     0,   154,     0,     0,     0,    25,    28,   128,    27,
      108,   110,   111,   105,     0,   116,     0,     0,   121,   122,
@@ -849,276 +1062,261 @@ static const yytype_uint8 yydefact[] =
        0,     0,     0,    27,     0,    22,   185,     0,    13,   118,
       93,    85,     0,    54,    53,    55,     0,    52,    51,    82,
      100,   101,   102,    49,     0,    61,     0,     0,   181,    99,
-       0,   157,   158,   161,   160,   173,     0,   165,     0,   104,
+       0,   157,   158,   161,   160,   165,     0,   173,     0,   104,
       27,     0,     0,     0,     0,     0,     0,     0,   169,     0,
-     168,     0,     0,     0,     0,    94,     0,     0,    18,     0,
-      56,     0,    50,    39,     0,     0,     0,   172,   163,   164,
+     168,     0,     0,     0,    94,     0,     0,     0,    18,     0,
+      56,     0,    50,    39,     0,     0,     0,   163,   164,   172,
        0,    27,     0,     0,   171,   170,    44,    16,     0,    19,
        0,     0,     0,   114,    17,    14,     0,    15
 };
 
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -308,  -308,  -129,   -96,    61,  -308,  -308,  -308,  -308,  -308,
+    -308,  -308,  -308,    -4,   -73,   -90,   210,  -307,  -308,    64,
+     148,  -308,  -308,   -39,  -181,   527,  -170,  -308,  -308,  -308,
+    -308,  -308,   -32,   -85,  -308,  -203,  -163,   -30,   310,  -308,
+    -308,  -308,   -40,  -308,   270,   -16,  -308,    87,  -308
+};
+
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     4,   120,   121,   225,    95,   247,    96,   366,   361,
+       0,     4,   120,   121,   225,    95,   247,    96,   366,   361,
      352,    63,    97,    98,   160,   158,     5,   239,     6,    39,
       40,   310,    41,   143,   178,    99,    54,   179,   180,   100,
        7,   249,    43,    44,    55,   275,   101,   161,   102,   174,
      287,   187,   103,    45,    46,    47,   227,    48,   104
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -289
-static const yytype_int16 yypact[] =
-{
-     726,  -289,  -289,  -289,    30,  1611,  -289,    63,  -289,    95,
-      95,  -289,  4164,  -289,  -289,    29,  4518,    74,  -289,  -289,
-     102,   103,   113,  -289,  -289,  -289,   124,  -289,  -289,   110,
-     129,   139,  4518,  4518,  4223,   182,   182,  4518,   839,   115,
-    -289,   151,  3490,  -289,  -289,   146,    -8,   -42,   109,  -289,
-    -289,   839,   839,  1702,    24,    61,  3987,  4164,  4518,    -8,
-     -58,  -289,  -289,   159,  4164,  4164,  4164,  4046,  4518,   130,
-    4164,  4164,    79,    79,  -289,    79,  -289,  -289,  -289,  -289,
-    -289,   181,   174,   174,    12,  -289,  2226,   188,   190,   174,
-     174,  -289,  -289,  2226,   195,   184,  -289,  1452,   839,  3490,
-    4282,   174,  -289,   907,  -289,   181,   839,  1611,   116,  4164,
-    -289,  -289,  4164,  4164,  4164,  4164,  4164,  4164,    12,  4164,
-    2285,  2344,    -8,  4164,  4341,  4518,  4518,  4518,  4518,  4518,
-    4164,  -289,  -289,  4164,   975,  1043,  -289,  -289,  2403,   164,
-    2403,   197,  -289,    38,  3490,  2671,   128,  2066,  2066,    72,
-    -289,    76,    -8,  4518,  2066,  2066,  -289,   205,  -289,   181,
-     205,  -289,  -289,   198,  2167,  -289,  1519,  4164,  -289,  -289,
-    2167,  -289,  4164,  -289,  1452,   138,  1111,  4164,  3869,   209,
-      18,  -289,    -8,    -7,  -289,  -289,  -289,  1452,  4164,  1179,
-    -289,   182,  3741,  -289,  3741,  3741,  3741,  3741,  3741,  3741,
-    -289,  2762,  -289,  3661,  -289,  3581,  2066,   209,  4518,    79,
-      13,    13,    79,    79,    79,  3490,    25,  -289,  -289,  -289,
-    3490,    12,  3490,  -289,  -289,  2403,  -289,    88,  2403,  2403,
-    -289,  -289,    -8,  2403,    19,  -289,  -289,  4164,  -289,   210,
-    -289,    21,  2853,  -289,  2853,  -289,  -289,  1248,  -289,   222,
-     126,  4400,    12,  4400,  2462,  2521,    -8,  2580,  4518,  4518,
-    4518,  4400,  -289,    95,  -289,  -289,  4164,  2403,  2403,    -8,
-    -289,  -289,  3490,  -289,     1,   224,  2944,   220,  3035,   230,
-    1793,   140,    27,   191,    12,   224,   224,   156,  -289,  -289,
-    -289,   206,  4164,  4459,  -289,  -289,  3800,  4105,  3928,  3869,
-      -8,    -8,    -8,  3869,   839,  3490,  1884,  1975,  -289,  -289,
-      95,  -289,  -289,  -289,  -289,  -289,  2403,  -289,  2403,  -289,
-     181,  4164,   241,   249,    12,   141,  4400,  1316,  -289,    35,
-    -289,    35,   839,  3126,  3217,   247,  1586,  3308,   224,  4164,
-    -289,   206,  3869,  -289,   250,   256,  1384,  -289,  -289,  -289,
-     241,   181,  1452,  3399,  -289,  -289,  -289,   224,  1586,  -289,
-     174,  1452,   241,  -289,  -289,   224,  1452,  -289
-};
-
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
-{
-    -289,  -289,  -129,   -45,   177,  -289,  -289,  -289,  -289,  -289,
-    -289,  -289,  -289,    -4,   -73,   -80,   232,  -288,  -289,    77,
-     167,  -289,  -289,   -44,  -179,   527,  -173,  -289,  -289,  -289,
-    -289,  -289,   -32,   -85,  -289,  -232,  -163,   -30,   383,  -289,
-    -289,  -289,   -37,  -289,   270,   -16,  -289,   -75,  -289
-};
-
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -32
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      60,    38,    74,   240,   250,    51,    52,   124,   157,   163,
-     285,   219,   286,    69,   134,   135,    60,    60,    60,    76,
-      77,    60,   149,   151,   193,   188,    60,   130,   124,   219,
-       8,   258,   157,   136,   136,   106,   136,    60,   207,   133,
-     139,    56,    60,   200,   270,   219,   319,   136,   350,   254,
-     131,   132,    60,   162,   224,   259,   165,    14,   260,   168,
-     169,   176,   261,   171,    14,   284,   131,   132,   181,   189,
-     362,   184,   293,    49,   296,   297,   298,    50,   299,   236,
-      14,   136,   303,    60,   183,   136,   157,   308,   230,   216,
-     338,   241,   231,   125,   126,   127,   128,   136,    23,   129,
-      25,   131,   132,    38,   273,    23,    11,    25,    60,    60,
-      60,    60,    60,    60,    64,    65,   127,   128,   357,   325,
-     129,    23,    24,    25,   105,    66,    11,   133,    60,    60,
-     365,    60,    60,   255,   238,   136,    67,    60,    60,    60,
-     243,    70,   291,   277,   279,    37,   271,   342,    60,   136,
-     136,    71,    68,   141,    60,    14,   317,   341,   123,   281,
-      61,     2,    60,    62,   254,     3,   294,   254,   254,   254,
-     254,   146,   153,   240,   254,   265,    60,   295,    60,    60,
-      60,    60,    60,    60,   156,    60,   129,    60,   159,    60,
-      60,   156,    60,   282,   173,   240,    23,    24,    25,    60,
-     166,   156,   167,   321,    60,   320,    60,   172,   221,   322,
-     157,   191,   223,   254,   226,   235,   237,   246,   136,   181,
-      37,   181,   181,   181,   283,   181,    60,    14,    60,   181,
-     138,   140,   290,   335,   309,   183,   312,   183,   183,   183,
-     336,   183,    60,    60,    60,   183,   314,   157,   255,   340,
-     324,   255,   255,   255,   255,   323,    60,   273,   255,   304,
-      60,   339,    60,   349,    60,   263,   354,   327,    23,    24,
-      25,   358,   355,   107,   190,     0,     0,    60,   157,     0,
-      60,    60,    60,    60,     0,     0,    59,    60,     0,    60,
-      60,    60,    37,     0,   181,   346,     0,   255,     0,     0,
-       0,     0,    72,    73,    75,     0,   332,    78,     0,     0,
-     183,     0,   122,   344,     0,   345,     0,    60,    60,     0,
-       0,    60,     0,   122,   228,   229,    60,     0,    75,     0,
-     363,   233,   234,     0,     0,     0,     0,    60,   152,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   257,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
-     182,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   267,   268,     0,     0,     0,     0,     0,
+      60,    38,    74,   240,   124,    51,    52,   250,   157,   124,
+     219,   134,   135,    69,    14,   188,    60,    60,    60,    76,
+      77,    60,   219,   258,   193,   130,    60,   149,   151,   350,
+      61,   136,   157,    62,   136,   106,   133,    60,   207,   285,
+     270,   286,    60,   319,   105,    11,    14,   259,   136,   254,
+     260,   362,    60,   162,   139,    23,   165,    25,   176,   168,
+     169,    11,   284,   171,   131,   132,   189,   261,   181,   236,
+     293,   184,   296,   297,   298,   136,   299,     8,    56,   136,
+     303,   224,   255,    60,   183,   230,   157,    23,    64,    25,
+     125,   126,   127,   128,   216,    49,   129,   127,   128,   308,
+      50,   129,    65,    38,    66,    67,   131,   132,    60,    60,
+      60,    60,    60,    60,   138,   140,    70,   136,   136,   338,
+     136,   136,   325,   231,   273,    71,   291,   315,    60,    60,
+     136,    60,    60,   123,   238,   133,   341,    60,    60,    60,
+     243,     2,   146,   277,   279,   342,     3,   357,    60,   141,
+     156,   156,   131,   132,    60,   159,   320,   153,   129,   365,
+     156,   166,    60,   173,   254,   167,   294,   254,   254,   254,
+     254,   163,   172,   240,   254,   265,    60,   191,    60,    60,
+      60,    60,    60,    60,   221,    60,   223,    60,   226,    60,
+      60,   235,    60,   321,   237,   240,   219,   255,   282,    60,
+     255,   255,   255,   255,    60,   200,    60,   255,   228,   229,
+     157,   136,   246,   254,   283,   233,   234,   290,   309,   181,
+     312,   181,   181,   181,   323,   181,    60,   314,    60,   181,
+     336,   334,    14,   324,   273,   183,   339,   183,   183,   183,
+     257,   183,    60,    60,    60,   183,   255,   157,   348,   354,
+     355,   107,   263,   241,    68,   190,    60,    14,     0,   304,
+      60,   358,    60,     0,   327,    60,     0,   267,   268,     0,
+       0,     0,     0,    23,    24,    25,     0,    60,   157,     0,
+      60,    60,    60,    60,     0,     0,    59,    60,   274,    60,
+      60,    60,   346,    14,   181,     0,     0,    37,    23,    24,
+      25,     0,    72,    73,    75,     0,   332,    78,   271,     0,
+     183,   140,   122,   344,     0,   345,     0,    60,     0,    60,
+     280,    60,    37,   122,     0,     0,    60,     0,    75,     0,
+     363,     0,     0,     0,    23,    24,    25,    60,   152,   295,
+       0,   316,   318,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    37,     0,
+       0,     0,     0,     0,     0,     0,     0,   329,   331,   122,
+     182,   322,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   140,     0,     0,     0,
        0,     0,     0,     0,   209,   210,   211,   212,   213,   214,
-       0,     0,     0,     0,   274,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   122,   122,     0,   122,   122,     0,
-       0,     0,     0,   232,   122,   122,     0,   140,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   175,     0,     0,
+       0,   340,     0,   186,   122,   122,     0,   122,   122,     0,
+       0,     0,     0,   232,   122,   122,     0,     0,     0,     0,
        0,     0,     0,     0,   122,     0,     0,     0,     0,     0,
-     122,     0,     0,     0,     0,     0,     0,     0,   256,     0,
-       0,     0,     0,     0,     0,     0,     0,   316,   318,     0,
+     122,     0,     0,     0,   186,   186,     0,     0,   256,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,   122,     0,   122,   122,   122,   122,   122,   122,
        0,   122,     0,   122,     0,   122,   122,     0,   269,     0,
-     175,     0,     0,   329,   331,   122,   186,     0,     0,     0,
-     122,     0,   122,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   140,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   122,     0,   122,     0,     0,   186,   186,     0,
+       0,     0,     0,     0,   245,   122,   186,     0,     0,     0,
+     122,     0,   122,     0,     0,     0,     0,   262,     0,   186,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,     0,   122,     0,     0,     0,     0,     0,
        0,   182,     0,   182,   182,   182,     0,   182,   300,   301,
      302,   182,    42,     0,     0,     0,     0,     0,     0,    53,
        0,     0,   122,     0,     0,     0,   122,     0,   122,     0,
-     122,     0,     0,     0,     0,     0,     0,   245,     0,   186,
+       0,   122,     0,     0,     0,     0,     0,   289,     0,     0,
        0,     0,     0,   256,     0,     0,   256,   256,   256,   256,
-     262,     0,   186,   256,     0,   122,   122,   122,     0,     0,
+       0,     0,     0,   256,     0,   122,   122,   122,     0,     0,
        0,     0,     0,   144,   145,     0,     0,     0,     0,     0,
        0,   147,   148,   144,   144,     0,   182,   154,   155,     0,
-       0,     0,     0,   122,   122,     0,     0,   122,     0,     0,
+       0,     0,     0,   122,     0,   122,     0,   122,     0,     0,
        0,     0,   256,   164,     0,     0,     0,     0,     0,     0,
      170,     0,     0,   122,     0,     0,     0,     0,     0,     0,
-     289,     0,     0,     0,    42,     0,   192,     0,     0,   194,
+       0,     0,     0,     0,    42,     0,   192,   186,     0,   194,
      195,   196,   197,   198,   199,     0,   201,   203,   205,     0,
-     206,     0,     0,     0,     0,     0,     0,   215,     0,     0,
-     144,     0,     0,     0,     0,   220,     0,   222,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   242,     0,     0,     0,     0,   244,
+     206,     0,     0,     0,     0,     0,   186,   215,     0,     0,
+     144,     0,   359,     0,     0,   220,     0,   222,     0,     0,
+       0,   364,     0,     0,     0,     0,   367,     0,     0,     0,
+       0,   -29,     1,     0,     0,     0,     0,     0,   -29,   -29,
+       2,     0,   -29,   -29,   242,     3,   -29,     0,     0,   244,
        0,     0,     0,     0,    53,     0,     0,     0,     0,     0,
-     186,     0,     0,     0,     0,    42,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   -29,     1,     0,   186,
-       0,     0,     0,   -29,   -29,   359,     2,   -29,   -29,     0,
-       3,   -29,     0,     0,   364,     0,     0,     0,     0,   367,
-       0,     0,   272,     0,     0,   276,   278,     0,     0,     0,
-     280,     0,     0,     0,   144,     0,     0,     0,     0,     0,
-       0,   -29,   -29,     0,   -29,     0,     0,     0,     0,     0,
-     -29,   -29,   -29,     0,   -29,     0,   -29,     0,     0,     0,
-       0,     0,     0,   305,   306,   307,     0,     0,     0,     0,
-       0,     0,     0,     0,   -29,     0,     0,     0,     0,     0,
-       0,     0,   -29,   -29,   -29,   -29,   -29,   -29,     0,    53,
-       0,   -29,   -29,   -29,     0,     0,     0,   -29,   -29,     0,
-       0,     0,   -29,     0,   -29,   -29,   -29,     0,     0,     0,
-      79,     0,     0,   333,     0,   334,     0,     0,   337,    80,
-      11,    12,     0,    81,    13,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   353,     0,     0,     0,
+       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   -29,   -29,     0,   -29,
+       0,     0,     0,     0,     0,   -29,   -29,   -29,     0,   -29,
+       0,   -29,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   272,     0,     0,   276,   278,     0,     0,   -29,
+       0,   281,     0,     0,   144,     0,     0,   -29,   -29,   -29,
+     -29,   -29,   -29,     0,     0,     0,   -29,     0,   -29,   -29,
+       0,     0,   -29,   -29,     0,     0,   -29,     0,     0,   -29,
+     -29,   -29,     0,   305,   306,   307,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    14,    15,    82,    16,    83,    84,
-      85,    86,    87,     0,    18,    19,    88,    20,     0,    21,
-      89,    90,     0,     0,     0,     0,     0,     0,    79,     0,
-       0,     0,     0,     0,     0,    91,    92,    22,    11,    12,
-       0,    81,    13,     0,   185,    23,    24,    25,    26,    27,
-      28,     0,     0,     0,    29,    30,    31,    93,    94,     0,
-      32,    33,     0,     0,     0,    34,     0,    35,    36,    37,
-       0,     0,    14,    15,    82,    16,    83,    84,    85,    86,
-      87,     0,    18,    19,    88,    20,     0,    21,    89,    90,
-       0,     0,     0,     0,     0,     0,    79,     0,     0,     0,
-       0,     0,     0,    91,    92,    22,    11,    12,     0,    81,
-      13,     0,   217,    23,    24,    25,    26,    27,    28,     0,
-       0,     0,    29,    30,    31,    93,    94,     0,    32,    33,
-       0,     0,     0,    34,     0,    35,    36,    37,     0,     0,
-      14,    15,    82,    16,    83,    84,    85,    86,    87,     0,
-      18,    19,    88,    20,     0,    21,    89,    90,     0,     0,
-       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
-       0,    91,    92,    22,    11,    12,     0,    81,    13,     0,
-     218,    23,    24,    25,    26,    27,    28,     0,     0,     0,
-      29,    30,    31,    93,    94,     0,    32,    33,     0,     0,
-       0,    34,     0,    35,    36,    37,     0,     0,    14,    15,
-      82,    16,    83,    84,    85,    86,    87,     0,    18,    19,
-      88,    20,     0,    21,    89,    90,     0,     0,     0,     0,
-       0,     0,    79,     0,     0,     0,     0,     0,     0,    91,
-      92,    22,    11,    12,     0,    81,    13,     0,   248,    23,
-      24,    25,    26,    27,    28,     0,     0,     0,    29,    30,
-      31,    93,    94,     0,    32,    33,     0,     0,     0,    34,
-       0,    35,    36,    37,     0,     0,    14,    15,    82,    16,
-      83,    84,    85,    86,    87,     0,    18,    19,    88,    20,
-       0,    21,    89,    90,     0,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,     0,     0,     0,    91,    92,    22,
-      11,    12,     0,    81,    13,     0,   264,    23,    24,    25,
-      26,    27,    28,     0,     0,     0,    29,    30,    31,    93,
-      94,     0,    32,    33,     0,     0,     0,    34,     0,    35,
-      36,    37,     0,     0,    14,    15,    82,    16,    83,    84,
-      85,    86,    87,     0,    18,    19,    88,    20,     0,    21,
-      89,    90,     0,     0,     0,     0,     0,     0,     0,    79,
-       0,     0,     0,     0,     0,    91,    92,    22,   288,    11,
-      12,     0,    81,    13,     0,    23,    24,    25,    26,    27,
-      28,     0,     0,     0,    29,    30,    31,    93,    94,     0,
-      32,    33,     0,     0,     0,    34,     0,    35,    36,    37,
-       0,     0,     0,    14,    15,    82,    16,    83,    84,    85,
+       0,     0,     0,    79,     0,     0,     0,     0,     0,    53,
+       0,    80,     0,    11,    12,     0,    81,    13,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   333,     0,   335,     0,     0,   337,     0,
+       0,     0,     0,     0,     0,     0,     0,    14,    15,    82,
+      16,    83,    84,    85,    86,    87,   353,    18,    19,    88,
+      20,     0,    21,    89,    90,     0,     0,     0,     0,     0,
+       0,    79,     0,     0,     0,     0,     0,     0,    91,    92,
+      22,    11,    12,     0,    81,    13,     0,   185,    23,    24,
+      25,    26,    27,    28,     0,     0,     0,    29,    93,    30,
+      31,    94,     0,    32,    33,     0,     0,    34,     0,     0,
+      35,    36,    37,     0,     0,    14,    15,    82,    16,    83,
+      84,    85,    86,    87,     0,    18,    19,    88,    20,     0,
+      21,    89,    90,     0,     0,     0,     0,     0,     0,    79,
+       0,     0,     0,     0,     0,     0,    91,    92,    22,    11,
+      12,     0,    81,    13,     0,   217,    23,    24,    25,    26,
+      27,    28,     0,     0,     0,    29,    93,    30,    31,    94,
+       0,    32,    33,     0,     0,    34,     0,     0,    35,    36,
+      37,     0,     0,    14,    15,    82,    16,    83,    84,    85,
       86,    87,     0,    18,    19,    88,    20,     0,    21,    89,
       90,     0,     0,     0,     0,     0,     0,    79,     0,     0,
        0,     0,     0,     0,    91,    92,    22,    11,    12,     0,
-      81,    13,     0,   343,    23,    24,    25,    26,    27,    28,
-       0,     0,     0,    29,    30,    31,    93,    94,     0,    32,
-      33,     0,     0,     0,    34,     0,    35,    36,    37,     0,
+      81,    13,     0,   218,    23,    24,    25,    26,    27,    28,
+       0,     0,     0,    29,    93,    30,    31,    94,     0,    32,
+      33,     0,     0,    34,     0,     0,    35,    36,    37,     0,
        0,    14,    15,    82,    16,    83,    84,    85,    86,    87,
        0,    18,    19,    88,    20,     0,    21,    89,    90,     0,
        0,     0,     0,     0,     0,    79,     0,     0,     0,     0,
        0,     0,    91,    92,    22,    11,    12,     0,    81,    13,
-       0,   356,    23,    24,    25,    26,    27,    28,     0,     0,
-       0,    29,    30,    31,    93,    94,     0,    32,    33,     0,
-       0,     0,    34,     0,    35,    36,    37,     0,     0,    14,
+       0,   248,    23,    24,    25,    26,    27,    28,     0,     0,
+       0,    29,    93,    30,    31,    94,     0,    32,    33,     0,
+       0,    34,     0,     0,    35,    36,    37,     0,     0,    14,
       15,    82,    16,    83,    84,    85,    86,    87,     0,    18,
       19,    88,    20,     0,    21,    89,    90,     0,     0,     0,
        0,     0,     0,    79,     0,     0,     0,     0,     0,     0,
-      91,    92,    22,    11,    12,     0,    81,    13,     0,     0,
+      91,    92,    22,    11,    12,     0,    81,    13,     0,   264,
       23,    24,    25,    26,    27,    28,     0,     0,     0,    29,
-      30,    31,    93,    94,     0,    32,    33,     0,     0,     0,
-      34,     0,    35,    36,    37,     0,     0,    14,    15,    82,
+      93,    30,    31,    94,     0,    32,    33,     0,     0,    34,
+       0,     0,    35,    36,    37,     0,     0,    14,    15,    82,
       16,    83,    84,    85,    86,    87,     0,    18,    19,    88,
       20,     0,    21,    89,    90,     0,     0,     0,     0,     0,
-      79,     0,     0,     0,     0,     0,     0,     0,    91,    92,
-      22,    12,     0,   -31,    13,     0,     0,     0,    23,    24,
-      25,    26,    27,    28,     0,     0,     0,    29,    30,    31,
-      93,    94,     0,    32,    33,     0,     0,     0,    34,     0,
-      35,    36,    37,     0,    14,    15,     0,    16,     0,    84,
-       0,     0,     0,     0,    18,    19,     0,    20,     0,    21,
-       0,     0,     0,     0,     0,     0,     0,    79,     0,     0,
-       0,     0,     0,     0,     0,    91,    92,    22,    12,     0,
-       0,    13,   -31,     0,     0,    23,    24,    25,    26,    27,
-      28,     0,     0,     0,    29,    30,    31,     0,     9,    10,
-      32,    33,    11,    12,     0,    34,    13,    35,    36,    37,
-       0,    14,    15,     0,    16,     0,    84,     0,     0,     0,
-       0,    18,    19,     0,    20,     0,    21,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    14,    15,     0,    16,
-       0,     0,    91,    92,    22,    17,    18,    19,     0,    20,
-       0,    21,    23,    24,    25,    26,    27,    28,     0,     0,
-       0,    29,    30,    31,     0,     0,     0,    32,    33,    22,
-       0,     0,    34,     0,    35,    36,    37,    23,    24,    25,
-      26,    27,    28,     0,     0,     0,    29,    30,    31,     0,
-       0,   136,    32,    33,    57,   108,     0,    34,   137,    35,
-      36,    37,     0,     0,     0,   109,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   110,   111,     0,
-     112,   113,   114,   115,   116,   117,   118,    14,    15,     0,
-      16,     0,     0,     0,     0,     0,     0,    18,    19,     0,
-      20,     0,    21,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      22,     0,     0,     0,     0,     0,     0,     0,    23,    24,
-      25,    26,    27,    28,     0,   119,     0,    29,    30,    31,
-       0,     0,   136,    32,    33,    57,   108,     0,    58,   315,
-      35,    36,    37,     0,     0,     0,   109,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   110,   111,
-       0,   112,   113,   114,   115,   116,   117,   118,    14,    15,
-       0,    16,     0,     0,     0,     0,     0,     0,    18,    19,
+       0,     0,     0,    79,     0,     0,     0,     0,    91,    92,
+      22,   288,     0,    11,    12,     0,    81,    13,    23,    24,
+      25,    26,    27,    28,     0,     0,     0,    29,    93,    30,
+      31,    94,     0,    32,    33,     0,     0,    34,     0,     0,
+      35,    36,    37,     0,     0,     0,     0,    14,    15,    82,
+      16,    83,    84,    85,    86,    87,     0,    18,    19,    88,
+      20,     0,    21,    89,    90,     0,     0,     0,     0,     0,
+       0,    79,     0,     0,     0,     0,     0,     0,    91,    92,
+      22,    11,    12,     0,    81,    13,     0,   343,    23,    24,
+      25,    26,    27,    28,     0,     0,     0,    29,    93,    30,
+      31,    94,     0,    32,    33,     0,     0,    34,     0,     0,
+      35,    36,    37,     0,     0,    14,    15,    82,    16,    83,
+      84,    85,    86,    87,     0,    18,    19,    88,    20,     0,
+      21,    89,    90,     0,     0,     0,     0,     0,     0,    79,
+       0,     0,     0,     0,     0,     0,    91,    92,    22,    11,
+      12,     0,    81,    13,     0,   356,    23,    24,    25,    26,
+      27,    28,     0,     0,     0,    29,    93,    30,    31,    94,
+       0,    32,    33,     0,     0,    34,     0,     0,    35,    36,
+      37,     0,     0,    14,    15,    82,    16,    83,    84,    85,
+      86,    87,     0,    18,    19,    88,    20,     0,    21,    89,
+      90,     0,     0,     0,     0,     0,     0,    79,     0,     0,
+       0,     0,     0,     0,    91,    92,    22,    11,    12,     0,
+      81,    13,     0,     0,    23,    24,    25,    26,    27,    28,
+       0,     0,     0,    29,    93,    30,    31,    94,     0,    32,
+      33,     0,     0,    34,     0,     0,    35,    36,    37,     0,
+       0,    14,    15,    82,    16,    83,    84,    85,    86,    87,
+       0,    18,    19,    88,    20,     0,    21,    89,    90,     0,
+       0,     0,     0,     0,    79,     0,     0,     0,     0,     0,
+       0,     0,    91,    92,    22,    12,     0,   -31,    13,     0,
+       0,     0,    23,    24,    25,    26,    27,    28,     0,     0,
+       0,    29,    93,    30,    31,    94,     0,    32,    33,     0,
+       0,    34,     0,     0,    35,    36,    37,     0,    14,    15,
+       0,    16,     0,    84,     0,     0,     0,     0,    18,    19,
+       0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
+       0,    79,     0,     0,     0,     0,     0,     0,     0,    91,
+      92,    22,    12,     0,     0,    13,   -31,     0,     0,    23,
+      24,    25,    26,    27,    28,     0,     0,     0,    29,     0,
+      30,    31,     9,    10,    32,    33,    11,    12,    34,     0,
+      13,    35,    36,    37,     0,    14,    15,     0,    16,     0,
+      84,     0,     0,     0,     0,    18,    19,     0,    20,     0,
+      21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      14,    15,     0,    16,     0,     0,    91,    92,    22,    17,
+      18,    19,     0,    20,     0,    21,    23,    24,    25,    26,
+      27,    28,     0,     0,     0,    29,     0,    30,    31,     0,
+       0,    32,    33,    22,     0,    34,     0,     0,    35,    36,
+      37,    23,    24,    25,    26,    27,    28,     0,     0,     0,
+      29,     0,    30,    31,     0,     0,    32,    33,     0,     0,
+      34,     0,     0,    35,    36,    37,   156,     0,     0,    57,
+     108,   159,     0,     0,     0,     0,     0,     0,     0,     0,
+     109,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   110,   111,     0,   112,   113,   114,   115,   116,
+     117,   118,    14,    15,     0,    16,     0,     0,     0,     0,
+       0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
+       0,     0,     0,     0,   156,     0,     0,    12,     0,   159,
+      13,     0,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
+     119,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+      14,    15,    58,    16,     0,    35,    36,    37,     0,     0,
+      18,    19,     0,    20,     0,    21,     0,     0,     0,     0,
+       0,     0,   202,     0,     0,    12,     0,     0,    13,     0,
+       0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
+       0,    23,    24,    25,    26,    27,    28,     0,     0,     0,
+      29,     0,    30,    31,     0,     0,    32,    33,    14,    15,
+      34,    16,     0,    35,    36,    37,     0,     0,    18,    19,
+       0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
+     204,     0,     0,    12,     0,     0,    13,     0,     0,     0,
+       0,    22,     0,     0,     0,     0,     0,     0,     0,    23,
+      24,    25,    26,    27,    28,     0,     0,     0,    29,     0,
+      30,    31,     0,     0,    32,    33,    14,    15,    34,    16,
+       0,    35,    36,    37,     0,     0,    18,    19,     0,    20,
+       0,    21,     0,     0,     0,     0,     0,     0,   219,     0,
+       0,    12,     0,     0,    13,     0,     0,     0,     0,    22,
+       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
+      26,    27,    28,     0,     0,     0,    29,     0,    30,    31,
+       0,     0,    32,    33,    14,    15,    34,    16,     0,    35,
+      36,    37,     0,     0,    18,    19,     0,    20,     0,    21,
+       0,     0,     0,     0,     0,     0,   202,     0,     0,   292,
+       0,     0,    13,     0,     0,     0,     0,    22,     0,     0,
+       0,     0,     0,     0,     0,    23,    24,    25,    26,    27,
+      28,     0,     0,     0,    29,     0,    30,    31,     0,     0,
+      32,    33,    14,    15,    34,    16,     0,    35,    36,    37,
+       0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
+       0,     0,     0,     0,   204,     0,     0,   292,     0,     0,
+      13,     0,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
+       0,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+      14,    15,    34,    16,     0,    35,    36,    37,     0,     0,
+      18,    19,     0,    20,     0,    21,     0,     0,     0,     0,
+       0,     0,   219,     0,     0,   292,     0,     0,    13,     0,
+       0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
+       0,    23,    24,    25,    26,    27,    28,     0,     0,     0,
+      29,     0,    30,    31,     0,     0,    32,    33,    14,    15,
+      34,    16,     0,    35,    36,    37,     0,     0,    18,    19,
        0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,    22,     0,     0,     0,     0,     0,     0,     0,    23,
-      24,    25,    26,    27,    28,     0,   119,     0,    29,    30,
-      31,     0,     0,   136,    32,    33,    57,   108,     0,    58,
-     328,    35,    36,    37,     0,     0,     0,   109,     0,     0,
+      24,    25,    26,    27,    28,     0,     0,     0,    29,     0,
+      30,    31,     0,     0,    32,    33,     0,     0,    34,     0,
+       0,    35,    36,    37,   136,     0,    57,   108,     0,     0,
+     137,     0,     0,     0,     0,     0,     0,   109,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,   110,
      111,     0,   112,   113,   114,   115,   116,   117,   118,    14,
       15,     0,    16,     0,     0,     0,     0,     0,     0,    18,
@@ -1126,8 +1324,9 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    22,     0,     0,     0,     0,     0,     0,     0,
       23,    24,    25,    26,    27,    28,     0,   119,     0,    29,
-      30,    31,     0,     0,   136,    32,    33,    57,   108,     0,
-      58,   330,    35,    36,    37,     0,     0,     0,   109,     0,
+       0,    30,    31,     0,     0,    32,    33,     0,     0,    58,
+       0,     0,    35,    36,    37,   136,     0,    57,   108,     0,
+       0,   317,     0,     0,     0,     0,     0,     0,   109,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
      110,   111,     0,   112,   113,   114,   115,   116,   117,   118,
       14,    15,     0,    16,     0,     0,     0,     0,     0,     0,
@@ -1135,8 +1334,9 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
        0,    23,    24,    25,    26,    27,    28,     0,   119,     0,
-      29,    30,    31,     0,     0,   136,    32,    33,    57,   108,
-       0,    58,     0,    35,    36,    37,     0,     0,     0,   109,
+      29,     0,    30,    31,     0,     0,    32,    33,     0,     0,
+      58,     0,     0,    35,    36,    37,   136,     0,    57,   108,
+       0,     0,   328,     0,     0,     0,     0,     0,     0,   109,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,   110,   111,     0,   112,   113,   114,   115,   116,   117,
      118,    14,    15,     0,    16,     0,     0,     0,     0,     0,
@@ -1144,68 +1344,27 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    22,     0,     0,     0,     0,     0,
        0,     0,    23,    24,    25,    26,    27,    28,     0,   119,
-       0,    29,    30,    31,     0,     0,     0,    32,    33,     0,
-       0,     0,    58,     0,    35,    36,    37,   156,     0,    57,
-     108,   159,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    29,     0,    30,    31,     0,     0,    32,    33,     0,
+       0,    58,     0,     0,    35,    36,    37,   136,     0,    57,
+     108,     0,     0,   330,     0,     0,     0,     0,     0,     0,
      109,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,   110,   111,     0,   112,   113,   114,   115,   116,
      117,   118,    14,    15,     0,    16,     0,     0,     0,     0,
        0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
-       0,     0,     0,     0,     0,     0,   156,     0,    12,     0,
-     159,    13,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    22,     0,     0,     0,     0,
        0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
-     119,     0,    29,    30,    31,     0,     0,     0,    32,    33,
-       0,    14,    15,    58,    16,    35,    36,    37,     0,     0,
-       0,    18,    19,     0,    20,     0,    21,     0,     0,     0,
-       0,     0,     0,     0,     0,   202,     0,    12,     0,     0,
-      13,     0,     0,     0,    22,     0,     0,     0,     0,     0,
-       0,     0,    23,    24,    25,    26,    27,    28,     0,     0,
-       0,    29,    30,    31,     0,     0,     0,    32,    33,     0,
-      14,    15,    34,    16,    35,    36,    37,     0,     0,     0,
-      18,    19,     0,    20,     0,    21,     0,     0,     0,     0,
-       0,     0,     0,     0,   204,     0,    12,     0,     0,    13,
-       0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
-       0,    23,    24,    25,    26,    27,    28,     0,     0,     0,
-      29,    30,    31,     0,     0,     0,    32,    33,     0,    14,
-      15,    34,    16,    35,    36,    37,     0,     0,     0,    18,
-      19,     0,    20,     0,    21,     0,     0,     0,     0,     0,
-       0,     0,     0,   219,     0,    12,     0,     0,    13,     0,
-       0,     0,    22,     0,     0,     0,     0,     0,     0,     0,
-      23,    24,    25,    26,    27,    28,     0,     0,     0,    29,
-      30,    31,     0,     0,     0,    32,    33,     0,    14,    15,
-      34,    16,    35,    36,    37,     0,     0,     0,    18,    19,
-       0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
-       0,     0,   202,     0,   292,     0,     0,    13,     0,     0,
-       0,    22,     0,     0,     0,     0,     0,     0,     0,    23,
-      24,    25,    26,    27,    28,     0,     0,     0,    29,    30,
-      31,     0,     0,     0,    32,    33,     0,    14,    15,    34,
-      16,    35,    36,    37,     0,     0,     0,    18,    19,     0,
-      20,     0,    21,     0,     0,     0,     0,     0,     0,     0,
-       0,   204,     0,   292,     0,     0,    13,     0,     0,     0,
-      22,     0,     0,     0,     0,     0,     0,     0,    23,    24,
-      25,    26,    27,    28,     0,     0,     0,    29,    30,    31,
-       0,     0,     0,    32,    33,     0,    14,    15,    34,    16,
-      35,    36,    37,     0,     0,     0,    18,    19,     0,    20,
-       0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
-     219,     0,   292,     0,     0,    13,     0,     0,     0,    22,
-       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,     0,     0,     0,    29,    30,    31,     0,
-       0,     0,    32,    33,     0,    14,    15,    34,    16,    35,
-      36,    37,     0,     0,     0,    18,    19,     0,    20,     0,
-      21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    22,     0,
-       0,     0,     0,     0,     0,     0,    23,    24,    25,    26,
-      27,    28,     0,     0,     0,    29,    30,    31,     0,     0,
-       0,    32,    33,    57,   108,     0,    34,   137,    35,    36,
-      37,     0,     0,     0,   109,     0,     0,     0,     0,     0,
+     119,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+       0,   136,    58,    57,   108,    35,    36,    37,     0,     0,
+       0,     0,     0,     0,   109,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,   110,   111,     0,   112,
      113,   114,   115,   116,   117,   118,    14,    15,     0,    16,
        0,     0,     0,     0,     0,     0,    18,    19,     0,    20,
        0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
        0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,     0,   119,     0,    29,    30,    31,     0,
-       0,     0,    32,    33,    57,   108,     0,    58,     0,    35,
+      26,    27,    28,     0,   119,     0,    29,     0,    30,    31,
+       0,     0,    32,    33,    57,   108,    58,     0,   137,    35,
       36,    37,     0,     0,     0,   109,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,   110,   111,     0,
      112,   113,   114,   115,   116,   117,   118,    14,    15,     0,
@@ -1213,8 +1372,8 @@ static const yytype_int16 yytable[] =
       20,     0,    21,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
       22,     0,     0,     0,     0,     0,     0,     0,    23,    24,
-      25,    26,    27,    28,     0,   119,   266,    29,    30,    31,
-       0,     0,     0,    32,    33,    57,   108,     0,    58,   273,
+      25,    26,    27,    28,     0,   119,     0,    29,     0,    30,
+      31,     0,     0,    32,    33,    57,   108,    58,     0,     0,
       35,    36,    37,     0,     0,     0,   109,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,   110,   111,
        0,   112,   113,   114,   115,   116,   117,   118,    14,    15,
@@ -1222,9 +1381,9 @@ static const yytype_int16 yytable[] =
        0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,    22,     0,     0,     0,     0,     0,     0,     0,    23,
-      24,    25,    26,    27,    28,     0,   119,     0,    29,    30,
-      31,     0,     0,     0,    32,    33,    57,   108,     0,    58,
-     311,    35,    36,    37,     0,     0,     0,   109,     0,     0,
+      24,    25,    26,    27,    28,     0,   119,   266,    29,     0,
+      30,    31,     0,     0,    32,    33,    57,   108,    58,     0,
+     273,    35,    36,    37,     0,     0,     0,   109,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,   110,
      111,     0,   112,   113,   114,   115,   116,   117,   118,    14,
       15,     0,    16,     0,     0,     0,     0,     0,     0,    18,
@@ -1232,8 +1391,8 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    22,     0,     0,     0,     0,     0,     0,     0,
       23,    24,    25,    26,    27,    28,     0,   119,     0,    29,
-      30,    31,     0,     0,     0,    32,    33,    57,   108,     0,
-      58,   313,    35,    36,    37,     0,     0,     0,   109,     0,
+       0,    30,    31,     0,     0,    32,    33,    57,   108,    58,
+       0,   311,    35,    36,    37,     0,     0,     0,   109,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
      110,   111,     0,   112,   113,   114,   115,   116,   117,   118,
       14,    15,     0,    16,     0,     0,     0,     0,     0,     0,
@@ -1241,8 +1400,8 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
        0,    23,    24,    25,    26,    27,    28,     0,   119,     0,
-      29,    30,    31,     0,     0,     0,    32,    33,    57,   108,
-       0,    58,   347,    35,    36,    37,     0,     0,     0,   109,
+      29,     0,    30,    31,     0,     0,    32,    33,    57,   108,
+      58,     0,   313,    35,    36,    37,     0,     0,     0,   109,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,   110,   111,     0,   112,   113,   114,   115,   116,   117,
      118,    14,    15,     0,    16,     0,     0,     0,     0,     0,
@@ -1250,8 +1409,27 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    22,     0,     0,     0,     0,     0,
        0,     0,    23,    24,    25,    26,    27,    28,     0,   119,
-       0,    29,    30,    31,     0,     0,     0,    32,    33,    57,
-     108,     0,    58,   348,    35,    36,    37,     0,     0,     0,
+       0,    29,     0,    30,    31,     0,     0,    32,    33,    57,
+     108,    58,     0,   347,    35,    36,    37,     0,     0,     0,
+     109,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   110,   111,     0,   112,   113,   114,   115,   116,
+     117,   118,    14,    15,     0,    16,     0,     0,     0,     0,
+       0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
+     119,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+      57,   108,    58,     0,   349,    35,    36,    37,     0,     0,
+       0,   109,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   110,   111,     0,   112,   113,   114,   115,
+     116,   117,   118,    14,    15,     0,    16,     0,     0,     0,
+       0,     0,     0,    18,    19,     0,    20,     0,    21,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    22,     0,     0,     0,
+       0,     0,     0,     0,    23,    24,    25,    26,    27,    28,
+       0,   119,     0,    29,     0,    30,    31,     0,     0,    32,
+      33,     0,     0,    58,     0,     0,    35,    36,    37,    57,
+     108,   351,     0,     0,     0,     0,     0,     0,     0,     0,
      109,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,   110,   111,     0,   112,   113,   114,   115,   116,
      117,   118,    14,    15,     0,    16,     0,     0,     0,     0,
@@ -1259,8 +1437,8 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,    22,     0,     0,     0,     0,
        0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
-     119,     0,    29,    30,    31,     0,     0,     0,    32,    33,
-      57,   108,   351,    58,     0,    35,    36,    37,     0,     0,
+     119,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+      57,   108,    58,     0,   360,    35,    36,    37,     0,     0,
        0,   109,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,   110,   111,     0,   112,   113,   114,   115,
      116,   117,   118,    14,    15,     0,    16,     0,     0,     0,
@@ -1268,8 +1446,8 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    22,     0,     0,     0,
        0,     0,     0,     0,    23,    24,    25,    26,    27,    28,
-       0,   119,     0,    29,    30,    31,     0,     0,     0,    32,
-      33,    57,   108,     0,    58,   360,    35,    36,    37,     0,
+       0,   119,     0,    29,     0,    30,    31,     0,     0,    32,
+      33,    57,   108,    58,     0,     0,    35,    36,    37,     0,
        0,     0,   109,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,   110,   111,     0,   112,   113,   114,
      115,   116,   117,   118,    14,    15,     0,    16,     0,     0,
@@ -1277,315 +1455,338 @@ static const yytype_int16 yytable[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,    22,     0,     0,
        0,     0,     0,     0,     0,    23,    24,    25,    26,    27,
-      28,     0,   119,     0,    29,    30,    31,     0,     0,     0,
-      32,    33,    57,   108,     0,    58,     0,    35,    36,    37,
+      28,     0,   119,     0,    29,     0,    30,    31,     0,     0,
+      32,    33,    57,   108,    58,     0,     0,    35,    36,    37,
        0,     0,     0,   109,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   110,   111,     0,   112,   113,
+       0,     0,     0,     0,     0,   110,     0,     0,   112,   113,
      114,   115,   116,   117,   118,    14,    15,     0,    16,     0,
        0,     0,     0,     0,     0,    18,    19,     0,    20,     0,
       21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    22,     0,
        0,     0,     0,     0,     0,     0,    23,    24,    25,    26,
-      27,    28,     0,   119,     0,    29,    30,    31,     0,     0,
-       0,    32,    33,    57,   108,     0,    58,     0,    35,    36,
-      37,     0,     0,     0,   109,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   110,     0,     0,   112,
-     113,   114,   115,   116,   117,   118,    14,    15,     0,    16,
+      27,    28,    57,   108,     0,    29,     0,    30,    31,     0,
+       0,    32,    33,   109,     0,    58,     0,     0,    35,    36,
+      37,     0,     0,     0,     0,     0,     0,     0,   112,   113,
+     114,   115,   116,   117,   118,    14,    15,     0,    16,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,    20,     0,
+      21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    22,     0,
+       0,     0,     0,     0,     0,     0,    23,    24,    25,    26,
+      27,    28,    57,   -32,     0,    29,     0,    30,    31,     0,
+       0,    32,    33,   -32,     0,    58,     0,     0,    35,    36,
+      37,     0,     0,     0,     0,     0,     0,     0,   -32,   -32,
+     -32,   -32,   -32,   -32,   -32,    14,    15,     0,    16,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,    20,     0,
+      21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    22,     0,
+       0,     0,     0,    57,     0,     0,    23,    24,    25,    26,
+      27,    28,     0,     0,   251,     0,     0,    30,    31,     0,
+       0,    32,    33,     0,     0,    58,   110,   111,    35,    36,
+      37,     0,     0,     0,     0,   252,    14,    15,     0,    16,
        0,     0,     0,     0,     0,     0,    18,    19,     0,    20,
        0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
        0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,    57,   108,     0,    29,    30,    31,     0,
-       0,     0,    32,    33,   109,     0,     0,    58,     0,    35,
-      36,    37,     0,     0,     0,     0,     0,     0,     0,   112,
-     113,   114,   115,   116,   117,   118,    14,    15,     0,    16,
+      26,    27,    28,    57,   253,   326,    29,     0,    30,    31,
+       0,     0,    32,    33,   251,     0,    58,     0,     0,    35,
+      36,    37,     0,     0,     0,     0,   110,   111,     0,     0,
+       0,     0,     0,     0,     0,   252,    14,    15,     0,    16,
        0,     0,     0,     0,     0,     0,    18,    19,     0,    20,
        0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
-       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,    57,   -32,     0,    29,    30,    31,     0,
-       0,     0,    32,    33,   -32,     0,     0,    58,     0,    35,
-      36,    37,     0,     0,     0,     0,     0,     0,     0,   -32,
-     -32,   -32,   -32,   -32,   -32,   -32,    14,    15,     0,    16,
-       0,     0,     0,     0,     0,     0,    18,    19,     0,    20,
-       0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    57,     0,     0,     0,     0,     0,     0,    22,
-       0,     0,     0,   251,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,     0,     0,   110,   111,    30,    31,     0,
-       0,     0,    32,    33,   252,    14,    15,    58,    16,    35,
-      36,    37,     0,     0,     0,    18,    19,     0,    20,     0,
+       0,     0,    57,     0,     0,     0,     0,    23,    24,    25,
+      26,    27,    28,   251,   253,     0,    29,     0,    30,    31,
+       0,     0,    32,    33,     0,   110,    58,     0,     0,    35,
+      36,    37,     0,     0,   252,    14,    15,     0,    16,     0,
+       0,     0,     0,     0,     0,    18,    19,     0,    20,     0,
       21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    22,     0,
-       0,    57,     0,     0,     0,     0,    23,    24,    25,    26,
-      27,    28,   251,   253,   326,    29,    30,    31,     0,     0,
-       0,    32,    33,     0,   110,   111,    58,     0,    35,    36,
-      37,     0,     0,   252,    14,    15,     0,    16,     0,     0,
-       0,     0,     0,     0,    18,    19,     0,    20,     0,    21,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      57,     0,     0,     0,     0,     0,     0,    22,     0,     0,
-       0,   251,     0,     0,     0,    23,    24,    25,    26,    27,
-      28,     0,   253,   110,    29,    30,    31,     0,     0,     0,
-      32,    33,   252,    14,    15,    58,    16,    35,    36,    37,
-       0,     0,     0,    18,    19,     0,    20,     0,    21,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    12,
-       0,     0,    13,   142,     0,     0,    22,     0,     0,     0,
-       0,     0,     0,     0,    23,    24,    25,    26,    27,    28,
-       0,     0,     0,    29,    30,    31,     0,     0,     0,    32,
-      33,     0,    14,    15,    58,    16,    35,    36,    37,     0,
-       0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
+      12,     0,     0,    13,   142,     0,     0,     0,    22,     0,
+       0,     0,     0,     0,     0,     0,    23,    24,    25,    26,
+      27,    28,     0,     0,     0,    29,     0,    30,    31,     0,
+       0,    32,    33,    14,    15,    58,    16,     0,    35,    36,
+      37,     0,     0,    18,    19,     0,    20,     0,    21,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    12,     0,
-       0,    13,   150,     0,     0,    22,     0,     0,     0,     0,
-       0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
-       0,     0,    29,    30,    31,     0,     0,     0,    32,    33,
-       0,    14,    15,    34,    16,    35,    36,    37,     0,     0,
+       0,    13,   150,     0,     0,     0,    22,     0,     0,     0,
+       0,     0,     0,     0,    23,    24,    25,    26,    27,    28,
+       0,     0,     0,    29,     0,    30,    31,     0,     0,    32,
+      33,    14,    15,    34,    16,     0,    35,    36,    37,     0,
        0,    18,    19,     0,    20,     0,    21,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    57,     0,     0,
-       0,     0,     0,     0,    22,     0,     0,     0,   251,     0,
-       0,     0,    23,    24,    25,    26,    27,    28,     0,     0,
-       0,    29,    30,    31,     0,     0,     0,    32,    33,   252,
-      14,    15,    34,    16,    35,    36,    37,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    22,     0,     0,    57,     0,     0,
+       0,     0,    23,    24,    25,    26,    27,    28,   251,     0,
+       0,    29,     0,    30,    31,     0,     0,    32,    33,     0,
+       0,    34,     0,     0,    35,    36,    37,     0,     0,   252,
+      14,    15,     0,    16,     0,     0,     0,     0,     0,     0,
       18,    19,     0,    20,     0,    21,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    12,     0,     0,    13,
+       0,     0,     0,     0,     0,    12,     0,     0,    13,     0,
        0,     0,     0,    22,     0,     0,     0,     0,     0,     0,
        0,    23,    24,    25,    26,    27,    28,     0,     0,     0,
-      29,    30,    31,     0,     0,     0,    32,    33,     0,    14,
-      15,    58,    16,    35,    36,    37,     0,     0,     0,    18,
-      19,     0,    20,     0,    21,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    57,     0,     0,    13,     0,
-       0,     0,    22,     0,     0,     0,     0,     0,     0,     0,
-      23,    24,    25,    26,    27,    28,     0,     0,     0,    29,
-      30,    31,     0,     0,     0,    32,    33,     0,    14,    15,
-      34,    16,    35,    36,    37,     0,     0,     0,    18,    19,
+      29,     0,    30,    31,     0,     0,    32,    33,    14,    15,
+      58,    16,     0,    35,    36,    37,     0,     0,    18,    19,
        0,    20,     0,    21,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   177,     0,     0,    13,     0,     0,
+       0,     0,     0,    57,     0,     0,    13,     0,     0,     0,
        0,    22,     0,     0,     0,     0,     0,     0,     0,    23,
-      24,    25,    26,    27,    28,     0,     0,     0,    29,    30,
-      31,     0,     0,     0,    32,    33,     0,    14,    15,    34,
-      16,    35,    36,    37,     0,     0,     0,    18,    19,     0,
-      20,     0,    21,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    57,     0,     0,     0,     0,     0,     0,
-      22,     0,     0,     0,     0,     0,     0,     0,    23,    24,
-      25,    26,    27,    28,     0,     0,     0,    29,    30,    31,
-       0,     0,     0,    32,    33,     0,    14,    15,    34,    16,
-      35,    36,    37,     0,     0,     0,    18,    19,     0,    20,
+      24,    25,    26,    27,    28,     0,     0,     0,    29,     0,
+      30,    31,     0,     0,    32,    33,    14,    15,    34,    16,
+       0,    35,    36,    37,     0,     0,    18,    19,     0,    20,
        0,    21,     0,     0,     0,     0,     0,     0,     0,     0,
-     208,     0,   292,     0,     0,    13,     0,     0,     0,    22,
+       0,   177,     0,     0,    13,     0,     0,     0,     0,    22,
        0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
-      26,    27,    28,     0,     0,     0,    29,    30,    31,     0,
-       0,     0,    32,    33,     0,    14,    15,    58,    16,    35,
-      36,    37,     0,     0,     0,    18,    19,     0,    20,     0,
-      21,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    57,     0,     0,     0,     0,     0,     0,    22,     0,
-       0,     0,   -32,     0,     0,     0,    23,    24,    25,    26,
-      27,    28,     0,     0,     0,    29,    30,    31,     0,     0,
-       0,    32,    33,   -32,    14,    15,    34,    16,    35,    36,
-      37,     0,     0,     0,    18,    19,     0,    20,     0,    21,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      57,     0,     0,     0,     0,     0,     0,    22,     0,     0,
+      26,    27,    28,     0,     0,     0,    29,     0,    30,    31,
+       0,     0,    32,    33,    14,    15,    34,    16,     0,    35,
+      36,    37,     0,     0,    18,    19,     0,    20,     0,    21,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    57,
+       0,     0,     0,     0,     0,     0,     0,    22,     0,     0,
        0,     0,     0,     0,     0,    23,    24,    25,    26,    27,
-      28,     0,     0,     0,     0,    30,    31,     0,     0,     0,
-      32,    33,     0,    14,    15,    58,    16,    35,    36,    37,
-       0,     0,     0,    18,    19,     0,    20,     0,    21,     0,
+      28,     0,     0,     0,    29,     0,    30,    31,     0,     0,
+      32,    33,    14,    15,    34,    16,     0,    35,    36,    37,
+       0,     0,    18,    19,     0,    20,     0,    21,     0,     0,
+       0,     0,     0,     0,     0,     0,   208,   292,     0,     0,
+      13,     0,     0,     0,     0,    22,     0,     0,     0,     0,
+       0,     0,     0,    23,    24,    25,    26,    27,    28,     0,
+       0,     0,    29,     0,    30,    31,     0,     0,    32,    33,
+      14,    15,    58,    16,     0,    35,    36,    37,     0,     0,
+      18,    19,     0,    20,     0,    21,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    22,     0,     0,     0,
-       0,     0,     0,     0,    23,    24,    25,    26,    27,    28,
-       0,     0,     0,    29,    30,    31,     0,     0,     0,    32,
-      33,     0,     0,     0,    58,     0,    35,    36,    37
+       0,     0,     0,    22,     0,     0,    57,     0,     0,     0,
+       0,    23,    24,    25,    26,    27,    28,   -32,     0,     0,
+      29,     0,    30,    31,     0,     0,    32,    33,     0,     0,
+      34,    57,     0,    35,    36,    37,     0,     0,   -32,    14,
+      15,     0,    16,     0,     0,     0,     0,     0,     0,    18,
+      19,     0,    20,     0,    21,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    14,    15,     0,    16,     0,     0,
+       0,     0,    22,     0,    18,    19,     0,    20,     0,    21,
+      23,    24,    25,    26,    27,    28,     0,     0,     0,     0,
+       0,    30,    31,     0,     0,    32,    33,    22,     0,    58,
+       0,     0,    35,    36,    37,    23,    24,    25,    26,    27,
+      28,     0,     0,     0,    29,     0,    30,    31,     0,     0,
+      32,    33,     0,     0,    58,     0,     0,    35,    36,    37
 };
 
 static const yytype_int16 yycheck[] =
 {
-      16,     5,    34,   166,   177,     9,    10,    15,    81,    84,
-     242,    10,   244,    29,    51,    52,    32,    33,    34,    35,
-      36,    37,    66,    67,   109,   105,    42,    69,    15,    10,
-       0,    13,   105,     9,     9,    39,     9,    53,   123,    18,
-      16,    12,    58,   118,    19,    10,    19,     9,   336,   178,
-     108,   109,    68,    83,    16,    37,    86,    45,    40,    89,
-      90,    98,    69,    93,    45,    44,   108,   109,   100,   106,
-     358,   101,   251,    10,   253,   254,   255,    14,   257,   159,
-      45,     9,   261,    99,   100,     9,   159,    86,    16,   133,
-     322,   166,    16,   101,   102,   103,   104,     9,    86,   107,
-      88,   108,   109,   107,    16,    86,    11,    88,   124,   125,
-     126,   127,   128,   129,    12,    12,   103,   104,   350,   292,
-     107,    86,    87,    88,     9,    12,    11,    18,   144,   145,
-     362,   147,   148,   178,   164,     9,    12,   153,   154,   155,
-     170,    12,    16,   228,   229,   110,   221,   326,   164,     9,
-       9,    12,    42,    92,   170,    45,    16,    16,    12,   234,
-      86,    10,   178,    89,   293,    14,   251,   296,   297,   298,
-     299,    12,    42,   336,   303,   191,   192,   252,   194,   195,
-     196,   197,   198,   199,    10,   201,   107,   203,    14,   205,
-     206,    10,   208,   237,    10,   358,    86,    87,    88,   215,
-      12,    10,    12,   283,   220,    14,   222,    12,    44,   284,
-     283,    95,    15,   342,    86,    10,    18,    79,     9,   251,
-     110,   253,   254,   255,    14,   257,   242,    45,   244,   261,
-      53,    54,    10,   318,    10,   251,    16,   253,   254,   255,
-     320,   257,   258,   259,   260,   261,    16,   320,   293,   324,
-      44,   296,   297,   298,   299,    99,   272,    16,   303,   263,
-     276,    12,   278,    16,   280,   188,    16,   304,    86,    87,
-      88,   351,    16,    41,   107,    -1,    -1,   293,   351,    -1,
-     296,   297,   298,   299,    -1,    -1,    16,   303,    -1,   305,
-     306,   307,   110,    -1,   326,   332,    -1,   342,    -1,    -1,
-      -1,    -1,    32,    33,    34,    -1,   310,    37,    -1,    -1,
-     326,    -1,    42,   329,    -1,   331,    -1,   333,   334,    -1,
-      -1,   337,    -1,    53,   147,   148,   342,    -1,    58,    -1,
-     360,   154,   155,    -1,    -1,    -1,    -1,   353,    68,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    99,
-     100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   206,   207,    -1,    -1,    -1,    -1,    -1,
+      16,     5,    34,   166,    15,     9,    10,   177,    81,    15,
+       9,    51,    52,    29,    45,   105,    32,    33,    34,    35,
+      36,    37,     9,    13,   109,    69,    42,    66,    67,   336,
+      86,    10,   105,    89,    10,    39,    18,    53,   123,   242,
+      19,   244,    58,    19,    10,    11,    45,    37,    10,   178,
+      40,   358,    68,    83,    16,    86,    86,    88,    98,    89,
+      90,    11,    44,    93,   108,   109,   106,    69,   100,   159,
+     251,   101,   253,   254,   255,    10,   257,     0,    12,    10,
+     261,    16,   178,    99,   100,    16,   159,    86,    12,    88,
+     101,   102,   103,   104,   133,     9,   107,   103,   104,    86,
+      14,   107,    12,   107,    12,    12,   108,   109,   124,   125,
+     126,   127,   128,   129,    53,    54,    12,    10,    10,   322,
+      10,    10,   292,    16,    16,    12,    16,    16,   144,   145,
+      10,   147,   148,    12,   164,    18,    16,   153,   154,   155,
+     170,     9,    12,   228,   229,   326,    14,   350,   164,    92,
+       9,     9,   108,   109,   170,    14,    14,    42,   107,   362,
+       9,    12,   178,     9,   293,    12,   251,   296,   297,   298,
+     299,    84,    12,   336,   303,   191,   192,    95,   194,   195,
+     196,   197,   198,   199,    44,   201,    15,   203,    86,   205,
+     206,     9,   208,   283,    18,   358,     9,   293,   237,   215,
+     296,   297,   298,   299,   220,   118,   222,   303,   147,   148,
+     283,    10,    79,   342,    14,   154,   155,     9,     9,   251,
+      16,   253,   254,   255,    99,   257,   242,    16,   244,   261,
+     320,   316,    45,    44,    16,   251,    12,   253,   254,   255,
+     179,   257,   258,   259,   260,   261,   342,   320,    16,    16,
+      16,    41,   188,   166,    42,   107,   272,    45,    -1,   263,
+     276,   351,   278,    -1,   304,   281,    -1,   206,   207,    -1,
+      -1,    -1,    -1,    86,    87,    88,    -1,   293,   351,    -1,
+     296,   297,   298,   299,    -1,    -1,    16,   303,   227,   305,
+     306,   307,   332,    45,   326,    -1,    -1,   110,    86,    87,
+      88,    -1,    32,    33,    34,    -1,   310,    37,   221,    -1,
+     326,   250,    42,   329,    -1,   331,    -1,   333,    -1,   335,
+     233,   337,   110,    53,    -1,    -1,   342,    -1,    58,    -1,
+     360,    -1,    -1,    -1,    86,    87,    88,   353,    68,   252,
+      -1,   280,   281,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   306,   307,    99,
+     100,   284,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   325,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,   124,   125,   126,   127,   128,   129,
-      -1,    -1,    -1,    -1,   227,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   144,   145,    -1,   147,   148,    -1,
-      -1,    -1,    -1,   153,   154,   155,    -1,   250,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
+      -1,   324,    -1,   103,   144,   145,    -1,   147,   148,    -1,
+      -1,    -1,    -1,   153,   154,   155,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,   164,    -1,    -1,    -1,    -1,    -1,
-     170,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   178,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   280,   281,    -1,
+     170,    -1,    -1,    -1,   134,   135,    -1,    -1,   178,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,   192,    -1,   194,   195,   196,   197,   198,   199,
       -1,   201,    -1,   203,    -1,   205,   206,    -1,   208,    -1,
-      97,    -1,    -1,   306,   307,   215,   103,    -1,    -1,    -1,
-     220,    -1,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   325,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   242,    -1,   244,    -1,    -1,   134,   135,    -1,
+      -1,    -1,    -1,    -1,   174,   215,   176,    -1,    -1,    -1,
+     220,    -1,   222,    -1,    -1,    -1,    -1,   187,    -1,   189,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   242,    -1,   244,    -1,    -1,    -1,    -1,    -1,
       -1,   251,    -1,   253,   254,   255,    -1,   257,   258,   259,
      260,   261,     5,    -1,    -1,    -1,    -1,    -1,    -1,    12,
       -1,    -1,   272,    -1,    -1,    -1,   276,    -1,   278,    -1,
-     280,    -1,    -1,    -1,    -1,    -1,    -1,   174,    -1,   176,
+      -1,   281,    -1,    -1,    -1,    -1,    -1,   247,    -1,    -1,
       -1,    -1,    -1,   293,    -1,    -1,   296,   297,   298,   299,
-     187,    -1,   189,   303,    -1,   305,   306,   307,    -1,    -1,
+      -1,    -1,    -1,   303,    -1,   305,   306,   307,    -1,    -1,
       -1,    -1,    -1,    56,    57,    -1,    -1,    -1,    -1,    -1,
       -1,    64,    65,    66,    67,    -1,   326,    70,    71,    -1,
-      -1,    -1,    -1,   333,   334,    -1,    -1,   337,    -1,    -1,
+      -1,    -1,    -1,   333,    -1,   335,    -1,   337,    -1,    -1,
       -1,    -1,   342,    86,    -1,    -1,    -1,    -1,    -1,    -1,
       93,    -1,    -1,   353,    -1,    -1,    -1,    -1,    -1,    -1,
-     247,    -1,    -1,    -1,   107,    -1,   109,    -1,    -1,   112,
+      -1,    -1,    -1,    -1,   107,    -1,   109,   327,    -1,   112,
      113,   114,   115,   116,   117,    -1,   119,   120,   121,    -1,
-     123,    -1,    -1,    -1,    -1,    -1,    -1,   130,    -1,    -1,
-     133,    -1,    -1,    -1,    -1,   138,    -1,   140,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   167,    -1,    -1,    -1,    -1,   172,
+     123,    -1,    -1,    -1,    -1,    -1,   346,   130,    -1,    -1,
+     133,    -1,   352,    -1,    -1,   138,    -1,   140,    -1,    -1,
+      -1,   361,    -1,    -1,    -1,    -1,   366,    -1,    -1,    -1,
+      -1,     0,     1,    -1,    -1,    -1,    -1,    -1,     7,     8,
+       9,    -1,    11,    12,   167,    14,    15,    -1,    -1,   172,
       -1,    -1,    -1,    -1,   177,    -1,    -1,    -1,    -1,    -1,
-     327,    -1,    -1,    -1,    -1,   188,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,     0,     1,    -1,   346,
-      -1,    -1,    -1,     7,     8,   352,    10,    11,    12,    -1,
-      14,    15,    -1,    -1,   361,    -1,    -1,    -1,    -1,   366,
-      -1,    -1,   225,    -1,    -1,   228,   229,    -1,    -1,    -1,
-     233,    -1,    -1,    -1,   237,    -1,    -1,    -1,    -1,    -1,
-      -1,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,
-      54,    55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,
-      -1,    -1,    -1,   266,   267,   268,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    86,    87,    88,    89,    90,    91,    -1,   292,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,    -1,    -1,    -1,
-       1,    -1,    -1,   316,    -1,   318,    -1,    -1,   321,    10,
-      11,    12,    -1,    14,    15,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   339,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   188,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    -1,    48,
+      -1,    -1,    -1,    -1,    -1,    54,    55,    56,    -1,    58,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   225,    -1,    -1,   228,   229,    -1,    -1,    78,
+      -1,   234,    -1,    -1,   237,    -1,    -1,    86,    87,    88,
+      89,    90,    91,    -1,    -1,    -1,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    -1,    -1,   105,    -1,    -1,   108,
+     109,   110,    -1,   266,   267,   268,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    -1,    55,    56,    57,    58,    -1,    60,
-      61,    62,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,
-      -1,    -1,    -1,    -1,    -1,    76,    77,    78,    11,    12,
-      -1,    14,    15,    -1,    17,    86,    87,    88,    89,    90,
-      91,    -1,    -1,    -1,    95,    96,    97,    98,    99,    -1,
-     101,   102,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-      -1,    -1,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    -1,    55,    56,    57,    58,    -1,    60,    61,    62,
-      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,
-      -1,    -1,    -1,    76,    77,    78,    11,    12,    -1,    14,
-      15,    -1,    17,    86,    87,    88,    89,    90,    91,    -1,
-      -1,    -1,    95,    96,    97,    98,    99,    -1,   101,   102,
-      -1,    -1,    -1,   106,    -1,   108,   109,   110,    -1,    -1,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    -1,
-      55,    56,    57,    58,    -1,    60,    61,    62,    -1,    -1,
-      -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,
-      -1,    76,    77,    78,    11,    12,    -1,    14,    15,    -1,
-      17,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
-      95,    96,    97,    98,    99,    -1,   101,   102,    -1,    -1,
-      -1,   106,    -1,   108,   109,   110,    -1,    -1,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    -1,    55,    56,
-      57,    58,    -1,    60,    61,    62,    -1,    -1,    -1,    -1,
-      -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,    76,
-      77,    78,    11,    12,    -1,    14,    15,    -1,    17,    86,
-      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    96,
-      97,    98,    99,    -1,   101,   102,    -1,    -1,    -1,   106,
-      -1,   108,   109,   110,    -1,    -1,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    -1,    55,    56,    57,    58,
-      -1,    60,    61,    62,    -1,    -1,    -1,    -1,    -1,    -1,
-       1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,
-      11,    12,    -1,    14,    15,    -1,    17,    86,    87,    88,
-      89,    90,    91,    -1,    -1,    -1,    95,    96,    97,    98,
-      99,    -1,   101,   102,    -1,    -1,    -1,   106,    -1,   108,
-     109,   110,    -1,    -1,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    -1,    55,    56,    57,    58,    -1,    60,
-      61,    62,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,
-      -1,    -1,    -1,    -1,    -1,    76,    77,    78,    10,    11,
-      12,    -1,    14,    15,    -1,    86,    87,    88,    89,    90,
-      91,    -1,    -1,    -1,    95,    96,    97,    98,    99,    -1,
-     101,   102,    -1,    -1,    -1,   106,    -1,   108,   109,   110,
-      -1,    -1,    -1,    45,    46,    47,    48,    49,    50,    51,
+      -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,   292,
+      -1,     9,    -1,    11,    12,    -1,    14,    15,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   316,    -1,   318,    -1,    -1,   321,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,   339,    55,    56,    57,
+      58,    -1,    60,    61,    62,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,
+      78,    11,    12,    -1,    14,    15,    -1,    17,    86,    87,
+      88,    89,    90,    91,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,    -1,   101,   102,    -1,    -1,   105,    -1,    -1,
+     108,   109,   110,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    -1,    55,    56,    57,    58,    -1,
+      60,    61,    62,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,    11,
+      12,    -1,    14,    15,    -1,    17,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+      -1,   101,   102,    -1,    -1,   105,    -1,    -1,   108,   109,
+     110,    -1,    -1,    45,    46,    47,    48,    49,    50,    51,
       52,    53,    -1,    55,    56,    57,    58,    -1,    60,    61,
       62,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,
       -1,    -1,    -1,    -1,    76,    77,    78,    11,    12,    -1,
       14,    15,    -1,    17,    86,    87,    88,    89,    90,    91,
       -1,    -1,    -1,    95,    96,    97,    98,    99,    -1,   101,
-     102,    -1,    -1,    -1,   106,    -1,   108,   109,   110,    -1,
+     102,    -1,    -1,   105,    -1,    -1,   108,   109,   110,    -1,
       -1,    45,    46,    47,    48,    49,    50,    51,    52,    53,
       -1,    55,    56,    57,    58,    -1,    60,    61,    62,    -1,
       -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,
       -1,    -1,    76,    77,    78,    11,    12,    -1,    14,    15,
       -1,    17,    86,    87,    88,    89,    90,    91,    -1,    -1,
       -1,    95,    96,    97,    98,    99,    -1,   101,   102,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,    -1,    -1,    45,
+      -1,   105,    -1,    -1,   108,   109,   110,    -1,    -1,    45,
       46,    47,    48,    49,    50,    51,    52,    53,    -1,    55,
       56,    57,    58,    -1,    60,    61,    62,    -1,    -1,    -1,
       -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,
-      76,    77,    78,    11,    12,    -1,    14,    15,    -1,    -1,
+      76,    77,    78,    11,    12,    -1,    14,    15,    -1,    17,
       86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    95,
-      96,    97,    98,    99,    -1,   101,   102,    -1,    -1,    -1,
-     106,    -1,   108,   109,   110,    -1,    -1,    45,    46,    47,
+      96,    97,    98,    99,    -1,   101,   102,    -1,    -1,   105,
+      -1,    -1,   108,   109,   110,    -1,    -1,    45,    46,    47,
       48,    49,    50,    51,    52,    53,    -1,    55,    56,    57,
       58,    -1,    60,    61,    62,    -1,    -1,    -1,    -1,    -1,
-       1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,
-      78,    12,    -1,    14,    15,    -1,    -1,    -1,    86,    87,
+      -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,    76,    77,
+      78,     9,    -1,    11,    12,    -1,    14,    15,    86,    87,
       88,    89,    90,    91,    -1,    -1,    -1,    95,    96,    97,
-      98,    99,    -1,   101,   102,    -1,    -1,    -1,   106,    -1,
-     108,   109,   110,    -1,    45,    46,    -1,    48,    -1,    50,
-      -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    76,    77,    78,    12,    -1,
-      -1,    15,    16,    -1,    -1,    86,    87,    88,    89,    90,
-      91,    -1,    -1,    -1,    95,    96,    97,    -1,     7,     8,
-     101,   102,    11,    12,    -1,   106,    15,   108,   109,   110,
-      -1,    45,    46,    -1,    48,    -1,    50,    -1,    -1,    -1,
-      -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    -1,    48,
-      -1,    -1,    76,    77,    78,    54,    55,    56,    -1,    58,
-      -1,    60,    86,    87,    88,    89,    90,    91,    -1,    -1,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    78,
-      -1,    -1,   106,    -1,   108,   109,   110,    86,    87,    88,
-      89,    90,    91,    -1,    -1,    -1,    95,    96,    97,    -1,
-      -1,     9,   101,   102,    12,    13,    -1,   106,    16,   108,
-     109,   110,    -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    -1,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    -1,
-      48,    -1,    -1,    -1,    -1,    -1,    -1,    55,    56,    -1,
-      58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,
-      88,    89,    90,    91,    -1,    93,    -1,    95,    96,    97,
-      -1,    -1,     9,   101,   102,    12,    13,    -1,   106,    16,
-     108,   109,   110,    -1,    -1,    -1,    23,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,
-      -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,    55,    56,
+      98,    99,    -1,   101,   102,    -1,    -1,   105,    -1,    -1,
+     108,   109,   110,    -1,    -1,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    -1,    55,    56,    57,
+      58,    -1,    60,    61,    62,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,    76,    77,
+      78,    11,    12,    -1,    14,    15,    -1,    17,    86,    87,
+      88,    89,    90,    91,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,    -1,   101,   102,    -1,    -1,   105,    -1,    -1,
+     108,   109,   110,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    -1,    55,    56,    57,    58,    -1,
+      60,    61,    62,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    78,    11,
+      12,    -1,    14,    15,    -1,    17,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+      -1,   101,   102,    -1,    -1,   105,    -1,    -1,   108,   109,
+     110,    -1,    -1,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    -1,    55,    56,    57,    58,    -1,    60,    61,
+      62,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,
+      -1,    -1,    -1,    -1,    76,    77,    78,    11,    12,    -1,
+      14,    15,    -1,    -1,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,    -1,   101,
+     102,    -1,    -1,   105,    -1,    -1,   108,   109,   110,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      -1,    55,    56,    57,    58,    -1,    60,    61,    62,    -1,
+      -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    76,    77,    78,    12,    -1,    14,    15,    -1,
+      -1,    -1,    86,    87,    88,    89,    90,    91,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,    -1,   101,   102,    -1,
+      -1,   105,    -1,    -1,   108,   109,   110,    -1,    45,    46,
+      -1,    48,    -1,    50,    -1,    -1,    -1,    -1,    55,    56,
+      -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    76,
+      77,    78,    12,    -1,    -1,    15,    16,    -1,    -1,    86,
+      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    -1,
+      97,    98,     7,     8,   101,   102,    11,    12,   105,    -1,
+      15,   108,   109,   110,    -1,    45,    46,    -1,    48,    -1,
+      50,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    46,    -1,    48,    -1,    -1,    76,    77,    78,    54,
+      55,    56,    -1,    58,    -1,    60,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    95,    -1,    97,    98,    -1,
+      -1,   101,   102,    78,    -1,   105,    -1,    -1,   108,   109,
+     110,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    -1,    -1,
+     105,    -1,    -1,   108,   109,   110,     9,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    35,    36,    -1,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    -1,    -1,    12,    -1,    14,
+      15,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
+      93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      45,    46,   105,    48,    -1,   108,   109,   110,    -1,    -1,
+      55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,     9,    -1,    -1,    12,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    45,    46,
+     105,    48,    -1,   108,   109,   110,    -1,    -1,    55,    56,
+      -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
+       9,    -1,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
+      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    -1,
+      97,    98,    -1,    -1,   101,   102,    45,    46,   105,    48,
+      -1,   108,   109,   110,    -1,    -1,    55,    56,    -1,    58,
+      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,     9,    -1,
+      -1,    12,    -1,    -1,    15,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
+      89,    90,    91,    -1,    -1,    -1,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    45,    46,   105,    48,    -1,   108,
+     109,   110,    -1,    -1,    55,    56,    -1,    58,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,     9,    -1,    -1,    12,
+      -1,    -1,    15,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,
+      91,    -1,    -1,    -1,    95,    -1,    97,    98,    -1,    -1,
+     101,   102,    45,    46,   105,    48,    -1,   108,   109,   110,
+      -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,     9,    -1,    -1,    12,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
+      -1,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      45,    46,   105,    48,    -1,   108,   109,   110,    -1,    -1,
+      55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,
+      -1,    -1,     9,    -1,    -1,    12,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    45,    46,
+     105,    48,    -1,   108,   109,   110,    -1,    -1,    55,    56,
       -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
-      87,    88,    89,    90,    91,    -1,    93,    -1,    95,    96,
-      97,    -1,    -1,     9,   101,   102,    12,    13,    -1,   106,
-      16,   108,   109,   110,    -1,    -1,    -1,    23,    -1,    -1,
+      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    -1,
+      97,    98,    -1,    -1,   101,   102,    -1,    -1,   105,    -1,
+      -1,   108,   109,   110,    10,    -1,    12,    13,    -1,    -1,
+      16,    -1,    -1,    -1,    -1,    -1,    -1,    23,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,
       36,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
       46,    -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,    55,
@@ -1593,8 +1794,9 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       86,    87,    88,    89,    90,    91,    -1,    93,    -1,    95,
-      96,    97,    -1,    -1,     9,   101,   102,    12,    13,    -1,
-     106,    16,   108,   109,   110,    -1,    -1,    -1,    23,    -1,
+      -1,    97,    98,    -1,    -1,   101,   102,    -1,    -1,   105,
+      -1,    -1,   108,   109,   110,    10,    -1,    12,    13,    -1,
+      -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    23,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       35,    36,    -1,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,
@@ -1602,8 +1804,9 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    86,    87,    88,    89,    90,    91,    -1,    93,    -1,
-      95,    96,    97,    -1,    -1,     9,   101,   102,    12,    13,
-      -1,   106,    -1,   108,   109,   110,    -1,    -1,    -1,    23,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    -1,    -1,
+     105,    -1,    -1,   108,   109,   110,    10,    -1,    12,    13,
+      -1,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    23,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    35,    36,    -1,    38,    39,    40,    41,    42,    43,
       44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,
@@ -1611,68 +1814,27 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    86,    87,    88,    89,    90,    91,    -1,    93,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    -1,
-      -1,    -1,   106,    -1,   108,   109,   110,    10,    -1,    12,
-      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,    -1,
+      -1,   105,    -1,    -1,   108,   109,   110,    10,    -1,    12,
+      13,    -1,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,
       23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    35,    36,    -1,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,
       -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    10,    -1,    12,    -1,
-      14,    15,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
-      93,    -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,
-      -1,    45,    46,   106,    48,   108,   109,   110,    -1,    -1,
-      -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    10,    -1,    12,    -1,    -1,
-      15,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    86,    87,    88,    89,    90,    91,    -1,    -1,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    -1,
-      45,    46,   106,    48,   108,   109,   110,    -1,    -1,    -1,
-      55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    10,    -1,    12,    -1,    -1,    15,
-      -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
-      95,    96,    97,    -1,    -1,    -1,   101,   102,    -1,    45,
-      46,   106,    48,   108,   109,   110,    -1,    -1,    -1,    55,
-      56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    10,    -1,    12,    -1,    -1,    15,    -1,
-      -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    95,
-      96,    97,    -1,    -1,    -1,   101,   102,    -1,    45,    46,
-     106,    48,   108,   109,   110,    -1,    -1,    -1,    55,    56,
-      -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    10,    -1,    12,    -1,    -1,    15,    -1,    -1,
-      -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
-      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    96,
-      97,    -1,    -1,    -1,   101,   102,    -1,    45,    46,   106,
-      48,   108,   109,   110,    -1,    -1,    -1,    55,    56,    -1,
-      58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    10,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,
-      78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,
-      88,    89,    90,    91,    -1,    -1,    -1,    95,    96,    97,
-      -1,    -1,    -1,   101,   102,    -1,    45,    46,   106,    48,
-     108,   109,   110,    -1,    -1,    -1,    55,    56,    -1,    58,
-      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      10,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,    78,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    -1,    -1,    -1,    95,    96,    97,    -1,
-      -1,    -1,   101,   102,    -1,    45,    46,   106,    48,   108,
-     109,   110,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
-      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
-      90,    91,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,
-      -1,   101,   102,    12,    13,    -1,   106,    16,   108,   109,
-     110,    -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      -1,    10,   105,    12,    13,   108,   109,   110,    -1,    -1,
+      -1,    -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    -1,    38,
       39,    40,    41,    42,    43,    44,    45,    46,    -1,    48,
       -1,    -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,
       -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    -1,    93,    -1,    95,    96,    97,    -1,
-      -1,    -1,   101,   102,    12,    13,    -1,   106,    -1,   108,
+      89,    90,    91,    -1,    93,    -1,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    12,    13,   105,    -1,    16,   108,
      109,   110,    -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,    -1,
       38,    39,    40,    41,    42,    43,    44,    45,    46,    -1,
@@ -1680,8 +1842,8 @@ static const yytype_int16 yycheck[] =
       58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,
-      88,    89,    90,    91,    -1,    93,    94,    95,    96,    97,
-      -1,    -1,    -1,   101,   102,    12,    13,    -1,   106,    16,
+      88,    89,    90,    91,    -1,    93,    -1,    95,    -1,    97,
+      98,    -1,    -1,   101,   102,    12,    13,   105,    -1,    -1,
      108,   109,   110,    -1,    -1,    -1,    23,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,    36,
       -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
@@ -1689,8 +1851,8 @@ static const yytype_int16 yycheck[] =
       -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
-      87,    88,    89,    90,    91,    -1,    93,    -1,    95,    96,
-      97,    -1,    -1,    -1,   101,   102,    12,    13,    -1,   106,
+      87,    88,    89,    90,    91,    -1,    93,    94,    95,    -1,
+      97,    98,    -1,    -1,   101,   102,    12,    13,   105,    -1,
       16,   108,   109,   110,    -1,    -1,    -1,    23,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    35,
       36,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
@@ -1699,8 +1861,8 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       86,    87,    88,    89,    90,    91,    -1,    93,    -1,    95,
-      96,    97,    -1,    -1,    -1,   101,   102,    12,    13,    -1,
-     106,    16,   108,   109,   110,    -1,    -1,    -1,    23,    -1,
+      -1,    97,    98,    -1,    -1,   101,   102,    12,    13,   105,
+      -1,    16,   108,   109,   110,    -1,    -1,    -1,    23,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       35,    36,    -1,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,
@@ -1708,8 +1870,8 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    86,    87,    88,    89,    90,    91,    -1,    93,    -1,
-      95,    96,    97,    -1,    -1,    -1,   101,   102,    12,    13,
-      -1,   106,    16,   108,   109,   110,    -1,    -1,    -1,    23,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    12,    13,
+     105,    -1,    16,   108,   109,   110,    -1,    -1,    -1,    23,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    35,    36,    -1,    38,    39,    40,    41,    42,    43,
       44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,
@@ -1717,8 +1879,8 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    86,    87,    88,    89,    90,    91,    -1,    93,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    12,
-      13,    -1,   106,    16,   108,   109,   110,    -1,    -1,    -1,
+      -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,    12,
+      13,   105,    -1,    16,   108,   109,   110,    -1,    -1,    -1,
       23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    35,    36,    -1,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,
@@ -1726,8 +1888,8 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
-      93,    -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,
-      12,    13,    14,   106,    -1,   108,   109,   110,    -1,    -1,
+      93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      12,    13,   105,    -1,    16,   108,   109,   110,    -1,    -1,
       -1,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    35,    36,    -1,    38,    39,    40,    41,
       42,    43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,
@@ -1735,8 +1897,27 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
-      -1,    93,    -1,    95,    96,    97,    -1,    -1,    -1,   101,
-     102,    12,    13,    -1,   106,    16,   108,   109,   110,    -1,
+      -1,    93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,
+     102,    -1,    -1,   105,    -1,    -1,   108,   109,   110,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    35,    36,    -1,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
+      93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      12,    13,   105,    -1,    16,   108,   109,   110,    -1,    -1,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    35,    36,    -1,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,
+      -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
+      -1,    93,    -1,    95,    -1,    97,    98,    -1,    -1,   101,
+     102,    12,    13,   105,    -1,    -1,   108,   109,   110,    -1,
       -1,    -1,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    35,    36,    -1,    38,    39,    40,
       41,    42,    43,    44,    45,    46,    -1,    48,    -1,    -1,
@@ -1744,254 +1925,240 @@ static const yytype_int16 yycheck[] =
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,
-      91,    -1,    93,    -1,    95,    96,    97,    -1,    -1,    -1,
-     101,   102,    12,    13,    -1,   106,    -1,   108,   109,   110,
+      91,    -1,    93,    -1,    95,    -1,    97,    98,    -1,    -1,
+     101,   102,    12,    13,   105,    -1,    -1,   108,   109,   110,
       -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    35,    36,    -1,    38,    39,
+      -1,    -1,    -1,    -1,    -1,    35,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    -1,    48,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
+      90,    91,    12,    13,    -1,    95,    -1,    97,    98,    -1,
+      -1,   101,   102,    23,    -1,   105,    -1,    -1,   108,   109,
+     110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    -1,    48,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
+      90,    91,    12,    13,    -1,    95,    -1,    97,    98,    -1,
+      -1,   101,   102,    23,    -1,   105,    -1,    -1,   108,   109,
+     110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    39,
       40,    41,    42,    43,    44,    45,    46,    -1,    48,    -1,
       -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
       60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
-      90,    91,    -1,    93,    -1,    95,    96,    97,    -1,    -1,
-      -1,   101,   102,    12,    13,    -1,   106,    -1,   108,   109,
-     110,    -1,    -1,    -1,    23,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    35,    -1,    -1,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    -1,    48,
+      -1,    -1,    -1,    12,    -1,    -1,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    23,    -1,    -1,    97,    98,    -1,
+      -1,   101,   102,    -1,    -1,   105,    35,    36,   108,   109,
+     110,    -1,    -1,    -1,    -1,    44,    45,    46,    -1,    48,
       -1,    -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,
       -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    12,    13,    -1,    95,    96,    97,    -1,
-      -1,    -1,   101,   102,    23,    -1,    -1,   106,    -1,   108,
-     109,   110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    -1,    48,
+      89,    90,    91,    12,    93,    94,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    23,    -1,   105,    -1,    -1,   108,
+     109,   110,    -1,    -1,    -1,    -1,    35,    36,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    44,    45,    46,    -1,    48,
       -1,    -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,
       -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    12,    13,    -1,    95,    96,    97,    -1,
-      -1,    -1,   101,   102,    23,    -1,    -1,   106,    -1,   108,
-     109,   110,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    -1,    48,
-      -1,    -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,
-      -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    78,
-      -1,    -1,    -1,    23,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    -1,    -1,    35,    36,    96,    97,    -1,
-      -1,    -1,   101,   102,    44,    45,    46,   106,    48,   108,
-     109,   110,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
+      -1,    -1,    12,    -1,    -1,    -1,    -1,    86,    87,    88,
+      89,    90,    91,    23,    93,    -1,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    -1,    35,   105,    -1,    -1,   108,
+     109,   110,    -1,    -1,    44,    45,    46,    -1,    48,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
       60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
-      90,    91,    23,    93,    94,    95,    96,    97,    -1,    -1,
-      -1,   101,   102,    -1,    35,    36,   106,    -1,   108,   109,
-     110,    -1,    -1,    44,    45,    46,    -1,    48,    -1,    -1,
-      -1,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
-      -1,    23,    -1,    -1,    -1,    86,    87,    88,    89,    90,
-      91,    -1,    93,    35,    95,    96,    97,    -1,    -1,    -1,
-     101,   102,    44,    45,    46,   106,    48,   108,   109,   110,
-      -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,
-      -1,    -1,    15,    16,    -1,    -1,    78,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
-      -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,   101,
-     102,    -1,    45,    46,   106,    48,   108,   109,   110,    -1,
-      -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
+      12,    -1,    -1,    15,    16,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,
+      90,    91,    -1,    -1,    -1,    95,    -1,    97,    98,    -1,
+      -1,   101,   102,    45,    46,   105,    48,    -1,   108,   109,
+     110,    -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    -1,
-      -1,    15,    16,    -1,    -1,    78,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
-      -1,    -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,
-      -1,    45,    46,   106,    48,   108,   109,   110,    -1,    -1,
+      -1,    15,    16,    -1,    -1,    -1,    78,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    95,    -1,    97,    98,    -1,    -1,   101,
+     102,    45,    46,   105,    48,    -1,   108,   109,   110,    -1,
       -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,
-      -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    23,    -1,
-      -1,    -1,    86,    87,    88,    89,    90,    91,    -1,    -1,
-      -1,    95,    96,    97,    -1,    -1,    -1,   101,   102,    44,
-      45,    46,   106,    48,   108,   109,   110,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    86,    87,    88,    89,    90,    91,    23,    -1,
+      -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,    -1,
+      -1,   105,    -1,    -1,   108,   109,   110,    -1,    -1,    44,
+      45,    46,    -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,
       55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,
       -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
-      95,    96,    97,    -1,    -1,    -1,   101,   102,    -1,    45,
-      46,   106,    48,   108,   109,   110,    -1,    -1,    -1,    55,
-      56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,
-      -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    95,
-      96,    97,    -1,    -1,    -1,   101,   102,    -1,    45,    46,
-     106,    48,   108,   109,   110,    -1,    -1,    -1,    55,    56,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    45,    46,
+     105,    48,    -1,   108,   109,   110,    -1,    -1,    55,    56,
       -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,
       -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,
-      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    96,
-      97,    -1,    -1,    -1,   101,   102,    -1,    45,    46,   106,
-      48,   108,   109,   110,    -1,    -1,    -1,    55,    56,    -1,
-      58,    -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
-      78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,
-      88,    89,    90,    91,    -1,    -1,    -1,    95,    96,    97,
-      -1,    -1,    -1,   101,   102,    -1,    45,    46,   106,    48,
-     108,   109,   110,    -1,    -1,    -1,    55,    56,    -1,    58,
+      87,    88,    89,    90,    91,    -1,    -1,    -1,    95,    -1,
+      97,    98,    -1,    -1,   101,   102,    45,    46,   105,    48,
+      -1,   108,   109,   110,    -1,    -1,    55,    56,    -1,    58,
       -1,    60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      69,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,    78,
+      -1,    12,    -1,    -1,    15,    -1,    -1,    -1,    -1,    78,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    87,    88,
-      89,    90,    91,    -1,    -1,    -1,    95,    96,    97,    -1,
-      -1,    -1,   101,   102,    -1,    45,    46,   106,    48,   108,
-     109,   110,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,
-      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
-      -1,    -1,    23,    -1,    -1,    -1,    86,    87,    88,    89,
-      90,    91,    -1,    -1,    -1,    95,    96,    97,    -1,    -1,
-      -1,   101,   102,    44,    45,    46,   106,    48,   108,   109,
-     110,    -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      12,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      89,    90,    91,    -1,    -1,    -1,    95,    -1,    97,    98,
+      -1,    -1,   101,   102,    45,    46,   105,    48,    -1,   108,
+     109,   110,    -1,    -1,    55,    56,    -1,    58,    -1,    60,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,
-      91,    -1,    -1,    -1,    -1,    96,    97,    -1,    -1,    -1,
-     101,   102,    -1,    45,    46,   106,    48,   108,   109,   110,
-      -1,    -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,
+      91,    -1,    -1,    -1,    95,    -1,    97,    98,    -1,    -1,
+     101,   102,    45,    46,   105,    48,    -1,   108,   109,   110,
+      -1,    -1,    55,    56,    -1,    58,    -1,    60,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    69,    12,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    86,    87,    88,    89,    90,    91,    -1,
+      -1,    -1,    95,    -1,    97,    98,    -1,    -1,   101,   102,
+      45,    46,   105,    48,    -1,   108,   109,   110,    -1,    -1,
+      55,    56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
-      -1,    -1,    -1,    95,    96,    97,    -1,    -1,    -1,   101,
-     102,    -1,    -1,    -1,   106,    -1,   108,   109,   110
+      -1,    -1,    -1,    78,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    86,    87,    88,    89,    90,    91,    23,    -1,    -1,
+      95,    -1,    97,    98,    -1,    -1,   101,   102,    -1,    -1,
+     105,    12,    -1,   108,   109,   110,    -1,    -1,    44,    45,
+      46,    -1,    48,    -1,    -1,    -1,    -1,    -1,    -1,    55,
+      56,    -1,    58,    -1,    60,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    46,    -1,    48,    -1,    -1,
+      -1,    -1,    78,    -1,    55,    56,    -1,    58,    -1,    60,
+      86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    -1,
+      -1,    97,    98,    -1,    -1,   101,   102,    78,    -1,   105,
+      -1,    -1,   108,   109,   110,    86,    87,    88,    89,    90,
+      91,    -1,    -1,    -1,    95,    -1,    97,    98,    -1,    -1,
+     101,   102,    -1,    -1,   105,    -1,    -1,   108,   109,   110
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,     1,    10,    14,   113,   128,   130,   142,     0,     7,
+       0,     1,     9,    14,   113,   128,   130,   142,     0,     7,
        8,    11,    12,    15,    45,    46,    48,    54,    55,    56,
       58,    60,    78,    86,    87,    88,    89,    90,    91,    95,
-      96,    97,   101,   102,   106,   108,   109,   110,   125,   131,
-     132,   134,   137,   144,   145,   155,   156,   157,   159,    10,
-      14,   125,   125,   137,   138,   146,    12,    12,   106,   156,
+      97,    98,   101,   102,   105,   108,   109,   110,   125,   131,
+     132,   134,   137,   144,   145,   155,   156,   157,   159,     9,
+      14,   125,   125,   137,   138,   146,    12,    12,   105,   156,
      157,    86,    89,   123,    12,    12,    12,    12,    42,   157,
       12,    12,   156,   156,   144,   156,   157,   157,   156,     1,
-      10,    14,    47,    49,    50,    51,    52,    53,    57,    61,
-      62,    76,    77,    98,    99,   117,   119,   124,   125,   137,
-     141,   148,   150,   154,   160,     9,   125,   128,    13,    23,
+       9,    14,    47,    49,    50,    51,    52,    53,    57,    61,
+      62,    76,    77,    96,    99,   117,   119,   124,   125,   137,
+     141,   148,   150,   154,   160,    10,   125,   128,    13,    23,
       35,    36,    38,    39,    40,    41,    42,    43,    44,    93,
      114,   115,   156,    12,    15,   101,   102,   103,   104,   107,
-      69,   108,   109,    18,   154,   154,     9,    16,   116,    16,
+      69,   108,   109,    18,   154,   154,    10,    16,   116,    16,
      116,    92,    16,   135,   137,   137,    12,   137,   137,   135,
-      16,   135,   156,    42,   137,   137,    10,   126,   127,    14,
+      16,   135,   156,    42,   137,   137,     9,   126,   127,    14,
      126,   149,   149,   159,   137,   149,    12,    12,   149,   149,
-     137,   149,    12,    10,   151,   150,   154,    12,   136,   139,
+     137,   149,    12,     9,   151,   150,   154,    12,   136,   139,
      140,   144,   156,   157,   149,    17,   150,   153,   127,   154,
      132,    95,   137,   145,   137,   137,   137,   137,   137,   137,
-     159,   137,    10,   137,    10,   137,   137,   145,    69,   156,
-     156,   156,   156,   156,   156,   137,   135,    17,    17,    10,
+     159,   137,     9,   137,     9,   137,   137,   145,    69,   156,
+     156,   156,   156,   156,   156,   137,   135,    17,    17,     9,
      137,    44,   137,    15,    16,   116,    86,   158,   116,   116,
-      16,    16,   156,   116,   116,    10,   127,    18,   149,   129,
+      16,    16,   156,   116,   116,     9,   127,    18,   149,   129,
      148,   159,   137,   149,   137,   150,    79,   118,    17,   143,
      138,    23,    44,    93,   114,   115,   156,   116,    13,    37,
       40,    69,   150,   131,    17,   157,    94,   116,   116,   156,
       19,   159,   137,    16,   116,   147,   137,   145,   137,   145,
-     137,   159,   135,    14,    44,   147,   147,   152,    10,   150,
-      10,    16,    12,   136,   145,   159,   136,   136,   136,   136,
-     156,   156,   156,   136,   125,   137,   137,   137,    86,    10,
+     159,   137,   135,    14,    44,   147,   147,   152,     9,   150,
+       9,    16,    12,   136,   145,   159,   136,   136,   136,   136,
+     156,   156,   156,   136,   125,   137,   137,   137,    86,     9,
      133,    16,    16,    16,    16,    16,   116,    16,   116,    19,
       14,   127,   159,    99,    44,   138,    94,   154,    16,   116,
-      16,   116,   125,   137,   137,   145,   127,   137,   147,    12,
+      16,   116,   125,   137,   145,   137,   127,   137,   147,    12,
      159,    16,   136,    17,   157,   157,   154,    16,    16,    16,
      129,    14,   122,   137,    16,    16,    17,   147,   127,   150,
       16,   121,   129,   149,   150,   147,   120,   150
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   112,   113,   113,   114,   114,   115,   115,   116,   116,
+     117,   117,   118,   118,   120,   119,   121,   119,   122,   119,
+     123,   123,   124,   125,   125,   126,   126,   127,   127,   128,
+     128,   129,   129,   130,   130,   131,   132,   132,   132,   132,
+     132,   132,   132,   133,   132,   134,   134,   135,   135,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+     137,   137,   137,   137,   137,   137,   137,   137,   137,   138,
+     138,   139,   139,   140,   140,   140,   141,   141,   142,   142,
+     142,   142,   143,   143,   144,   144,   146,   145,   147,   147,
+     148,   148,   148,   148,   148,   148,   148,   148,   149,   149,
+     150,   150,   151,   152,   150,   150,   150,   150,   150,   150,
+     150,   150,   150,   150,   150,   150,   153,   150,   150,   154,
+     154,   155,   155,   156,   156,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   156,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   156,   157,   157,   157,   157,   158,
+     158,   158,   159,   159,   159,   160
+};
 
-#define YYFAIL		goto yyerrlab
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     2,     1,     2,     1,     2,
+       1,     2,     1,     2,     0,    12,     0,    10,     0,     8,
+       1,     1,     4,     1,     2,     1,     2,     0,     1,     0,
+       1,     0,     1,     1,     3,     1,     1,     4,     4,     7,
+       3,     4,     4,     0,     9,     1,     3,     1,     3,     3,
+       5,     3,     3,     3,     3,     3,     5,     2,     1,     1,
+       3,     5,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     5,     4,     3,     2,     1,     1,     3,
+       3,     1,     3,     0,     1,     3,     1,     1,     1,     1,
+       2,     2,     1,     2,     1,     2,     0,     4,     1,     2,
+       4,     4,     4,     2,     5,     2,     1,     1,     1,     2,
+       2,     2,     0,     0,     9,     3,     2,     1,     4,     2,
+       3,     2,     2,     3,     2,     2,     0,     3,     2,     1,
+       2,     1,     1,     4,     3,     3,     3,     3,     3,     3,
+       2,     2,     2,     3,     4,     1,     3,     4,     2,     2,
+       2,     2,     2,     4,     3,     2,     1,     6,     6,     3,
+       6,     6,     1,     8,     8,     6,     4,     1,     6,     6,
+       8,     8,     8,     6,     1,     1,     4,     1,     2,     0,
+       1,     3,     1,     1,     1,     4
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -2001,80 +2168,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -2082,80 +2227,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -2170,478 +2303,219 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
 
 
-/* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
+/* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
-
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
-
-  YYSIZE_T yystacksize = YYINITDEPTH;
-
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2656,30 +2530,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2694,14 +2564,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2714,837 +2584,952 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
+  case 2: /* program: pas  */
 #line 98 "awkgram.y"
-    { if (errorflag==0)
-			winner = (Node *)stat3(PROGRAM, beginloc, (yyvsp[(1) - (1)].p), endloc); }
+                { if (errorflag==0)
+			winner = (Node *)stat3(PROGRAM, beginloc, (yyvsp[0].p), endloc); }
+#line 2592 "y.tab.c"
     break;
 
-  case 3:
+  case 3: /* program: error  */
 #line 100 "awkgram.y"
-    { yyclearin; bracecheck(); SYNTAX("bailing out"); }
+                { yyclearin; bracecheck(); SYNTAX("bailing out"); }
+#line 2598 "y.tab.c"
     break;
 
-  case 14:
+  case 14: /* $@1: %empty  */
 #line 124 "awkgram.y"
-    {inloop++;}
+                                                                                       {inloop++;}
+#line 2604 "y.tab.c"
     break;
 
-  case 15:
+  case 15: /* for: FOR '(' opt_simple_stmt ';' opt_nl pattern ';' opt_nl opt_simple_stmt rparen $@1 stmt  */
 #line 125 "awkgram.y"
-    { --inloop; (yyval.p) = stat4(FOR, (yyvsp[(3) - (12)].p), notnull((yyvsp[(6) - (12)].p)), (yyvsp[(9) - (12)].p), (yyvsp[(12) - (12)].p)); }
+                { --inloop; (yyval.p) = stat4(FOR, (yyvsp[-9].p), notnull((yyvsp[-6].p)), (yyvsp[-3].p), (yyvsp[0].p)); }
+#line 2610 "y.tab.c"
     break;
 
-  case 16:
+  case 16: /* $@2: %empty  */
 #line 126 "awkgram.y"
-    {inloop++;}
+                                                                         {inloop++;}
+#line 2616 "y.tab.c"
     break;
 
-  case 17:
+  case 17: /* for: FOR '(' opt_simple_stmt ';' ';' opt_nl opt_simple_stmt rparen $@2 stmt  */
 #line 127 "awkgram.y"
-    { --inloop; (yyval.p) = stat4(FOR, (yyvsp[(3) - (10)].p), NIL, (yyvsp[(7) - (10)].p), (yyvsp[(10) - (10)].p)); }
+                { --inloop; (yyval.p) = stat4(FOR, (yyvsp[-7].p), NIL, (yyvsp[-3].p), (yyvsp[0].p)); }
+#line 2622 "y.tab.c"
     break;
 
-  case 18:
+  case 18: /* $@3: %empty  */
 #line 128 "awkgram.y"
-    {inloop++;}
+                                            {inloop++;}
+#line 2628 "y.tab.c"
     break;
 
-  case 19:
+  case 19: /* for: FOR '(' varname IN varname rparen $@3 stmt  */
 #line 129 "awkgram.y"
-    { --inloop; (yyval.p) = stat3(IN, (yyvsp[(3) - (8)].p), makearr((yyvsp[(5) - (8)].p)), (yyvsp[(8) - (8)].p)); }
+                { --inloop; (yyval.p) = stat3(IN, (yyvsp[-5].p), makearr((yyvsp[-3].p)), (yyvsp[0].p)); }
+#line 2634 "y.tab.c"
     break;
 
-  case 20:
+  case 20: /* funcname: VAR  */
 #line 133 "awkgram.y"
-    { setfname((yyvsp[(1) - (1)].cp)); }
+                { setfname((yyvsp[0].cp)); }
+#line 2640 "y.tab.c"
     break;
 
-  case 21:
+  case 21: /* funcname: CALL  */
 #line 134 "awkgram.y"
-    { setfname((yyvsp[(1) - (1)].cp)); }
+                { setfname((yyvsp[0].cp)); }
+#line 2646 "y.tab.c"
     break;
 
-  case 22:
+  case 22: /* if: IF '(' pattern rparen  */
 #line 138 "awkgram.y"
-    { (yyval.p) = notnull((yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = notnull((yyvsp[-1].p)); }
+#line 2652 "y.tab.c"
     break;
 
-  case 27:
+  case 27: /* opt_nl: %empty  */
 #line 150 "awkgram.y"
-    { (yyval.i) = 0; }
+                        { (yyval.i) = 0; }
+#line 2658 "y.tab.c"
     break;
 
-  case 29:
+  case 29: /* opt_pst: %empty  */
 #line 155 "awkgram.y"
-    { (yyval.i) = 0; }
+                        { (yyval.i) = 0; }
+#line 2664 "y.tab.c"
     break;
 
-  case 31:
+  case 31: /* opt_simple_stmt: %empty  */
 #line 161 "awkgram.y"
-    { (yyval.p) = 0; }
+                                        { (yyval.p) = 0; }
+#line 2670 "y.tab.c"
     break;
 
-  case 33:
+  case 33: /* pas: opt_pst  */
 #line 166 "awkgram.y"
-    { (yyval.p) = 0; }
+                                        { (yyval.p) = 0; }
+#line 2676 "y.tab.c"
     break;
 
-  case 34:
+  case 34: /* pas: opt_pst pa_stats opt_pst  */
 #line 167 "awkgram.y"
-    { (yyval.p) = (yyvsp[(2) - (3)].p); }
+                                        { (yyval.p) = (yyvsp[-1].p); }
+#line 2682 "y.tab.c"
     break;
 
-  case 35:
+  case 35: /* pa_pat: pattern  */
 #line 171 "awkgram.y"
-    { (yyval.p) = notnull((yyvsp[(1) - (1)].p)); }
+                        { (yyval.p) = notnull((yyvsp[0].p)); }
+#line 2688 "y.tab.c"
     break;
 
-  case 36:
+  case 36: /* pa_stat: pa_pat  */
 #line 175 "awkgram.y"
-    { (yyval.p) = stat2(PASTAT, (yyvsp[(1) - (1)].p), stat2(PRINT, rectonode(), NIL)); }
+                                        { (yyval.p) = stat2(PASTAT, (yyvsp[0].p), stat2(PRINT, rectonode(), NIL)); }
+#line 2694 "y.tab.c"
     break;
 
-  case 37:
+  case 37: /* pa_stat: pa_pat lbrace stmtlist '}'  */
 #line 176 "awkgram.y"
-    { (yyval.p) = stat2(PASTAT, (yyvsp[(1) - (4)].p), (yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = stat2(PASTAT, (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 2700 "y.tab.c"
     break;
 
-  case 38:
+  case 38: /* pa_stat: pa_pat ',' opt_nl pa_pat  */
 #line 177 "awkgram.y"
-    { (yyval.p) = pa2stat((yyvsp[(1) - (4)].p), (yyvsp[(4) - (4)].p), stat2(PRINT, rectonode(), NIL)); }
+                                                { (yyval.p) = pa2stat((yyvsp[-3].p), (yyvsp[0].p), stat2(PRINT, rectonode(), NIL)); }
+#line 2706 "y.tab.c"
     break;
 
-  case 39:
+  case 39: /* pa_stat: pa_pat ',' opt_nl pa_pat lbrace stmtlist '}'  */
 #line 178 "awkgram.y"
-    { (yyval.p) = pa2stat((yyvsp[(1) - (7)].p), (yyvsp[(4) - (7)].p), (yyvsp[(6) - (7)].p)); }
+                                                        { (yyval.p) = pa2stat((yyvsp[-6].p), (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 2712 "y.tab.c"
     break;
 
-  case 40:
+  case 40: /* pa_stat: lbrace stmtlist '}'  */
 #line 179 "awkgram.y"
-    { (yyval.p) = stat2(PASTAT, NIL, (yyvsp[(2) - (3)].p)); }
+                                        { (yyval.p) = stat2(PASTAT, NIL, (yyvsp[-1].p)); }
+#line 2718 "y.tab.c"
     break;
 
-  case 41:
+  case 41: /* pa_stat: XBEGIN lbrace stmtlist '}'  */
 #line 181 "awkgram.y"
-    { beginloc = linkum(beginloc, (yyvsp[(3) - (4)].p)); (yyval.p) = 0; }
+                { beginloc = linkum(beginloc, (yyvsp[-1].p)); (yyval.p) = 0; }
+#line 2724 "y.tab.c"
     break;
 
-  case 42:
+  case 42: /* pa_stat: XEND lbrace stmtlist '}'  */
 #line 183 "awkgram.y"
-    { endloc = linkum(endloc, (yyvsp[(3) - (4)].p)); (yyval.p) = 0; }
+                { endloc = linkum(endloc, (yyvsp[-1].p)); (yyval.p) = 0; }
+#line 2730 "y.tab.c"
     break;
 
-  case 43:
+  case 43: /* $@4: %empty  */
 #line 184 "awkgram.y"
-    {infunc++;}
+                                           {infunc++;}
+#line 2736 "y.tab.c"
     break;
 
-  case 44:
+  case 44: /* pa_stat: FUNC funcname '(' varlist rparen $@4 lbrace stmtlist '}'  */
 #line 185 "awkgram.y"
-    { infunc--; curfname=0; defn((Cell *)(yyvsp[(2) - (9)].p), (yyvsp[(4) - (9)].p), (yyvsp[(8) - (9)].p)); (yyval.p) = 0; }
+                { infunc--; curfname=0; defn((Cell *)(yyvsp[-7].p), (yyvsp[-5].p), (yyvsp[-1].p)); (yyval.p) = 0; }
+#line 2742 "y.tab.c"
     break;
 
-  case 46:
+  case 46: /* pa_stats: pa_stats opt_pst pa_stat  */
 #line 190 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = linkum((yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2748 "y.tab.c"
     break;
 
-  case 48:
+  case 48: /* patlist: patlist comma pattern  */
 #line 195 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = linkum((yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2754 "y.tab.c"
     break;
 
-  case 49:
+  case 49: /* ppattern: var ASGNOP ppattern  */
 #line 199 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2760 "y.tab.c"
     break;
 
-  case 50:
+  case 50: /* ppattern: ppattern '?' ppattern ':' ppattern  */
 #line 201 "awkgram.y"
-    { (yyval.p) = op3(CONDEXPR, notnull((yyvsp[(1) - (5)].p)), (yyvsp[(3) - (5)].p), (yyvsp[(5) - (5)].p)); }
+                { (yyval.p) = op3(CONDEXPR, notnull((yyvsp[-4].p)), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2766 "y.tab.c"
     break;
 
-  case 51:
+  case 51: /* ppattern: ppattern bor ppattern  */
 #line 203 "awkgram.y"
-    { (yyval.p) = op2(BOR, notnull((yyvsp[(1) - (3)].p)), notnull((yyvsp[(3) - (3)].p))); }
+                { (yyval.p) = op2(BOR, notnull((yyvsp[-2].p)), notnull((yyvsp[0].p))); }
+#line 2772 "y.tab.c"
     break;
 
-  case 52:
+  case 52: /* ppattern: ppattern and ppattern  */
 #line 205 "awkgram.y"
-    { (yyval.p) = op2(AND, notnull((yyvsp[(1) - (3)].p)), notnull((yyvsp[(3) - (3)].p))); }
+                { (yyval.p) = op2(AND, notnull((yyvsp[-2].p)), notnull((yyvsp[0].p))); }
+#line 2778 "y.tab.c"
     break;
 
-  case 53:
+  case 53: /* ppattern: ppattern MATCHOP reg_expr  */
 #line 206 "awkgram.y"
-    { (yyval.p) = op3((yyvsp[(2) - (3)].i), NIL, (yyvsp[(1) - (3)].p), (Node*)makedfa((yyvsp[(3) - (3)].s), 0)); }
+                                        { (yyval.p) = op3((yyvsp[-1].i), NIL, (yyvsp[-2].p), (Node*)makedfa((yyvsp[0].s), 0)); }
+#line 2784 "y.tab.c"
     break;
 
-  case 54:
+  case 54: /* ppattern: ppattern MATCHOP ppattern  */
 #line 208 "awkgram.y"
-    { if (constnode((yyvsp[(3) - (3)].p)))
-			(yyval.p) = op3((yyvsp[(2) - (3)].i), NIL, (yyvsp[(1) - (3)].p), (Node*)makedfa(strnode((yyvsp[(3) - (3)].p)), 0));
+                { if (constnode((yyvsp[0].p)))
+			(yyval.p) = op3((yyvsp[-1].i), NIL, (yyvsp[-2].p), (Node*)makedfa(strnode((yyvsp[0].p)), 0));
 		  else
-			(yyval.p) = op3((yyvsp[(2) - (3)].i), (Node *)1, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+			(yyval.p) = op3((yyvsp[-1].i), (Node *)1, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2793 "y.tab.c"
     break;
 
-  case 55:
+  case 55: /* ppattern: ppattern IN varname  */
 #line 212 "awkgram.y"
-    { (yyval.p) = op2(INTEST, (yyvsp[(1) - (3)].p), makearr((yyvsp[(3) - (3)].p))); }
+                                        { (yyval.p) = op2(INTEST, (yyvsp[-2].p), makearr((yyvsp[0].p))); }
+#line 2799 "y.tab.c"
     break;
 
-  case 56:
+  case 56: /* ppattern: '(' plist ')' IN varname  */
 #line 213 "awkgram.y"
-    { (yyval.p) = op2(INTEST, (yyvsp[(2) - (5)].p), makearr((yyvsp[(5) - (5)].p))); }
+                                        { (yyval.p) = op2(INTEST, (yyvsp[-3].p), makearr((yyvsp[0].p))); }
+#line 2805 "y.tab.c"
     break;
 
-  case 57:
+  case 57: /* ppattern: ppattern term  */
 #line 214 "awkgram.y"
-    { (yyval.p) = op2(CAT, (yyvsp[(1) - (2)].p), (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op2(CAT, (yyvsp[-1].p), (yyvsp[0].p)); }
+#line 2811 "y.tab.c"
     break;
 
-  case 60:
+  case 60: /* pattern: var ASGNOP pattern  */
 #line 220 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2817 "y.tab.c"
     break;
 
-  case 61:
+  case 61: /* pattern: pattern '?' pattern ':' pattern  */
 #line 222 "awkgram.y"
-    { (yyval.p) = op3(CONDEXPR, notnull((yyvsp[(1) - (5)].p)), (yyvsp[(3) - (5)].p), (yyvsp[(5) - (5)].p)); }
+                { (yyval.p) = op3(CONDEXPR, notnull((yyvsp[-4].p)), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2823 "y.tab.c"
     break;
 
-  case 62:
+  case 62: /* pattern: pattern bor pattern  */
 #line 224 "awkgram.y"
-    { (yyval.p) = op2(BOR, notnull((yyvsp[(1) - (3)].p)), notnull((yyvsp[(3) - (3)].p))); }
+                { (yyval.p) = op2(BOR, notnull((yyvsp[-2].p)), notnull((yyvsp[0].p))); }
+#line 2829 "y.tab.c"
     break;
 
-  case 63:
+  case 63: /* pattern: pattern and pattern  */
 #line 226 "awkgram.y"
-    { (yyval.p) = op2(AND, notnull((yyvsp[(1) - (3)].p)), notnull((yyvsp[(3) - (3)].p))); }
+                { (yyval.p) = op2(AND, notnull((yyvsp[-2].p)), notnull((yyvsp[0].p))); }
+#line 2835 "y.tab.c"
     break;
 
-  case 64:
+  case 64: /* pattern: pattern EQ pattern  */
 #line 227 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2841 "y.tab.c"
     break;
 
-  case 65:
+  case 65: /* pattern: pattern GE pattern  */
 #line 228 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2847 "y.tab.c"
     break;
 
-  case 66:
+  case 66: /* pattern: pattern GT pattern  */
 #line 229 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2853 "y.tab.c"
     break;
 
-  case 67:
+  case 67: /* pattern: pattern LE pattern  */
 #line 230 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2859 "y.tab.c"
     break;
 
-  case 68:
+  case 68: /* pattern: pattern LT pattern  */
 #line 231 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2865 "y.tab.c"
     break;
 
-  case 69:
+  case 69: /* pattern: pattern NE pattern  */
 #line 232 "awkgram.y"
-    { (yyval.p) = op2((yyvsp[(2) - (3)].i), (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2((yyvsp[-1].i), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2871 "y.tab.c"
     break;
 
-  case 70:
+  case 70: /* pattern: pattern MATCHOP reg_expr  */
 #line 233 "awkgram.y"
-    { (yyval.p) = op3((yyvsp[(2) - (3)].i), NIL, (yyvsp[(1) - (3)].p), (Node*)makedfa((yyvsp[(3) - (3)].s), 0)); }
+                                        { (yyval.p) = op3((yyvsp[-1].i), NIL, (yyvsp[-2].p), (Node*)makedfa((yyvsp[0].s), 0)); }
+#line 2877 "y.tab.c"
     break;
 
-  case 71:
+  case 71: /* pattern: pattern MATCHOP pattern  */
 #line 235 "awkgram.y"
-    { if (constnode((yyvsp[(3) - (3)].p)))
-			(yyval.p) = op3((yyvsp[(2) - (3)].i), NIL, (yyvsp[(1) - (3)].p), (Node*)makedfa(strnode((yyvsp[(3) - (3)].p)), 0));
+                { if (constnode((yyvsp[0].p)))
+			(yyval.p) = op3((yyvsp[-1].i), NIL, (yyvsp[-2].p), (Node*)makedfa(strnode((yyvsp[0].p)), 0));
 		  else
-			(yyval.p) = op3((yyvsp[(2) - (3)].i), (Node *)1, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+			(yyval.p) = op3((yyvsp[-1].i), (Node *)1, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2886 "y.tab.c"
     break;
 
-  case 72:
+  case 72: /* pattern: pattern IN varname  */
 #line 239 "awkgram.y"
-    { (yyval.p) = op2(INTEST, (yyvsp[(1) - (3)].p), makearr((yyvsp[(3) - (3)].p))); }
+                                        { (yyval.p) = op2(INTEST, (yyvsp[-2].p), makearr((yyvsp[0].p))); }
+#line 2892 "y.tab.c"
     break;
 
-  case 73:
+  case 73: /* pattern: '(' plist ')' IN varname  */
 #line 240 "awkgram.y"
-    { (yyval.p) = op2(INTEST, (yyvsp[(2) - (5)].p), makearr((yyvsp[(5) - (5)].p))); }
+                                        { (yyval.p) = op2(INTEST, (yyvsp[-3].p), makearr((yyvsp[0].p))); }
+#line 2898 "y.tab.c"
     break;
 
-  case 74:
+  case 74: /* pattern: pattern '|' GETLINE var  */
 #line 241 "awkgram.y"
-    { 
+                                        { 
 			if (safe) SYNTAX("cmd | getline is unsafe");
-			else (yyval.p) = op3(GETLINE, (yyvsp[(4) - (4)].p), itonp((yyvsp[(2) - (4)].i)), (yyvsp[(1) - (4)].p)); }
+			else (yyval.p) = op3(GETLINE, (yyvsp[0].p), itonp((yyvsp[-2].i)), (yyvsp[-3].p)); }
+#line 2906 "y.tab.c"
     break;
 
-  case 75:
+  case 75: /* pattern: pattern '|' GETLINE  */
 #line 244 "awkgram.y"
-    { 
+                                        { 
 			if (safe) SYNTAX("cmd | getline is unsafe");
-			else (yyval.p) = op3(GETLINE, (Node*)0, itonp((yyvsp[(2) - (3)].i)), (yyvsp[(1) - (3)].p)); }
+			else (yyval.p) = op3(GETLINE, (Node*)0, itonp((yyvsp[-1].i)), (yyvsp[-2].p)); }
+#line 2914 "y.tab.c"
     break;
 
-  case 76:
+  case 76: /* pattern: pattern term  */
 #line 247 "awkgram.y"
-    { (yyval.p) = op2(CAT, (yyvsp[(1) - (2)].p), (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op2(CAT, (yyvsp[-1].p), (yyvsp[0].p)); }
+#line 2920 "y.tab.c"
     break;
 
-  case 79:
+  case 79: /* plist: pattern comma pattern  */
 #line 253 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = linkum((yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2926 "y.tab.c"
     break;
 
-  case 80:
+  case 80: /* plist: plist comma pattern  */
 #line 254 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = linkum((yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2932 "y.tab.c"
     break;
 
-  case 82:
+  case 82: /* pplist: pplist comma ppattern  */
 #line 259 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = linkum((yyvsp[-2].p), (yyvsp[0].p)); }
+#line 2938 "y.tab.c"
     break;
 
-  case 83:
+  case 83: /* prarg: %empty  */
 #line 263 "awkgram.y"
-    { (yyval.p) = rectonode(); }
+                                        { (yyval.p) = rectonode(); }
+#line 2944 "y.tab.c"
     break;
 
-  case 85:
+  case 85: /* prarg: '(' plist ')'  */
 #line 265 "awkgram.y"
-    { (yyval.p) = (yyvsp[(2) - (3)].p); }
+                                        { (yyval.p) = (yyvsp[-1].p); }
+#line 2950 "y.tab.c"
     break;
 
-  case 94:
+  case 94: /* re: reg_expr  */
 #line 282 "awkgram.y"
-    { (yyval.p) = op3(MATCH, NIL, rectonode(), (Node*)makedfa((yyvsp[(1) - (1)].s), 0)); }
+                { (yyval.p) = op3(MATCH, NIL, rectonode(), (Node*)makedfa((yyvsp[0].s), 0)); }
+#line 2956 "y.tab.c"
     break;
 
-  case 95:
+  case 95: /* re: NOT re  */
 #line 283 "awkgram.y"
-    { (yyval.p) = op1(NOT, notnull((yyvsp[(2) - (2)].p))); }
+                        { (yyval.p) = op1(NOT, notnull((yyvsp[0].p))); }
+#line 2962 "y.tab.c"
     break;
 
-  case 96:
+  case 96: /* $@5: %empty  */
 #line 287 "awkgram.y"
-    {startreg();}
+              {startreg();}
+#line 2968 "y.tab.c"
     break;
 
-  case 97:
+  case 97: /* reg_expr: '/' $@5 REGEXPR '/'  */
 #line 287 "awkgram.y"
-    { (yyval.s) = (yyvsp[(3) - (4)].s); }
+                                                { (yyval.s) = (yyvsp[-1].s); }
+#line 2974 "y.tab.c"
     break;
 
-  case 100:
+  case 100: /* simple_stmt: print prarg '|' term  */
 #line 295 "awkgram.y"
-    { 
+                                        { 
 			if (safe) SYNTAX("print | is unsafe");
-			else (yyval.p) = stat3((yyvsp[(1) - (4)].i), (yyvsp[(2) - (4)].p), itonp((yyvsp[(3) - (4)].i)), (yyvsp[(4) - (4)].p)); }
+			else (yyval.p) = stat3((yyvsp[-3].i), (yyvsp[-2].p), itonp((yyvsp[-1].i)), (yyvsp[0].p)); }
+#line 2982 "y.tab.c"
     break;
 
-  case 101:
+  case 101: /* simple_stmt: print prarg APPEND term  */
 #line 298 "awkgram.y"
-    {
+                                        {
 			if (safe) SYNTAX("print >> is unsafe");
-			else (yyval.p) = stat3((yyvsp[(1) - (4)].i), (yyvsp[(2) - (4)].p), itonp((yyvsp[(3) - (4)].i)), (yyvsp[(4) - (4)].p)); }
+			else (yyval.p) = stat3((yyvsp[-3].i), (yyvsp[-2].p), itonp((yyvsp[-1].i)), (yyvsp[0].p)); }
+#line 2990 "y.tab.c"
     break;
 
-  case 102:
+  case 102: /* simple_stmt: print prarg GT term  */
 #line 301 "awkgram.y"
-    {
+                                        {
 			if (safe) SYNTAX("print > is unsafe");
-			else (yyval.p) = stat3((yyvsp[(1) - (4)].i), (yyvsp[(2) - (4)].p), itonp((yyvsp[(3) - (4)].i)), (yyvsp[(4) - (4)].p)); }
+			else (yyval.p) = stat3((yyvsp[-3].i), (yyvsp[-2].p), itonp((yyvsp[-1].i)), (yyvsp[0].p)); }
+#line 2998 "y.tab.c"
     break;
 
-  case 103:
+  case 103: /* simple_stmt: print prarg  */
 #line 304 "awkgram.y"
-    { (yyval.p) = stat3((yyvsp[(1) - (2)].i), (yyvsp[(2) - (2)].p), NIL, NIL); }
+                                        { (yyval.p) = stat3((yyvsp[-1].i), (yyvsp[0].p), NIL, NIL); }
+#line 3004 "y.tab.c"
     break;
 
-  case 104:
+  case 104: /* simple_stmt: DELETE varname '[' patlist ']'  */
 #line 305 "awkgram.y"
-    { (yyval.p) = stat2(DELETE, makearr((yyvsp[(2) - (5)].p)), (yyvsp[(4) - (5)].p)); }
+                                         { (yyval.p) = stat2(DELETE, makearr((yyvsp[-3].p)), (yyvsp[-1].p)); }
+#line 3010 "y.tab.c"
     break;
 
-  case 105:
+  case 105: /* simple_stmt: DELETE varname  */
 #line 306 "awkgram.y"
-    { (yyval.p) = stat2(DELETE, makearr((yyvsp[(2) - (2)].p)), 0); }
+                                         { (yyval.p) = stat2(DELETE, makearr((yyvsp[0].p)), 0); }
+#line 3016 "y.tab.c"
     break;
 
-  case 106:
+  case 106: /* simple_stmt: pattern  */
 #line 307 "awkgram.y"
-    { (yyval.p) = exptostat((yyvsp[(1) - (1)].p)); }
+                                        { (yyval.p) = exptostat((yyvsp[0].p)); }
+#line 3022 "y.tab.c"
     break;
 
-  case 107:
+  case 107: /* simple_stmt: error  */
 #line 308 "awkgram.y"
-    { yyclearin; SYNTAX("illegal statement"); }
+                                        { yyclearin; SYNTAX("illegal statement"); }
+#line 3028 "y.tab.c"
     break;
 
-  case 110:
+  case 110: /* stmt: BREAK st  */
 #line 317 "awkgram.y"
-    { if (!inloop) SYNTAX("break illegal outside of loops");
+                                { if (!inloop) SYNTAX("break illegal outside of loops");
 				  (yyval.p) = stat1(BREAK, NIL); }
+#line 3035 "y.tab.c"
     break;
 
-  case 111:
+  case 111: /* stmt: CONTINUE st  */
 #line 319 "awkgram.y"
-    {  if (!inloop) SYNTAX("continue illegal outside of loops");
+                                {  if (!inloop) SYNTAX("continue illegal outside of loops");
 				  (yyval.p) = stat1(CONTINUE, NIL); }
+#line 3042 "y.tab.c"
     break;
 
-  case 112:
+  case 112: /* $@6: %empty  */
 #line 321 "awkgram.y"
-    {inloop++;}
+             {inloop++;}
+#line 3048 "y.tab.c"
     break;
 
-  case 113:
+  case 113: /* $@7: %empty  */
 #line 321 "awkgram.y"
-    {--inloop;}
+                              {--inloop;}
+#line 3054 "y.tab.c"
     break;
 
-  case 114:
+  case 114: /* stmt: do $@6 stmt $@7 WHILE '(' pattern ')' st  */
 #line 322 "awkgram.y"
-    { (yyval.p) = stat2(DO, (yyvsp[(3) - (9)].p), notnull((yyvsp[(7) - (9)].p))); }
+                { (yyval.p) = stat2(DO, (yyvsp[-6].p), notnull((yyvsp[-2].p))); }
+#line 3060 "y.tab.c"
     break;
 
-  case 115:
+  case 115: /* stmt: EXIT pattern st  */
 #line 323 "awkgram.y"
-    { (yyval.p) = stat1(EXIT, (yyvsp[(2) - (3)].p)); }
+                                { (yyval.p) = stat1(EXIT, (yyvsp[-1].p)); }
+#line 3066 "y.tab.c"
     break;
 
-  case 116:
+  case 116: /* stmt: EXIT st  */
 #line 324 "awkgram.y"
-    { (yyval.p) = stat1(EXIT, NIL); }
+                                { (yyval.p) = stat1(EXIT, NIL); }
+#line 3072 "y.tab.c"
     break;
 
-  case 118:
+  case 118: /* stmt: if stmt else stmt  */
 #line 326 "awkgram.y"
-    { (yyval.p) = stat3(IF, (yyvsp[(1) - (4)].p), (yyvsp[(2) - (4)].p), (yyvsp[(4) - (4)].p)); }
+                                { (yyval.p) = stat3(IF, (yyvsp[-3].p), (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3078 "y.tab.c"
     break;
 
-  case 119:
+  case 119: /* stmt: if stmt  */
 #line 327 "awkgram.y"
-    { (yyval.p) = stat3(IF, (yyvsp[(1) - (2)].p), (yyvsp[(2) - (2)].p), NIL); }
+                                { (yyval.p) = stat3(IF, (yyvsp[-1].p), (yyvsp[0].p), NIL); }
+#line 3084 "y.tab.c"
     break;
 
-  case 120:
+  case 120: /* stmt: lbrace stmtlist rbrace  */
 #line 328 "awkgram.y"
-    { (yyval.p) = (yyvsp[(2) - (3)].p); }
+                                 { (yyval.p) = (yyvsp[-1].p); }
+#line 3090 "y.tab.c"
     break;
 
-  case 121:
+  case 121: /* stmt: NEXT st  */
 #line 329 "awkgram.y"
-    { if (infunc)
+                        { if (infunc)
 				SYNTAX("next is illegal inside a function");
 			  (yyval.p) = stat1(NEXT, NIL); }
+#line 3098 "y.tab.c"
     break;
 
-  case 122:
+  case 122: /* stmt: NEXTFILE st  */
 #line 332 "awkgram.y"
-    { if (infunc)
+                        { if (infunc)
 				SYNTAX("nextfile is illegal inside a function");
 			  (yyval.p) = stat1(NEXTFILE, NIL); }
+#line 3106 "y.tab.c"
     break;
 
-  case 123:
+  case 123: /* stmt: RETURN pattern st  */
 #line 335 "awkgram.y"
-    { (yyval.p) = stat1(RETURN, (yyvsp[(2) - (3)].p)); }
+                                { (yyval.p) = stat1(RETURN, (yyvsp[-1].p)); }
+#line 3112 "y.tab.c"
     break;
 
-  case 124:
+  case 124: /* stmt: RETURN st  */
 #line 336 "awkgram.y"
-    { (yyval.p) = stat1(RETURN, NIL); }
+                                { (yyval.p) = stat1(RETURN, NIL); }
+#line 3118 "y.tab.c"
     break;
 
-  case 126:
+  case 126: /* $@8: %empty  */
 #line 338 "awkgram.y"
-    {inloop++;}
+                {inloop++;}
+#line 3124 "y.tab.c"
     break;
 
-  case 127:
+  case 127: /* stmt: while $@8 stmt  */
 #line 338 "awkgram.y"
-    { --inloop; (yyval.p) = stat2(WHILE, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { --inloop; (yyval.p) = stat2(WHILE, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3130 "y.tab.c"
     break;
 
-  case 128:
+  case 128: /* stmt: ';' opt_nl  */
 #line 339 "awkgram.y"
-    { (yyval.p) = 0; }
+                                { (yyval.p) = 0; }
+#line 3136 "y.tab.c"
     break;
 
-  case 130:
+  case 130: /* stmtlist: stmtlist stmt  */
 #line 344 "awkgram.y"
-    { (yyval.p) = linkum((yyvsp[(1) - (2)].p), (yyvsp[(2) - (2)].p)); }
+                                { (yyval.p) = linkum((yyvsp[-1].p), (yyvsp[0].p)); }
+#line 3142 "y.tab.c"
     break;
 
-  case 133:
+  case 133: /* term: term '/' ASGNOP term  */
 #line 352 "awkgram.y"
-    { (yyval.p) = op2(DIVEQ, (yyvsp[(1) - (4)].p), (yyvsp[(4) - (4)].p)); }
+                                        { (yyval.p) = op2(DIVEQ, (yyvsp[-3].p), (yyvsp[0].p)); }
+#line 3148 "y.tab.c"
     break;
 
-  case 134:
+  case 134: /* term: term '+' term  */
 #line 353 "awkgram.y"
-    { (yyval.p) = op2(ADD, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(ADD, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3154 "y.tab.c"
     break;
 
-  case 135:
+  case 135: /* term: term '-' term  */
 #line 354 "awkgram.y"
-    { (yyval.p) = op2(MINUS, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(MINUS, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3160 "y.tab.c"
     break;
 
-  case 136:
+  case 136: /* term: term '*' term  */
 #line 355 "awkgram.y"
-    { (yyval.p) = op2(MULT, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(MULT, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3166 "y.tab.c"
     break;
 
-  case 137:
+  case 137: /* term: term '/' term  */
 #line 356 "awkgram.y"
-    { (yyval.p) = op2(DIVIDE, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(DIVIDE, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3172 "y.tab.c"
     break;
 
-  case 138:
+  case 138: /* term: term '%' term  */
 #line 357 "awkgram.y"
-    { (yyval.p) = op2(MOD, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(MOD, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3178 "y.tab.c"
     break;
 
-  case 139:
+  case 139: /* term: term POWER term  */
 #line 358 "awkgram.y"
-    { (yyval.p) = op2(POWER, (yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op2(POWER, (yyvsp[-2].p), (yyvsp[0].p)); }
+#line 3184 "y.tab.c"
     break;
 
-  case 140:
+  case 140: /* term: '-' term  */
 #line 359 "awkgram.y"
-    { (yyval.p) = op1(UMINUS, (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op1(UMINUS, (yyvsp[0].p)); }
+#line 3190 "y.tab.c"
     break;
 
-  case 141:
+  case 141: /* term: '+' term  */
 #line 360 "awkgram.y"
-    { (yyval.p) = (yyvsp[(2) - (2)].p); }
+                                        { (yyval.p) = (yyvsp[0].p); }
+#line 3196 "y.tab.c"
     break;
 
-  case 142:
+  case 142: /* term: NOT term  */
 #line 361 "awkgram.y"
-    { (yyval.p) = op1(NOT, notnull((yyvsp[(2) - (2)].p))); }
+                                        { (yyval.p) = op1(NOT, notnull((yyvsp[0].p))); }
+#line 3202 "y.tab.c"
     break;
 
-  case 143:
+  case 143: /* term: BLTIN '(' ')'  */
 #line 362 "awkgram.y"
-    { (yyval.p) = op2(BLTIN, itonp((yyvsp[(1) - (3)].i)), rectonode()); }
+                                        { (yyval.p) = op2(BLTIN, itonp((yyvsp[-2].i)), rectonode()); }
+#line 3208 "y.tab.c"
     break;
 
-  case 144:
+  case 144: /* term: BLTIN '(' patlist ')'  */
 #line 363 "awkgram.y"
-    { (yyval.p) = op2(BLTIN, itonp((yyvsp[(1) - (4)].i)), (yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = op2(BLTIN, itonp((yyvsp[-3].i)), (yyvsp[-1].p)); }
+#line 3214 "y.tab.c"
     break;
 
-  case 145:
+  case 145: /* term: BLTIN  */
 #line 364 "awkgram.y"
-    { (yyval.p) = op2(BLTIN, itonp((yyvsp[(1) - (1)].i)), rectonode()); }
+                                        { (yyval.p) = op2(BLTIN, itonp((yyvsp[0].i)), rectonode()); }
+#line 3220 "y.tab.c"
     break;
 
-  case 146:
+  case 146: /* term: CALL '(' ')'  */
 #line 365 "awkgram.y"
-    { (yyval.p) = op2(CALL, celltonode((yyvsp[(1) - (3)].cp),CVAR), NIL); }
+                                        { (yyval.p) = op2(CALL, celltonode((yyvsp[-2].cp),CVAR), NIL); }
+#line 3226 "y.tab.c"
     break;
 
-  case 147:
+  case 147: /* term: CALL '(' patlist ')'  */
 #line 366 "awkgram.y"
-    { (yyval.p) = op2(CALL, celltonode((yyvsp[(1) - (4)].cp),CVAR), (yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = op2(CALL, celltonode((yyvsp[-3].cp),CVAR), (yyvsp[-1].p)); }
+#line 3232 "y.tab.c"
     break;
 
-  case 148:
+  case 148: /* term: CLOSE term  */
 #line 367 "awkgram.y"
-    { (yyval.p) = op1(CLOSE, (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op1(CLOSE, (yyvsp[0].p)); }
+#line 3238 "y.tab.c"
     break;
 
-  case 149:
+  case 149: /* term: DECR var  */
 #line 368 "awkgram.y"
-    { (yyval.p) = op1(PREDECR, (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op1(PREDECR, (yyvsp[0].p)); }
+#line 3244 "y.tab.c"
     break;
 
-  case 150:
+  case 150: /* term: INCR var  */
 #line 369 "awkgram.y"
-    { (yyval.p) = op1(PREINCR, (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op1(PREINCR, (yyvsp[0].p)); }
+#line 3250 "y.tab.c"
     break;
 
-  case 151:
+  case 151: /* term: var DECR  */
 #line 370 "awkgram.y"
-    { (yyval.p) = op1(POSTDECR, (yyvsp[(1) - (2)].p)); }
+                                        { (yyval.p) = op1(POSTDECR, (yyvsp[-1].p)); }
+#line 3256 "y.tab.c"
     break;
 
-  case 152:
+  case 152: /* term: var INCR  */
 #line 371 "awkgram.y"
-    { (yyval.p) = op1(POSTINCR, (yyvsp[(1) - (2)].p)); }
+                                        { (yyval.p) = op1(POSTINCR, (yyvsp[-1].p)); }
+#line 3262 "y.tab.c"
     break;
 
-  case 153:
+  case 153: /* term: GETLINE var LT term  */
 #line 372 "awkgram.y"
-    { (yyval.p) = op3(GETLINE, (yyvsp[(2) - (4)].p), itonp((yyvsp[(3) - (4)].i)), (yyvsp[(4) - (4)].p)); }
+                                        { (yyval.p) = op3(GETLINE, (yyvsp[-2].p), itonp((yyvsp[-1].i)), (yyvsp[0].p)); }
+#line 3268 "y.tab.c"
     break;
 
-  case 154:
+  case 154: /* term: GETLINE LT term  */
 #line 373 "awkgram.y"
-    { (yyval.p) = op3(GETLINE, NIL, itonp((yyvsp[(2) - (3)].i)), (yyvsp[(3) - (3)].p)); }
+                                        { (yyval.p) = op3(GETLINE, NIL, itonp((yyvsp[-1].i)), (yyvsp[0].p)); }
+#line 3274 "y.tab.c"
     break;
 
-  case 155:
+  case 155: /* term: GETLINE var  */
 #line 374 "awkgram.y"
-    { (yyval.p) = op3(GETLINE, (yyvsp[(2) - (2)].p), NIL, NIL); }
+                                        { (yyval.p) = op3(GETLINE, (yyvsp[0].p), NIL, NIL); }
+#line 3280 "y.tab.c"
     break;
 
-  case 156:
+  case 156: /* term: GETLINE  */
 #line 375 "awkgram.y"
-    { (yyval.p) = op3(GETLINE, NIL, NIL, NIL); }
+                                        { (yyval.p) = op3(GETLINE, NIL, NIL, NIL); }
+#line 3286 "y.tab.c"
     break;
 
-  case 157:
+  case 157: /* term: INDEX '(' pattern comma pattern ')'  */
 #line 377 "awkgram.y"
-    { (yyval.p) = op2(INDEX, (yyvsp[(3) - (6)].p), (yyvsp[(5) - (6)].p)); }
+                { (yyval.p) = op2(INDEX, (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 3292 "y.tab.c"
     break;
 
-  case 158:
+  case 158: /* term: INDEX '(' pattern comma reg_expr ')'  */
 #line 379 "awkgram.y"
-    { SYNTAX("index() doesn't permit regular expressions");
-		  (yyval.p) = op2(INDEX, (yyvsp[(3) - (6)].p), (Node*)(yyvsp[(5) - (6)].s)); }
+                { SYNTAX("index() doesn't permit regular expressions");
+		  (yyval.p) = op2(INDEX, (yyvsp[-3].p), (Node*)(yyvsp[-1].s)); }
+#line 3299 "y.tab.c"
     break;
 
-  case 159:
+  case 159: /* term: '(' pattern ')'  */
 #line 381 "awkgram.y"
-    { (yyval.p) = (yyvsp[(2) - (3)].p); }
+                                        { (yyval.p) = (yyvsp[-1].p); }
+#line 3305 "y.tab.c"
     break;
 
-  case 160:
+  case 160: /* term: MATCHFCN '(' pattern comma reg_expr ')'  */
 #line 383 "awkgram.y"
-    { (yyval.p) = op3(MATCHFCN, NIL, (yyvsp[(3) - (6)].p), (Node*)makedfa((yyvsp[(5) - (6)].s), 1)); }
+                { (yyval.p) = op3(MATCHFCN, NIL, (yyvsp[-3].p), (Node*)makedfa((yyvsp[-1].s), 1)); }
+#line 3311 "y.tab.c"
     break;
 
-  case 161:
+  case 161: /* term: MATCHFCN '(' pattern comma pattern ')'  */
 #line 385 "awkgram.y"
-    { if (constnode((yyvsp[(5) - (6)].p)))
-			(yyval.p) = op3(MATCHFCN, NIL, (yyvsp[(3) - (6)].p), (Node*)makedfa(strnode((yyvsp[(5) - (6)].p)), 1));
+                { if (constnode((yyvsp[-1].p)))
+			(yyval.p) = op3(MATCHFCN, NIL, (yyvsp[-3].p), (Node*)makedfa(strnode((yyvsp[-1].p)), 1));
 		  else
-			(yyval.p) = op3(MATCHFCN, (Node *)1, (yyvsp[(3) - (6)].p), (yyvsp[(5) - (6)].p)); }
+			(yyval.p) = op3(MATCHFCN, (Node *)1, (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 3320 "y.tab.c"
     break;
 
-  case 162:
+  case 162: /* term: NUMBER  */
 #line 389 "awkgram.y"
-    { (yyval.p) = celltonode((yyvsp[(1) - (1)].cp), CCON); }
+                                        { (yyval.p) = celltonode((yyvsp[0].cp), CCON); }
+#line 3326 "y.tab.c"
     break;
 
-  case 163:
+  case 163: /* term: SPLIT '(' pattern comma varname comma pattern ')'  */
 #line 391 "awkgram.y"
-    { (yyval.p) = op4(SPLIT, (yyvsp[(3) - (8)].p), makearr((yyvsp[(5) - (8)].p)), (yyvsp[(7) - (8)].p), (Node*)STRING); }
+                { (yyval.p) = op4(SPLIT, (yyvsp[-5].p), makearr((yyvsp[-3].p)), (yyvsp[-1].p), (Node*)STRING); }
+#line 3332 "y.tab.c"
     break;
 
-  case 164:
+  case 164: /* term: SPLIT '(' pattern comma varname comma reg_expr ')'  */
 #line 393 "awkgram.y"
-    { (yyval.p) = op4(SPLIT, (yyvsp[(3) - (8)].p), makearr((yyvsp[(5) - (8)].p)), (Node*)makedfa((yyvsp[(7) - (8)].s), 1), (Node *)REGEXPR); }
+                { (yyval.p) = op4(SPLIT, (yyvsp[-5].p), makearr((yyvsp[-3].p)), (Node*)makedfa((yyvsp[-1].s), 1), (Node *)REGEXPR); }
+#line 3338 "y.tab.c"
     break;
 
-  case 165:
+  case 165: /* term: SPLIT '(' pattern comma varname ')'  */
 #line 395 "awkgram.y"
-    { (yyval.p) = op4(SPLIT, (yyvsp[(3) - (6)].p), makearr((yyvsp[(5) - (6)].p)), NIL, (Node*)STRING); }
+                { (yyval.p) = op4(SPLIT, (yyvsp[-3].p), makearr((yyvsp[-1].p)), NIL, (Node*)STRING); }
+#line 3344 "y.tab.c"
     break;
 
-  case 166:
+  case 166: /* term: SPRINTF '(' patlist ')'  */
 #line 396 "awkgram.y"
-    { (yyval.p) = op1((yyvsp[(1) - (4)].i), (yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = op1((yyvsp[-3].i), (yyvsp[-1].p)); }
+#line 3350 "y.tab.c"
     break;
 
-  case 167:
+  case 167: /* term: STRING  */
 #line 397 "awkgram.y"
-    { (yyval.p) = celltonode((yyvsp[(1) - (1)].cp), CCON); }
+                                        { (yyval.p) = celltonode((yyvsp[0].cp), CCON); }
+#line 3356 "y.tab.c"
     break;
 
-  case 168:
+  case 168: /* term: subop '(' reg_expr comma pattern ')'  */
 #line 399 "awkgram.y"
-    { (yyval.p) = op4((yyvsp[(1) - (6)].i), NIL, (Node*)makedfa((yyvsp[(3) - (6)].s), 1), (yyvsp[(5) - (6)].p), rectonode()); }
+                { (yyval.p) = op4((yyvsp[-5].i), NIL, (Node*)makedfa((yyvsp[-3].s), 1), (yyvsp[-1].p), rectonode()); }
+#line 3362 "y.tab.c"
     break;
 
-  case 169:
+  case 169: /* term: subop '(' pattern comma pattern ')'  */
 #line 401 "awkgram.y"
-    { if (constnode((yyvsp[(3) - (6)].p)))
-			(yyval.p) = op4((yyvsp[(1) - (6)].i), NIL, (Node*)makedfa(strnode((yyvsp[(3) - (6)].p)), 1), (yyvsp[(5) - (6)].p), rectonode());
+                { if (constnode((yyvsp[-3].p)))
+			(yyval.p) = op4((yyvsp[-5].i), NIL, (Node*)makedfa(strnode((yyvsp[-3].p)), 1), (yyvsp[-1].p), rectonode());
 		  else
-			(yyval.p) = op4((yyvsp[(1) - (6)].i), (Node *)1, (yyvsp[(3) - (6)].p), (yyvsp[(5) - (6)].p), rectonode()); }
+			(yyval.p) = op4((yyvsp[-5].i), (Node *)1, (yyvsp[-3].p), (yyvsp[-1].p), rectonode()); }
+#line 3371 "y.tab.c"
     break;
 
-  case 170:
+  case 170: /* term: subop '(' reg_expr comma pattern comma var ')'  */
 #line 406 "awkgram.y"
-    { (yyval.p) = op4((yyvsp[(1) - (8)].i), NIL, (Node*)makedfa((yyvsp[(3) - (8)].s), 1), (yyvsp[(5) - (8)].p), (yyvsp[(7) - (8)].p)); }
+                { (yyval.p) = op4((yyvsp[-7].i), NIL, (Node*)makedfa((yyvsp[-5].s), 1), (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 3377 "y.tab.c"
     break;
 
-  case 171:
+  case 171: /* term: subop '(' pattern comma pattern comma var ')'  */
 #line 408 "awkgram.y"
-    { if (constnode((yyvsp[(3) - (8)].p)))
-			(yyval.p) = op4((yyvsp[(1) - (8)].i), NIL, (Node*)makedfa(strnode((yyvsp[(3) - (8)].p)), 1), (yyvsp[(5) - (8)].p), (yyvsp[(7) - (8)].p));
+                { if (constnode((yyvsp[-5].p)))
+			(yyval.p) = op4((yyvsp[-7].i), NIL, (Node*)makedfa(strnode((yyvsp[-5].p)), 1), (yyvsp[-3].p), (yyvsp[-1].p));
 		  else
-			(yyval.p) = op4((yyvsp[(1) - (8)].i), (Node *)1, (yyvsp[(3) - (8)].p), (yyvsp[(5) - (8)].p), (yyvsp[(7) - (8)].p)); }
+			(yyval.p) = op4((yyvsp[-7].i), (Node *)1, (yyvsp[-5].p), (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 3386 "y.tab.c"
     break;
 
-  case 172:
+  case 172: /* term: SUBSTR '(' pattern comma pattern comma pattern ')'  */
 #line 413 "awkgram.y"
-    { (yyval.p) = op3(SUBSTR, (yyvsp[(3) - (8)].p), (yyvsp[(5) - (8)].p), (yyvsp[(7) - (8)].p)); }
+                { (yyval.p) = op3(SUBSTR, (yyvsp[-5].p), (yyvsp[-3].p), (yyvsp[-1].p)); }
+#line 3392 "y.tab.c"
     break;
 
-  case 173:
+  case 173: /* term: SUBSTR '(' pattern comma pattern ')'  */
 #line 415 "awkgram.y"
-    { (yyval.p) = op3(SUBSTR, (yyvsp[(3) - (6)].p), (yyvsp[(5) - (6)].p), NIL); }
+                { (yyval.p) = op3(SUBSTR, (yyvsp[-3].p), (yyvsp[-1].p), NIL); }
+#line 3398 "y.tab.c"
     break;
 
-  case 176:
+  case 176: /* var: varname '[' patlist ']'  */
 #line 421 "awkgram.y"
-    { (yyval.p) = op2(ARRAY, makearr((yyvsp[(1) - (4)].p)), (yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = op2(ARRAY, makearr((yyvsp[-3].p)), (yyvsp[-1].p)); }
+#line 3404 "y.tab.c"
     break;
 
-  case 177:
+  case 177: /* var: IVAR  */
 #line 422 "awkgram.y"
-    { (yyval.p) = op1(INDIRECT, celltonode((yyvsp[(1) - (1)].cp), CVAR)); }
+                                        { (yyval.p) = op1(INDIRECT, celltonode((yyvsp[0].cp), CVAR)); }
+#line 3410 "y.tab.c"
     break;
 
-  case 178:
+  case 178: /* var: INDIRECT term  */
 #line 423 "awkgram.y"
-    { (yyval.p) = op1(INDIRECT, (yyvsp[(2) - (2)].p)); }
+                                        { (yyval.p) = op1(INDIRECT, (yyvsp[0].p)); }
+#line 3416 "y.tab.c"
     break;
 
-  case 179:
+  case 179: /* varlist: %empty  */
 #line 427 "awkgram.y"
-    { arglist = (yyval.p) = 0; }
+                                { arglist = (yyval.p) = 0; }
+#line 3422 "y.tab.c"
     break;
 
-  case 180:
+  case 180: /* varlist: VAR  */
 #line 428 "awkgram.y"
-    { arglist = (yyval.p) = celltonode((yyvsp[(1) - (1)].cp),CVAR); }
+                                { arglist = (yyval.p) = celltonode((yyvsp[0].cp),CVAR); }
+#line 3428 "y.tab.c"
     break;
 
-  case 181:
+  case 181: /* varlist: varlist comma VAR  */
 #line 429 "awkgram.y"
-    {
-			checkdup((yyvsp[(1) - (3)].p), (yyvsp[(3) - (3)].cp));
-			arglist = (yyval.p) = linkum((yyvsp[(1) - (3)].p),celltonode((yyvsp[(3) - (3)].cp),CVAR)); }
+                                {
+			checkdup((yyvsp[-2].p), (yyvsp[0].cp));
+			arglist = (yyval.p) = linkum((yyvsp[-2].p),celltonode((yyvsp[0].cp),CVAR)); }
+#line 3436 "y.tab.c"
     break;
 
-  case 182:
+  case 182: /* varname: VAR  */
 #line 435 "awkgram.y"
-    { (yyval.p) = celltonode((yyvsp[(1) - (1)].cp), CVAR); }
+                                { (yyval.p) = celltonode((yyvsp[0].cp), CVAR); }
+#line 3442 "y.tab.c"
     break;
 
-  case 183:
+  case 183: /* varname: ARG  */
 #line 436 "awkgram.y"
-    { (yyval.p) = op1(ARG, itonp((yyvsp[(1) - (1)].i))); }
+                                { (yyval.p) = op1(ARG, itonp((yyvsp[0].i))); }
+#line 3448 "y.tab.c"
     break;
 
-  case 184:
+  case 184: /* varname: VARNF  */
 #line 437 "awkgram.y"
-    { (yyval.p) = op1(VARNF, (Node *) (yyvsp[(1) - (1)].cp)); }
+                                { (yyval.p) = op1(VARNF, (Node *) (yyvsp[0].cp)); }
+#line 3454 "y.tab.c"
     break;
 
-  case 185:
+  case 185: /* while: WHILE '(' pattern rparen  */
 #line 442 "awkgram.y"
-    { (yyval.p) = notnull((yyvsp[(3) - (4)].p)); }
+                                        { (yyval.p) = notnull((yyvsp[-1].p)); }
+#line 3460 "y.tab.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 3455 "y.tab.c"
+#line 3464 "y.tab.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -3553,14 +3538,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3573,42 +3557,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3619,51 +3603,55 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
 #line 445 "awkgram.y"
 
@@ -3708,4 +3696,3 @@ void checkdup(Node *vl, Cell *cp)	/* check if name already in list */
 		}
 	}
 }
-
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
+/* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,108 +31,130 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     FIRSTTOKEN = 258,
-     PROGRAM = 259,
-     PASTAT = 260,
-     PASTAT2 = 261,
-     XBEGIN = 262,
-     XEND = 263,
-     NL = 264,
-     ARRAY = 265,
-     MATCH = 266,
-     NOTMATCH = 267,
-     MATCHOP = 268,
-     FINAL = 269,
-     DOT = 270,
-     ALL = 271,
-     CCL = 272,
-     NCCL = 273,
-     CHAR = 274,
-     OR = 275,
-     STAR = 276,
-     QUEST = 277,
-     PLUS = 278,
-     EMPTYRE = 279,
-     AND = 280,
-     BOR = 281,
-     APPEND = 282,
-     EQ = 283,
-     GE = 284,
-     GT = 285,
-     LE = 286,
-     LT = 287,
-     NE = 288,
-     IN = 289,
-     ARG = 290,
-     BLTIN = 291,
-     BREAK = 292,
-     CLOSE = 293,
-     CONTINUE = 294,
-     DELETE = 295,
-     DO = 296,
-     EXIT = 297,
-     FOR = 298,
-     FUNC = 299,
-     SUB = 300,
-     GSUB = 301,
-     IF = 302,
-     INDEX = 303,
-     LSUBSTR = 304,
-     MATCHFCN = 305,
-     NEXT = 306,
-     NEXTFILE = 307,
-     ADD = 308,
-     MINUS = 309,
-     MULT = 310,
-     DIVIDE = 311,
-     MOD = 312,
-     ASSIGN = 313,
-     ASGNOP = 314,
-     ADDEQ = 315,
-     SUBEQ = 316,
-     MULTEQ = 317,
-     DIVEQ = 318,
-     MODEQ = 319,
-     POWEQ = 320,
-     PRINT = 321,
-     PRINTF = 322,
-     SPRINTF = 323,
-     ELSE = 324,
-     INTEST = 325,
-     CONDEXPR = 326,
-     POSTINCR = 327,
-     PREINCR = 328,
-     POSTDECR = 329,
-     PREDECR = 330,
-     VAR = 331,
-     IVAR = 332,
-     VARNF = 333,
-     CALL = 334,
-     NUMBER = 335,
-     STRING = 336,
-     REGEXPR = 337,
-     GETLINE = 338,
-     SUBSTR = 339,
-     SPLIT = 340,
-     RETURN = 341,
-     WHILE = 342,
-     CAT = 343,
-     UMINUS = 344,
-     NOT = 345,
-     POWER = 346,
-     INCR = 347,
-     DECR = 348,
-     INDIRECT = 349,
-     LASTTOKEN = 350
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    FIRSTTOKEN = 258,              /* FIRSTTOKEN  */
+    PROGRAM = 259,                 /* PROGRAM  */
+    PASTAT = 260,                  /* PASTAT  */
+    PASTAT2 = 261,                 /* PASTAT2  */
+    XBEGIN = 262,                  /* XBEGIN  */
+    XEND = 263,                    /* XEND  */
+    NL = 264,                      /* NL  */
+    ARRAY = 265,                   /* ARRAY  */
+    MATCH = 266,                   /* MATCH  */
+    NOTMATCH = 267,                /* NOTMATCH  */
+    MATCHOP = 268,                 /* MATCHOP  */
+    FINAL = 269,                   /* FINAL  */
+    DOT = 270,                     /* DOT  */
+    ALL = 271,                     /* ALL  */
+    CCL = 272,                     /* CCL  */
+    NCCL = 273,                    /* NCCL  */
+    CHAR = 274,                    /* CHAR  */
+    OR = 275,                      /* OR  */
+    STAR = 276,                    /* STAR  */
+    QUEST = 277,                   /* QUEST  */
+    PLUS = 278,                    /* PLUS  */
+    EMPTYRE = 279,                 /* EMPTYRE  */
+    AND = 280,                     /* AND  */
+    BOR = 281,                     /* BOR  */
+    APPEND = 282,                  /* APPEND  */
+    EQ = 283,                      /* EQ  */
+    GE = 284,                      /* GE  */
+    GT = 285,                      /* GT  */
+    LE = 286,                      /* LE  */
+    LT = 287,                      /* LT  */
+    NE = 288,                      /* NE  */
+    IN = 289,                      /* IN  */
+    ARG = 290,                     /* ARG  */
+    BLTIN = 291,                   /* BLTIN  */
+    BREAK = 292,                   /* BREAK  */
+    CLOSE = 293,                   /* CLOSE  */
+    CONTINUE = 294,                /* CONTINUE  */
+    DELETE = 295,                  /* DELETE  */
+    DO = 296,                      /* DO  */
+    EXIT = 297,                    /* EXIT  */
+    FOR = 298,                     /* FOR  */
+    FUNC = 299,                    /* FUNC  */
+    SUB = 300,                     /* SUB  */
+    GSUB = 301,                    /* GSUB  */
+    IF = 302,                      /* IF  */
+    INDEX = 303,                   /* INDEX  */
+    LSUBSTR = 304,                 /* LSUBSTR  */
+    MATCHFCN = 305,                /* MATCHFCN  */
+    NEXT = 306,                    /* NEXT  */
+    NEXTFILE = 307,                /* NEXTFILE  */
+    ADD = 308,                     /* ADD  */
+    MINUS = 309,                   /* MINUS  */
+    MULT = 310,                    /* MULT  */
+    DIVIDE = 311,                  /* DIVIDE  */
+    MOD = 312,                     /* MOD  */
+    ASSIGN = 313,                  /* ASSIGN  */
+    ASGNOP = 314,                  /* ASGNOP  */
+    ADDEQ = 315,                   /* ADDEQ  */
+    SUBEQ = 316,                   /* SUBEQ  */
+    MULTEQ = 317,                  /* MULTEQ  */
+    DIVEQ = 318,                   /* DIVEQ  */
+    MODEQ = 319,                   /* MODEQ  */
+    POWEQ = 320,                   /* POWEQ  */
+    PRINT = 321,                   /* PRINT  */
+    PRINTF = 322,                  /* PRINTF  */
+    SPRINTF = 323,                 /* SPRINTF  */
+    ELSE = 324,                    /* ELSE  */
+    INTEST = 325,                  /* INTEST  */
+    CONDEXPR = 326,                /* CONDEXPR  */
+    POSTINCR = 327,                /* POSTINCR  */
+    PREINCR = 328,                 /* PREINCR  */
+    POSTDECR = 329,                /* POSTDECR  */
+    PREDECR = 330,                 /* PREDECR  */
+    VAR = 331,                     /* VAR  */
+    IVAR = 332,                    /* IVAR  */
+    VARNF = 333,                   /* VARNF  */
+    CALL = 334,                    /* CALL  */
+    NUMBER = 335,                  /* NUMBER  */
+    STRING = 336,                  /* STRING  */
+    REGEXPR = 337,                 /* REGEXPR  */
+    GETLINE = 338,                 /* GETLINE  */
+    RETURN = 339,                  /* RETURN  */
+    SPLIT = 340,                   /* SPLIT  */
+    SUBSTR = 341,                  /* SUBSTR  */
+    WHILE = 342,                   /* WHILE  */
+    CAT = 343,                     /* CAT  */
+    NOT = 344,                     /* NOT  */
+    UMINUS = 345,                  /* UMINUS  */
+    POWER = 346,                   /* POWER  */
+    DECR = 347,                    /* DECR  */
+    INCR = 348,                    /* INCR  */
+    INDIRECT = 349,                /* INDIRECT  */
+    LASTTOKEN = 350                /* LASTTOKEN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define FIRSTTOKEN 258
 #define PROGRAM 259
 #define PASTAT 260
@@ -216,38 +236,43 @@
 #define STRING 336
 #define REGEXPR 337
 #define GETLINE 338
-#define SUBSTR 339
+#define RETURN 339
 #define SPLIT 340
-#define RETURN 341
+#define SUBSTR 341
 #define WHILE 342
 #define CAT 343
-#define UMINUS 344
-#define NOT 345
+#define NOT 344
+#define UMINUS 345
 #define POWER 346
-#define INCR 347
-#define DECR 348
+#define DECR 347
+#define INCR 348
 #define INDIRECT 349
 #define LASTTOKEN 350
 
-
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 41 "awkgram.y"
+union YYSTYPE
 {
+#line 41 "awkgram.y"
+
 	Node	*p;
 	Cell	*cp;
 	int	i;
 	char	*s;
-}
-/* Line 1529 of yacc.c.  */
-#line 246 "y.tab.h"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 264 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */